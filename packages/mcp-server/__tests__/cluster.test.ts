@@ -0,0 +1,179 @@
+/**
+ * Unit tests for cluster mode, with the cluster module and metrics registry mocked
+ */
+
+jest.mock('cluster', () => {
+  const { EventEmitter } = jest.requireActual('events');
+  return {
+    __esModule: true,
+    default: Object.assign(new EventEmitter(), { isWorker: false, fork: jest.fn(), workers: {} }),
+  };
+});
+jest.mock('prom-client', () => {
+  const clusterMetrics = jest.fn();
+  return {
+    clusterMetrics,
+    AggregatorRegistry: jest.fn().mockImplementation(() => ({ clusterMetrics })),
+  };
+});
+
+import { requestClusterMetrics, runClusterPrimary } from '../src/cluster';
+
+const mockCluster = jest.requireMock('cluster').default as NodeJS.EventEmitter & {
+  fork: jest.Mock;
+  workers: Record<number, { process: { kill: jest.Mock } }>;
+};
+const mockClusterMetrics = jest.requireMock('prom-client').clusterMetrics as jest.Mock;
+
+const METRICS_REQUEST = 'pdf-text-mcp:cluster-metrics-request';
+const METRICS_RESPONSE = 'pdf-text-mcp:cluster-metrics-response';
+
+describe('cluster', () => {
+  let signalHandlers: Map<string, () => void>;
+  let exitSpy: jest.SpyInstance;
+
+  beforeEach(() => {
+    jest.useFakeTimers();
+    mockCluster.removeAllListeners();
+    mockCluster.fork.mockReset();
+    mockClusterMetrics.mockReset();
+    signalHandlers = new Map();
+
+    const on = process.on.bind(process);
+    jest.spyOn(process, 'on').mockImplementation(((event: string, listener: () => void) => {
+      if (event === 'SIGINT' || event === 'SIGTERM') {
+        signalHandlers.set(event, listener);
+        return process;
+      }
+      return on(event, listener);
+    }) as typeof process.on);
+    exitSpy = jest.spyOn(process, 'exit').mockImplementation((() => undefined) as never);
+    jest.spyOn(console, 'error').mockImplementation();
+  });
+
+  afterEach(() => {
+    jest.useRealTimers();
+    jest.restoreAllMocks();
+  });
+
+  describe('runClusterPrimary', () => {
+    it('should fork the workers and replace one that exits', () => {
+      runClusterPrimary(3);
+
+      expect(mockCluster.fork).toHaveBeenCalledTimes(3);
+
+      mockCluster.emit('exit', { process: { pid: 42 } }, 1, null);
+      expect(mockCluster.fork).toHaveBeenCalledTimes(3);
+
+      // Replacements are started after a delay, so a crash loop does not spin
+      jest.advanceTimersByTime(1000);
+      expect(mockCluster.fork).toHaveBeenCalledTimes(4);
+    });
+
+    it('should not replace workers while shutting down, and exit after the last', () => {
+      const kill = jest.fn();
+      mockCluster.workers = { 1: { process: { kill } }, 2: { process: { kill } } };
+      runClusterPrimary(2);
+
+      signalHandlers.get('SIGTERM')?.();
+      expect(kill).toHaveBeenCalledWith('SIGTERM');
+
+      mockCluster.emit('exit', { process: { pid: 1 } }, 0, 'SIGTERM');
+      expect(exitSpy).not.toHaveBeenCalled();
+      mockCluster.emit('exit', { process: { pid: 2 } }, 0, 'SIGTERM');
+      jest.advanceTimersByTime(1000);
+
+      expect(mockCluster.fork).toHaveBeenCalledTimes(2);
+      expect(exitSpy).toHaveBeenCalledWith(0);
+    });
+
+    it('should answer a worker metrics request with the aggregated metrics', async () => {
+      mockClusterMetrics.mockResolvedValue('pdf_requests_total 5\n');
+      const worker = { send: jest.fn() };
+      runClusterPrimary(1);
+
+      mockCluster.emit('message', worker, { type: METRICS_REQUEST, id: 7 });
+      await Promise.resolve();
+
+      expect(worker.send).toHaveBeenCalledWith({
+        type: METRICS_RESPONSE,
+        id: 7,
+        metrics: 'pdf_requests_total 5\n',
+      });
+    });
+
+    it('should report aggregation failures to the worker', async () => {
+      mockClusterMetrics.mockRejectedValue(new Error('worker timed out'));
+      const worker = { send: jest.fn() };
+      runClusterPrimary(1);
+
+      mockCluster.emit('message', worker, { type: METRICS_REQUEST, id: 8 });
+      await Promise.resolve();
+      await Promise.resolve();
+
+      expect(worker.send).toHaveBeenCalledWith({
+        type: METRICS_RESPONSE,
+        id: 8,
+        error: 'worker timed out',
+      });
+    });
+
+    it('should ignore other worker messages', () => {
+      const worker = { send: jest.fn() };
+      runClusterPrimary(1);
+
+      mockCluster.emit('message', worker, { type: 'something-else' });
+
+      expect(mockClusterMetrics).not.toHaveBeenCalled();
+      expect(worker.send).not.toHaveBeenCalled();
+    });
+  });
+
+  describe('requestClusterMetrics', () => {
+    const originalSend = process.send;
+    let sent: { type: string; id: number }[];
+
+    beforeEach(() => {
+      sent = [];
+      process.send = jest.fn((message: { type: string; id: number }) => {
+        sent.push(message);
+        return true;
+      }) as unknown as typeof process.send;
+    });
+
+    afterEach(() => {
+      process.send = originalSend;
+    });
+
+    it('should resolve with the metrics of the matching response', async () => {
+      const metrics = requestClusterMetrics();
+      const [request] = sent;
+
+      expect(request.type).toBe(METRICS_REQUEST);
+      // A response to another request is not this one's
+      process.emit('message', { type: METRICS_RESPONSE, id: request.id + 1, metrics: 'x' }, null);
+      process.emit('message', { type: METRICS_RESPONSE, id: request.id, metrics: 'mine' }, null);
+
+      await expect(metrics).resolves.toBe('mine');
+    });
+
+    it('should reject with the error reported by the primary', async () => {
+      const metrics = requestClusterMetrics();
+      const [request] = sent;
+
+      process.emit('message', { type: METRICS_RESPONSE, id: request.id, error: 'failed' }, null);
+
+      await expect(metrics).rejects.toThrow('failed');
+    });
+
+    it('should time out when the primary does not answer', async () => {
+      const listeners = process.listenerCount('message');
+      const metrics = requestClusterMetrics();
+
+      jest.advanceTimersByTime(5000);
+
+      await expect(metrics).rejects.toThrow('Timed out waiting for cluster metrics');
+      expect(process.listenerCount('message')).toBe(listeners);
+    });
+  });
+});
@@ -23,7 +23,7 @@ describe('Configuration', () => {
       const config = loadConfig();
 
       expect(config.name).toBe('pdf-text-mcp-server');
-      expect(config.version).toBe('1.0.0');
+      expect(config.version).toBe(require('../package.json').version);
       expect(config.maxFileSize).toBe(DEFAULT_MAX_FILE_SIZE);
       expect(config.timeout).toBe(DEFAULT_TIMEOUT);
     });
@@ -44,6 +44,113 @@ describe('Configuration', () => {
       expect(config.timeout).toBe(60000);
     });
 
+    it('should load PAGE_WORKERS from environment', () => {
+      process.env.PAGE_WORKERS = '4';
+
+      const config = loadConfig();
+
+      expect(config.pageWorkers).toBe(4);
+    });
+
+    it('should load REVISION_CACHE_SIZE from environment', () => {
+      process.env.REVISION_CACHE_SIZE = '16';
+
+      const config = loadConfig();
+
+      expect(config.revisionCacheSize).toBe(16);
+    });
+
+    it('should load FILE_CACHE_SIZE from environment', () => {
+      process.env.FILE_CACHE_SIZE = '256';
+
+      const config = loadConfig();
+
+      expect(config.fileCacheSize).toBe(256);
+    });
+
+    it('should load PLACEMENT_CACHE_SIZE and PLACEMENT_CACHE_BYTES from environment', () => {
+      process.env.PLACEMENT_CACHE_SIZE = '8';
+      process.env.PLACEMENT_CACHE_BYTES = '67108864';
+
+      const config = loadConfig();
+
+      expect(config.placementCacheSize).toBe(8);
+      expect(config.placementCacheBytes).toBe(67108864);
+    });
+
+    it('should load WATCH_DIRECTORIES and enable the file cache for them', () => {
+      process.env.WATCH_DIRECTORIES = '/data/inbox, /data/shared';
+
+      const config = loadConfig();
+
+      expect(config.watchDirectories).toEqual(['/data/inbox', '/data/shared']);
+      expect(config.fileCacheSize).toBeGreaterThan(0);
+    });
+
+    it('should load cluster and shared cache settings from environment', () => {
+      process.env.CLUSTER_WORKERS = '4';
+      process.env.SHARED_CACHE_DIR = '/dev/shm/pdf-text-mcp';
+      process.env.SHARED_CACHE_SIZE = '500';
+
+      const config = loadConfig();
+
+      expect(config.clusterWorkers).toBe(4);
+      expect(config.sharedCacheDir).toBe('/dev/shm/pdf-text-mcp');
+      expect(config.sharedCacheSize).toBe(500);
+    });
+
+    it('should load cache-affinity routing settings from environment', () => {
+      process.env.SELF_URL = 'http://10.0.0.1:3000';
+      process.env.PEER_URLS = 'http://10.0.0.1:3000,http://10.0.0.2:3000';
+      process.env.PEER_DNS = 'pdf-text-mcp-headless';
+
+      const config = loadConfig();
+
+      expect(config.selfUrl).toBe('http://10.0.0.1:3000');
+      expect(config.peerUrls).toEqual(['http://10.0.0.1:3000', 'http://10.0.0.2:3000']);
+      expect(config.peerDns).toBe('pdf-text-mcp-headless');
+    });
+
+    it('should load MAX_CONCURRENCY from environment', () => {
+      process.env.MAX_CONCURRENCY = '16';
+
+      const config = loadConfig();
+
+      expect(config.maxConcurrency).toBe(16);
+    });
+
+    it('should load PREFETCH_READS from environment', () => {
+      process.env.PREFETCH_READS = 'true';
+
+      const config = loadConfig();
+
+      expect(config.prefetchReads).toBe(true);
+    });
+
+    it('should load LAZY_METADATA from environment', () => {
+      process.env.LAZY_METADATA = 'true';
+
+      const config = loadConfig();
+
+      expect(config.lazyMetadata).toBe(true);
+    });
+
+    it('should load SOCKET_PATH from environment', () => {
+      process.env.SOCKET_PATH = '/run/pdf-text-mcp/pdf-text-mcp.sock';
+
+      const config = loadConfig();
+
+      expect(config.socketPath).toBe('/run/pdf-text-mcp/pdf-text-mcp.sock');
+    });
+
+    it('should load NEAR_DUPLICATE_THRESHOLD from environment', () => {
+      process.env.NEAR_DUPLICATE_THRESHOLD = '0.85';
+
+      const config = loadConfig();
+
+      expect(config.nearDuplicateThreshold).toBe(0.85);
+    });
+
     it('should handle invalid MAX_FILE_SIZE gracefully', () => {
       process.env.MAX_FILE_SIZE = 'invalid';
 
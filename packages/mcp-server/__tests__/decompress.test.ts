@@ -0,0 +1,40 @@
+/**
+ * Unit tests for compressed upload decompression
+ */
+
+import * as zlib from 'zlib';
+import { decompressUpload, DecompressedSizeError } from '../src/decompress';
+
+describe('decompressUpload', () => {
+  const pdf = Buffer.from('%PDF-1.7\n'.repeat(100));
+
+  it('should return identity content unchanged', async () => {
+    await expect(decompressUpload(pdf, 'identity', 10)).resolves.toBe(pdf);
+  });
+
+  it('should inflate gzip content', async () => {
+    await expect(decompressUpload(zlib.gzipSync(pdf), 'gzip', 1024)).resolves.toEqual(pdf);
+  });
+
+  it('should reject content that inflates past the limit', async () => {
+    const bomb = zlib.gzipSync(Buffer.alloc(10 * 1024 * 1024));
+
+    await expect(decompressUpload(bomb, 'gzip', 1024 * 1024)).rejects.toBeInstanceOf(
+      DecompressedSizeError
+    );
+  });
+
+  it('should reject corrupt gzip content', async () => {
+    await expect(decompressUpload(Buffer.from('not gzip'), 'gzip', 1024)).rejects.toThrow();
+  });
+
+  it('should inflate zstd content where Node.js supports it', async () => {
+    const zstdCompressSync = (zlib as unknown as { zstdCompressSync?: (data: Buffer) => Buffer })
+      .zstdCompressSync;
+    if (zstdCompressSync) {
+      await expect(decompressUpload(zstdCompressSync(pdf), 'zstd', 1024)).resolves.toEqual(pdf);
+    } else {
+      await expect(decompressUpload(pdf, 'zstd', 1024)).rejects.toThrow('requires Node.js 22.15');
+    }
+  });
+});
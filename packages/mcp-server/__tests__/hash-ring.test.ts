@@ -0,0 +1,44 @@
+/**
+ * Unit tests for the consistent-hash ring
+ */
+
+import { HashRing } from '../src/hash-ring';
+
+describe('HashRing', () => {
+  const nodes = ['http://a:3000', 'http://b:3000', 'http://c:3000'];
+  const keys = Array.from({ length: 3000 }, (_, i) => `key-${i}`);
+
+  it('should return undefined for an empty ring', () => {
+    expect(new HashRing([]).owner('key')).toBeUndefined();
+  });
+
+  it('should assign the same owners regardless of node order', () => {
+    const ring = new HashRing(nodes);
+    const reversed = new HashRing([...nodes].reverse());
+
+    keys.forEach((key) => expect(reversed.owner(key)).toBe(ring.owner(key)));
+  });
+
+  it('should spread keys over all nodes', () => {
+    const ring = new HashRing(nodes);
+    const counts = new Map<string, number>();
+    keys.forEach((key) => {
+      const owner = ring.owner(key) as string;
+      counts.set(owner, (counts.get(owner) ?? 0) + 1);
+    });
+
+    nodes.forEach((node) => expect(counts.get(node)).toBeGreaterThan(keys.length / 6));
+  });
+
+  it('should move only the keys of a removed node', () => {
+    const ring = new HashRing(nodes);
+    const smaller = new HashRing(nodes.slice(0, 2));
+
+    keys.forEach((key) => {
+      const owner = ring.owner(key);
+      if (owner !== 'http://c:3000') {
+        expect(smaller.owner(key)).toBe(owner);
+      }
+    });
+  });
+});
@@ -0,0 +1,94 @@
+/**
+ * Unit tests for the batched structured logger
+ */
+
+describe('logger', () => {
+  const originalEnv = process.env;
+  let writeSpy: jest.SpyInstance;
+
+  function loadLogger(env: Record<string, string> = {}): typeof import('../src/logger') {
+    process.env = { ...originalEnv, ...env };
+    let logger: typeof import('../src/logger') | undefined;
+    jest.isolateModules(() => {
+      logger = require('../src/logger');
+    });
+    return logger as typeof import('../src/logger');
+  }
+
+  async function writtenRecords(): Promise<any[]> {
+    for (let i = 0; i < 20 && writeSpy.mock.calls.length === 0; i++) {
+      await new Promise((resolve) => setImmediate(resolve));
+    }
+    return writeSpy.mock.calls
+      .flatMap(([output]) => String(output).trim().split('\n'))
+      .map((line) => JSON.parse(line));
+  }
+
+  beforeEach(() => {
+    writeSpy = jest.spyOn(process.stdout, 'write').mockImplementation(() => true);
+  });
+
+  afterEach(() => {
+    writeSpy.mockRestore();
+    process.env = originalEnv;
+  });
+
+  it('should defer formatting and write a batch in one call', async () => {
+    const logger = loadLogger();
+
+    logger.info('Tool request received', { correlationId: 'a', toolName: 'extract_text' });
+    logger.info('Tool request completed', { correlationId: 'a', processingTime: 12 });
+    logger.warn('File size exceeds maximum', { correlationId: 'a' });
+    expect(writeSpy).not.toHaveBeenCalled();
+
+    const records = await writtenRecords();
+
+    expect(writeSpy).toHaveBeenCalledTimes(1);
+    expect(records.map((record) => record.message)).toEqual([
+      'Tool request received',
+      'Tool request completed',
+      'File size exceeds maximum',
+    ]);
+    expect(records[0]).toMatchObject({
+      level: 'info',
+      service: 'pdf-text-mcp-server',
+      correlationId: 'a',
+      toolName: 'extract_text',
+    });
+    expect(typeof records[0].timestamp).toBe('string');
+  });
+
+  it('should sample info records but keep every error', async () => {
+    const logger = loadLogger({ LOG_SAMPLE_RATE_INFO: '0' });
+
+    logger.info('HTTP request', { path: '/mcp' });
+    logger.error('Tool request failed', new Error('Invalid PDF'), { correlationId: 'b' });
+    const records = await writtenRecords();
+
+    expect(records).toHaveLength(1);
+    expect(records[0]).toMatchObject({
+      level: 'error',
+      message: 'Tool request failed',
+      error: { message: 'Invalid PDF' },
+    });
+  });
+
+  it('should keep or drop the records of a request together', async () => {
+    const logger = loadLogger({ LOG_SAMPLE_RATE_INFO: '0.5' });
+
+    for (let i = 0; i < 50; i++) {
+      logger.info('Tool request received', { correlationId: `request-${i}` });
+      logger.info('Tool request completed', { correlationId: `request-${i}` });
+    }
+    const records = await writtenRecords();
+
+    const counts = new Map<string, number>();
+    records.forEach((record) => {
+      counts.set(record.correlationId, (counts.get(record.correlationId) ?? 0) + 1);
+      expect(record.sampleRate).toBe(0.5);
+    });
+    expect(counts.size).toBeGreaterThan(0);
+    expect(counts.size).toBeLessThan(50);
+    counts.forEach((count) => expect(count).toBe(2));
+  });
+});
@@ -0,0 +1,136 @@
+/**
+ * Unit tests for cache-affinity routing, with local HTTP servers as replicas
+ */
+
+import { createServer, IncomingMessage, Server } from 'http';
+import { AddressInfo } from 'net';
+import { FORWARDED_HEADER, PeerRouter } from '../src/peer-router';
+
+interface Replica {
+  url: string;
+  server: Server;
+  requests: { headers: IncomingMessage['headers']; body: string }[];
+}
+
+async function startReplica(): Promise<Replica> {
+  const requests: Replica['requests'] = [];
+  const server = createServer((req, res) => {
+    let body = '';
+    req.on('data', (chunk) => (body += chunk));
+    req.on('end', () => {
+      requests.push({ headers: req.headers, body });
+      res.setHeader('Content-Type', 'application/json');
+      res.end(req.url === '/health' ? '{"status":"ok"}' : '{"result":"served"}');
+    });
+  });
+  await new Promise<void>((resolve) => server.listen(0, '127.0.0.1', resolve));
+  const { port } = server.address() as AddressInfo;
+  return { url: `http://127.0.0.1:${port}`, server, requests };
+}
+
+function toolCall(fileContent: string) {
+  return {
+    jsonrpc: '2.0',
+    id: 1,
+    method: 'tools/call',
+    params: { name: 'extract_text', arguments: { fileContent } },
+  };
+}
+
+describe('PeerRouter', () => {
+  let replicas: Replica[] = [];
+
+  afterEach(async () => {
+    await Promise.all(
+      replicas.map((replica) => new Promise((resolve) => replica.server.close(resolve)))
+    );
+    replicas = [];
+  });
+
+  describe('routingKey', () => {
+    it('should key tool calls by fileContent', () => {
+      const key = PeerRouter.routingKey(toolCall('JVBERi0='));
+
+      expect(key).toMatch(/^[0-9a-f]{64}$/);
+      expect(PeerRouter.routingKey(toolCall('JVBERi0='))).toBe(key);
+      expect(PeerRouter.routingKey(toolCall('JVBERi1='))).not.toBe(key);
+    });
+
+    it('should not key other requests', () => {
+      const listTools = { jsonrpc: '2.0', id: 1, method: 'tools/list' };
+
+      expect(PeerRouter.routingKey(listTools)).toBeUndefined();
+      expect(PeerRouter.routingKey([toolCall('JVBERi0=')])).toBeUndefined();
+      expect(PeerRouter.routingKey(undefined)).toBeUndefined();
+    });
+  });
+
+  it('should agree on owners across replicas', () => {
+    const urls = ['http://10.0.0.1:3000', 'http://10.0.0.2:3000', 'http://10.0.0.3:3000'];
+    const routers = urls.map((selfUrl) => new PeerRouter({ selfUrl, peerUrls: urls }));
+
+    for (let i = 0; i < 50; i++) {
+      const key = PeerRouter.routingKey(toolCall(`document-${i}`)) as string;
+      const owners = routers.map((router, index) => router.ownerOf(key) ?? urls[index]);
+      expect(new Set(owners).size).toBe(1);
+    }
+  });
+
+  it('should drop unreachable peers from the ring', async () => {
+    const peer = await startReplica();
+    replicas.push(peer);
+    const router = new PeerRouter({
+      selfUrl: 'http://127.0.0.1:1',
+      peerUrls: [peer.url, 'http://127.0.0.1:9'],
+    });
+
+    await router.start();
+    router.stop();
+
+    expect(router.members).toEqual(['http://127.0.0.1:1', peer.url].sort());
+  });
+
+  it('should know itself by its address when the DNS answers include it', async () => {
+    const self = await startReplica();
+    replicas.push(self);
+    const { port } = new URL(self.url);
+    const router = new PeerRouter({
+      selfUrl: `http://localhost:${port}`,
+      peerDns: '127.0.0.1',
+      peerPort: Number(port),
+    });
+
+    await router.start();
+    router.stop();
+
+    // Peers see this replica as http://127.0.0.1:<port>; it is one member, not two
+    expect(router.members).toEqual([self.url]);
+    expect(router.ownerOf(PeerRouter.routingKey(toolCall('JVBERi0=')) as string)).toBeUndefined();
+    expect(self.requests).toHaveLength(0);
+  });
+
+  it('should forward to the owner with the forwarded marker', async () => {
+    const owner = await startReplica();
+    replicas.push(owner);
+    const router = new PeerRouter({ selfUrl: 'http://127.0.0.1:1', peerUrls: [owner.url] });
+
+    const response = await router.forward(owner.url, toolCall('JVBERi0='), {
+      authorization: 'Bearer key',
+    });
+
+    expect(await response?.json()).toEqual({ result: 'served' });
+    expect(owner.requests[0].headers[FORWARDED_HEADER]).toBe('1');
+    expect(owner.requests[0].headers.authorization).toBe('Bearer key');
+    expect(JSON.parse(owner.requests[0].body)).toEqual(toolCall('JVBERi0='));
+  });
+
+  it('should resolve to undefined and drop an unreachable owner', async () => {
+    const router = new PeerRouter({
+      selfUrl: 'http://127.0.0.1:1',
+      peerUrls: ['http://127.0.0.1:9'],
+    });
+
+    expect(await router.forward('http://127.0.0.1:9', toolCall('JVBERi0='), {})).toBeUndefined();
+    expect(router.members).toEqual(['http://127.0.0.1:1']);
+  });
+});
@@ -0,0 +1,70 @@
+/**
+ * Unit tests for the binary result format
+ */
+
+import { decodeTextResult, encodeTextResult, pageText } from '../src/result-format';
+
+describe('binary result format', () => {
+  const pages = ['שלום page one\n', 'page two\n'];
+  const result = {
+    text: pages.join(''),
+    pageCount: 2,
+    processingTime: 12.5,
+    fileSize: 2048,
+    textDirection: 'rtl' as const,
+    pageOffsets: [0, Buffer.byteLength(pages[0], 'utf8')],
+    reusedPageCount: 1,
+    minhash: [1, 2, 3],
+  };
+
+  it('should round-trip a result', () => {
+    const view = decodeTextResult(Buffer.concat(encodeTextResult(result)));
+
+    expect(view.pageCount).toBe(2);
+    expect(view.processingTime).toBe(12.5);
+    expect(view.fileSize).toBe(2048);
+    expect(view.textDirection).toBe('rtl');
+    expect(Array.from(view.pageOffsets)).toEqual(result.pageOffsets);
+    expect(view.fields).toEqual({ reusedPageCount: 1 });
+    expect(view.text.toString('utf8')).toBe(result.text);
+  });
+
+  it('should return page texts as views over the input', () => {
+    const data = Buffer.concat(encodeTextResult(result));
+    const view = decodeTextResult(data);
+
+    const first = pageText(view, 0);
+    const second = pageText(view, 1);
+
+    expect(first.toString('utf8')).toBe(pages[0]);
+    expect(second.toString('utf8')).toBe(pages[1]);
+    expect(first.buffer).toBe(data.buffer);
+  });
+
+  it('should encode a result without page offsets or other fields', () => {
+    const data = Buffer.concat(
+      encodeTextResult({
+        text: 'text',
+        pageCount: 1,
+        processingTime: 1,
+        fileSize: 10,
+        textDirection: 'ltr',
+      })
+    );
+    const view = decodeTextResult(data);
+
+    expect(data.length).toBe(40 + 4);
+    expect(view.pageOffsets).toHaveLength(0);
+    expect(view.fields).toEqual({});
+    expect(view.textDirection).toBe('ltr');
+  });
+
+  it('should reject truncated or foreign data', () => {
+    const data = Buffer.concat(encodeTextResult(result));
+
+    expect(() => decodeTextResult(data.subarray(0, data.length - 1))).toThrow('truncated');
+    expect(() => decodeTextResult(Buffer.from('{"text":"json"}'.padEnd(64)))).toThrow(
+      'Not a binary text result'
+    );
+  });
+});
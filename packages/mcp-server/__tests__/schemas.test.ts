@@ -83,6 +83,18 @@ describe('Input Schemas', () => {
       expect(result.success).toBe(false);
     });
 
+    it('should accept a known contentEncoding', () => {
+      const result = schema.safeParse({ fileContent: 'VGVzdA==', contentEncoding: 'gzip' });
+
+      expect(result.success).toBe(true);
+    });
+
+    it('should reject an unknown contentEncoding', () => {
+      const result = schema.safeParse({ fileContent: 'VGVzdA==', contentEncoding: 'brotli' });
+
+      expect(result.success).toBe(false);
+    });
+
     it('should accept valid base64 content', () => {
       const base64Samples = [
         'SGVsbG8gV29ybGQ=', // "Hello World"
@@ -5,7 +5,7 @@
 import { BasePdfTextMcpServer } from '../../src/servers/base-pdf-text-mcp-server';
 import { ServerConfig } from '../../src/types';
 import { McpServer } from '@modelcontextprotocol/sdk/server/mcp.js';
-import { PdfExtractor } from '@pdf-text-mcp/pdf-parser';
+import { LshIndex, PdfExtractor } from '@pdf-text-mcp/pdf-parser';
 
 // Mock dependencies
 jest.mock('@modelcontextprotocol/sdk/server/mcp.js');
@@ -81,6 +81,7 @@ describe('BasePdfTextMcpServer', () => {
       expect(PdfExtractor).toHaveBeenCalledWith({
         maxFileSize: 10485760,
         timeout: 5000,
+        minhashPermutations: 0,
       });
 
       expect(setupToolsCallCount).toBe(1);
@@ -142,6 +143,95 @@ describe('BasePdfTextMcpServer', () => {
     });
   });
 
+  describe('flagNearDuplicate', () => {
+    const extraction = {
+      text: 'text',
+      pageCount: 1,
+      processingTime: 10,
+      fileSize: 100,
+      textDirection: 'ltr' as const,
+    };
+    const signature = Array.from({ length: 128 }, (_, i) => i);
+
+    beforeEach(() => {
+      const { LshIndex: ActualLshIndex } = jest.requireActual('@pdf-text-mcp/pdf-parser');
+      (LshIndex as unknown as jest.Mock).mockImplementation(
+        (options) => new ActualLshIndex(options)
+      );
+    });
+
+    it('should request signatures only when enabled', () => {
+      new TestPdfTextMcpServer({ ...testConfig, nearDuplicateThreshold: 0.8 });
+
+      expect(PdfExtractor).toHaveBeenCalledWith(
+        expect.objectContaining({ minhashPermutations: 128 })
+      );
+    });
+
+    it('should flag a repeat as a near-duplicate and drop the signature', () => {
+      const server = new TestPdfTextMcpServer({ ...testConfig, nearDuplicateThreshold: 0.8 });
+
+      const first = (server as any).flagNearDuplicate(
+        { ...extraction, minhash: signature },
+        () => 'a.pdf'
+      );
+      const second = (server as any).flagNearDuplicate(
+        { ...extraction, minhash: signature },
+        () => 'b.pdf'
+      );
+
+      expect(first).toEqual(extraction);
+      expect(second).toEqual({
+        ...extraction,
+        nearDuplicateOf: 'a.pdf',
+        nearDuplicateSimilarity: 1,
+      });
+    });
+
+    it('should not index page-range results', () => {
+      const server = new TestPdfTextMcpServer({ ...testConfig, nearDuplicateThreshold: 0.8 });
+      const pageRange = { startPage: 'iv', endPage: 7 };
+
+      (server as any).flagNearDuplicate(
+        { ...extraction, minhash: signature },
+        () => 'a.pdf',
+        pageRange
+      );
+      const whole = (server as any).flagNearDuplicate(
+        { ...extraction, minhash: signature },
+        () => 'b.pdf'
+      );
+
+      expect(whole).toEqual(extraction);
+    });
+
+    it('should not match or index documents without text', () => {
+      const server = new TestPdfTextMcpServer({ ...testConfig, nearDuplicateThreshold: 0.8 });
+
+      // Two different image-only PDFs: the native layer signs neither
+      const first = (server as any).flagNearDuplicate(
+        { ...extraction, text: '', minhash: [] },
+        () => 'scan-a.pdf'
+      );
+      const second = (server as any).flagNearDuplicate(
+        { ...extraction, text: '', minhash: [] },
+        () => 'scan-b.pdf'
+      );
+
+      expect(first).toEqual({ ...extraction, text: '' });
+      expect(second).toEqual({ ...extraction, text: '' });
+      expect((server as any).nearDuplicateIndex.size).toBe(0);
+    });
+
+    it('should pass results through when disabled', () => {
+      const server = new TestPdfTextMcpServer(testConfig);
+      const documentId = jest.fn();
+
+      expect((server as any).flagNearDuplicate(extraction, documentId)).toBe(extraction);
+      expect(documentId).not.toHaveBeenCalled();
+    });
+  });
+
   describe('config storage', () => {
     it('should store config for subclass access', () => {
       const server = new TestPdfTextMcpServer(testConfig);
@@ -6,10 +6,15 @@ import { PdfTextMcpServerHttp } from '../../src/servers/pdf-text-mcp-server-http
 import { ServerConfig } from '../../src/types';
 import { McpServer } from '@modelcontextprotocol/sdk/server/mcp.js';
 import { StreamableHTTPServerTransport } from '@modelcontextprotocol/sdk/server/streamableHttp.js';
-import { PdfExtractor } from '@pdf-text-mcp/pdf-parser';
+import { PdfExtractor, warmup } from '@pdf-text-mcp/pdf-parser';
 import { McpError, ErrorCode } from '@modelcontextprotocol/sdk/types.js';
 import express from 'express';
 import { createServer } from 'http';
+import { gzipSync } from 'zlib';
+import { promises as fs } from 'fs';
+import * as os from 'os';
+import * as path from 'path';
+import { decodeTextResult, pageText, RESULT_FORMAT_MEDIA_TYPE } from '../../src/result-format';
 
 // Mock dependencies
 jest.mock('@modelcontextprotocol/sdk/server/mcp.js');
@@ -48,6 +53,8 @@ describe('PdfTextMcpServerHttp', () => {
     mockExtractor = {
       extractTextFromBuffer: jest.fn(),
       getMetadataFromBuffer: jest.fn(),
+      getOutlineFromBuffer: jest.fn(),
+      extractSectionFromBuffer: jest.fn(),
     } as any;
 
     mockTransport = {
@@ -59,6 +66,7 @@ describe('PdfTextMcpServerHttp', () => {
       use: jest.fn(),
       get: jest.fn(),
       all: jest.fn(),
+      post: jest.fn(),
     };
 
     mockHttpServer = {
@@ -71,9 +79,17 @@ describe('PdfTextMcpServerHttp', () => {
 
     (McpServer as jest.Mock).mockImplementation(() => mockServer);
     (PdfExtractor as jest.Mock).mockImplementation(() => mockExtractor);
+    (warmup as jest.Mock).mockResolvedValue({
+      addonLoadTime: 5,
+      extractionTime: 20,
+      bidiTime: 8,
+      totalTime: 30,
+      threads: 4,
+    });
     (StreamableHTTPServerTransport as jest.Mock).mockImplementation(() => mockTransport);
     (express as unknown as jest.Mock).mockReturnValue(mockExpressApp);
     (express.json as jest.Mock) = jest.fn();
+    (express.raw as jest.Mock) = jest.fn();
     (createServer as jest.Mock).mockReturnValue(mockHttpServer);
 
     consoleErrorSpy = jest.spyOn(console, 'error').mockImplementation();
@@ -87,7 +103,7 @@ describe('PdfTextMcpServerHttp', () => {
     it('should create instance and register tools', () => {
       new PdfTextMcpServerHttp(testConfig);
 
-      expect(mockServer.registerTool).toHaveBeenCalledTimes(2);
+      expect(mockServer.registerTool).toHaveBeenCalledTimes(4);
       expect(mockServer.registerTool).toHaveBeenCalledWith(
         'extract_text',
         expect.objectContaining({
@@ -102,6 +118,16 @@ describe('PdfTextMcpServerHttp', () => {
         }),
         expect.any(Function)
       );
+      expect(mockServer.registerTool).toHaveBeenCalledWith(
+        'get_outline',
+        expect.objectContaining({ description: expect.stringContaining('outline') }),
+        expect.any(Function)
+      );
+      expect(mockServer.registerTool).toHaveBeenCalledWith(
+        'extract_section',
+        expect.objectContaining({ description: expect.stringContaining('outline section') }),
+        expect.any(Function)
+      );
     });
   });
 
@@ -118,6 +144,7 @@ describe('PdfTextMcpServerHttp', () => {
       expect(mockExpressApp.get).toHaveBeenCalledWith('/ready', expect.any(Function));
       expect(mockExpressApp.get).toHaveBeenCalledWith('/metrics', expect.any(Function));
       expect(mockExpressApp.all).toHaveBeenCalledWith('/mcp', expect.any(Function), expect.any(Function), expect.any(Function));
+      expect(mockExpressApp.post).toHaveBeenCalledWith('/extract', expect.any(Function), undefined, expect.any(Function));
 
       // Verify HTTP server started
       expect(createServer).toHaveBeenCalledWith(mockExpressApp);
@@ -129,6 +156,21 @@ describe('PdfTextMcpServerHttp', () => {
       );
     });
 
+    it('should warm up the addon before reporting ready', async () => {
+      const server = new PdfTextMcpServerHttp(testConfig);
+      let readyDuringWarmup: boolean | undefined;
+      (warmup as jest.Mock).mockImplementation(async () => {
+        readyDuringWarmup = (server as any).ready;
+        return { addonLoadTime: 5, extractionTime: 20, bidiTime: 8, totalTime: 30, threads: 4 };
+      });
+
+      await server.start();
+
+      expect(warmup).toHaveBeenCalledTimes(1);
+      expect(readyDuringWarmup).toBe(false);
+      expect((server as any).ready).toBe(true);
+    });
+
     it('should use default port and host if not specified', async () => {
       const configWithoutPort = { ...testConfig, port: undefined, host: undefined };
       const server = new PdfTextMcpServerHttp(configWithoutPort);
@@ -164,6 +206,7 @@ describe('PdfTextMcpServerHttp', () => {
   describe('tool handlers', () => {
     let extractTextHandler: any;
     let extractMetadataHandler: any;
+    let extractSectionHandler: any;
 
     beforeEach(() => {
       new PdfTextMcpServerHttp(testConfig);
@@ -171,6 +214,7 @@ describe('PdfTextMcpServerHttp', () => {
 
       extractTextHandler = registerToolCalls.find(call => call[0] === 'extract_text')[2];
       extractMetadataHandler = registerToolCalls.find(call => call[0] === 'extract_metadata')[2];
+      extractSectionHandler = registerToolCalls.find(call => call[0] === 'extract_section')[2];
     });
 
     describe('extract_text handler', () => {
@@ -187,7 +231,8 @@ describe('PdfTextMcpServerHttp', () => {
         const result = await extractTextHandler({ fileContent: base64Content });
 
         expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(
-          Buffer.from(base64Content, 'base64')
+          Buffer.from(base64Content, 'base64'),
+          undefined
         );
         expect(result).toEqual({
           content: [
@@ -214,6 +259,42 @@ describe('PdfTextMcpServerHttp', () => {
         });
       });
 
+      it('should decompress gzip content before extraction', async () => {
+        const pdf = Buffer.from('%PDF-1.4 uncompressed streams');
+        mockExtractor.extractTextFromBuffer.mockResolvedValue({ text: 'text', pageCount: 1 } as any);
+
+        await extractTextHandler({
+          fileContent: gzipSync(pdf).toString('base64'),
+          contentEncoding: 'gzip',
+        });
+
+        expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(pdf, undefined);
+      });
+
+      it('should reject compressed content that inflates past the max size', async () => {
+        const bomb = gzipSync(Buffer.alloc(20000000)).toString('base64'); // 20MB inflated
+
+        await expect(
+          extractTextHandler({ fileContent: bomb, contentEncoding: 'gzip' })
+        ).rejects.toMatchObject({
+          code: ErrorCode.InvalidRequest,
+          message: expect.stringContaining('exceeds maximum'),
+        });
+        expect(mockExtractor.extractTextFromBuffer).not.toHaveBeenCalled();
+      });
+
+      it('should reject content that is not validly compressed', async () => {
+        await expect(
+          extractTextHandler({
+            fileContent: Buffer.from('%PDF-1.4').toString('base64'),
+            contentEncoding: 'gzip',
+          })
+        ).rejects.toMatchObject({
+          code: ErrorCode.InvalidRequest,
+          message: expect.stringContaining('Cannot decompress gzip fileContent'),
+        });
+      });
+
       it('should handle extraction errors', async () => {
         const base64Content = Buffer.from('fake pdf content').toString('base64');
         mockExtractor.extractTextFromBuffer.mockRejectedValue(new Error('Extraction failed'));
@@ -231,6 +312,31 @@ describe('PdfTextMcpServerHttp', () => {
       });
     });
 
+    describe('extract_section handler', () => {
+      it('should extract the named section from base64 content', async () => {
+        const mockResult = {
+          text: 'Termination clause',
+          pageCount: 2,
+          processingTime: 50,
+          fileSize: 1024,
+          section: { title: 'Section 4: Termination', level: 0, pageNumber: 3, endPageNumber: 4 },
+        };
+        const base64Content = Buffer.from('fake pdf content').toString('base64');
+        mockExtractor.extractSectionFromBuffer.mockResolvedValue(mockResult as any);
+
+        const result = await extractSectionHandler(
+          { fileContent: base64Content, section: 'Section 4' },
+          {}
+        );
+
+        expect(mockExtractor.extractSectionFromBuffer).toHaveBeenCalledWith(
+          Buffer.from(base64Content, 'base64'),
+          'Section 4'
+        );
+        expect(result.content[0].text).toBe(JSON.stringify(mockResult, null, 2));
+      });
+    });
+
     describe('extract_metadata handler', () => {
       it('should extract metadata from base64 content successfully', async () => {
         const mockMetadata = {
@@ -258,6 +364,139 @@ describe('PdfTextMcpServerHttp', () => {
     });
   });
 
+  describe('shared cache', () => {
+    it('should report the processing time of the call serving a cached result', async () => {
+      const cacheDir = await fs.mkdtemp(path.join(os.tmpdir(), 'http-shared-cache-test-'));
+      try {
+        const server = new PdfTextMcpServerHttp({ ...testConfig, sharedCacheDir: cacheDir });
+        const operation = jest.fn().mockResolvedValue({ text: 'text', processingTime: 60000 });
+        const pdf = Buffer.from('%PDF-1.7');
+
+        await (server as any).cached('extract_text', pdf, undefined, operation);
+        const hit = await (server as any).cached('extract_text', pdf, undefined, operation);
+
+        expect(operation).toHaveBeenCalledTimes(1);
+        expect(hit.text).toBe('text');
+        expect(hit.processingTime).toBeLessThan(60000);
+      } finally {
+        await fs.rm(cacheDir, { recursive: true, force: true });
+      }
+    });
+  });
+
+  describe('/extract endpoint', () => {
+    const mockResult = {
+      text: 'page one\npage two\n',
+      pageCount: 2,
+      processingTime: 10,
+      fileSize: 8,
+      textDirection: 'ltr' as const,
+      pageOffsets: [0, 9],
+    };
+
+    function mockResponse() {
+      const res: any = { parts: [] as Buffer[] };
+      res.status = jest.fn(() => res);
+      res.set = jest.fn(() => res);
+      res.json = jest.fn(() => res);
+      res.write = jest.fn((part: Buffer) => res.parts.push(part));
+      res.end = jest.fn();
+      return res;
+    }
+
+    function mockRequest(
+      accept: string,
+      query: Record<string, string> = {},
+      body: Buffer = Buffer.from('%PDF-1.7'),
+      headers: Record<string, string> = {}
+    ) {
+      return {
+        body,
+        query,
+        headers,
+        accepts: jest.fn((types: string[]) => (types.includes(accept) ? accept : false)),
+      } as any;
+    }
+
+    beforeEach(() => {
+      mockExtractor.extractTextFromBuffer.mockResolvedValue(mockResult);
+    });
+
+    it('should return JSON by default', async () => {
+      const server = new PdfTextMcpServerHttp(testConfig);
+      const res = mockResponse();
+
+      await (server as any).handleExtract(mockRequest('application/json', { startPage: 'iv' }), res);
+
+      expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(Buffer.from('%PDF-1.7'), {
+        startPage: 'iv',
+        endPage: undefined,
+      });
+      expect(res.json).toHaveBeenCalledWith(mockResult);
+    });
+
+    it('should return the binary result when the client prefers it', async () => {
+      const server = new PdfTextMcpServerHttp(testConfig);
+      const res = mockResponse();
+
+      await (server as any).handleExtract(
+        mockRequest(RESULT_FORMAT_MEDIA_TYPE, { startPage: '2', endPage: '2' }),
+        res
+      );
+      const view = decodeTextResult(Buffer.concat(res.parts));
+
+      expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(
+        Buffer.from('%PDF-1.7'),
+        { startPage: 2, endPage: 2 },
+        { pageOffsets: true }
+      );
+      expect(res.set).toHaveBeenCalledWith('Content-Type', RESULT_FORMAT_MEDIA_TYPE);
+      expect(res.end).toHaveBeenCalled();
+      expect(pageText(view, 1).toString('utf8')).toBe('page two\n');
+    });
+
+    it('should decompress a body sent with Content-Encoding', async () => {
+      const server = new PdfTextMcpServerHttp(testConfig);
+      const res = mockResponse();
+
+      await (server as any).handleExtract(
+        mockRequest('application/json', {}, gzipSync(Buffer.from('%PDF-1.7')), {
+          'content-encoding': 'gzip',
+        }),
+        res
+      );
+
+      expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(
+        Buffer.from('%PDF-1.7'),
+        undefined
+      );
+    });
+
+    it('should reject unsupported Content-Encoding', async () => {
+      const server = new PdfTextMcpServerHttp(testConfig);
+      const res = mockResponse();
+
+      await (server as any).handleExtract(
+        mockRequest('application/json', {}, Buffer.from('%PDF-1.7'), { 'content-encoding': 'br' }),
+        res
+      );
+
+      expect(res.status).toHaveBeenCalledWith(415);
+      expect(mockExtractor.extractTextFromBuffer).not.toHaveBeenCalled();
+    });
+
+    it('should report extraction errors as JSON', async () => {
+      const server = new PdfTextMcpServerHttp(testConfig);
+      const res = mockResponse();
+      mockExtractor.extractTextFromBuffer.mockRejectedValue(new Error('boom'));
+
+      await (server as any).handleExtract(mockRequest(RESULT_FORMAT_MEDIA_TYPE), res);
+
+      expect(res.status).toHaveBeenCalledWith(500);
+      expect(res.json).toHaveBeenCalledWith({ error: 'boom' });
+    });
+  });
+
   describe('buildFromConfig', () => {
     it('should create PdfTextMcpServerHttp instance', () => {
       const { buildFromConfig } = require('../../src/servers/pdf-text-mcp-server-http');
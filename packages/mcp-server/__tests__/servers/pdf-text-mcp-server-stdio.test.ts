@@ -9,12 +9,14 @@ import { StdioServerTransport } from '@modelcontextprotocol/sdk/server/stdio.js'
 import { PdfExtractor } from '@pdf-text-mcp/pdf-parser';
 import { McpError, ErrorCode } from '@modelcontextprotocol/sdk/types.js';
 import * as fs from 'fs/promises';
+import { WatchIndexer } from '../../src/watch-indexer';
 
 // Mock dependencies
 jest.mock('@modelcontextprotocol/sdk/server/mcp.js');
 jest.mock('@modelcontextprotocol/sdk/server/stdio.js');
 jest.mock('@pdf-text-mcp/pdf-parser');
 jest.mock('fs/promises');
+jest.mock('../../src/watch-indexer');
 
 describe('PdfTextMcpServerStdio', () => {
   const testConfig: ServerConfig = {
@@ -42,6 +44,8 @@ describe('PdfTextMcpServerStdio', () => {
     mockExtractor = {
       extractText: jest.fn(),
       getMetadata: jest.fn(),
+      getOutline: jest.fn(),
+      extractSection: jest.fn(),
     } as any;
 
     mockTransport = {} as any;
@@ -62,7 +66,7 @@ describe('PdfTextMcpServerStdio', () => {
     it('should create instance and register tools', () => {
       new PdfTextMcpServerStdio(testConfig);
 
-      expect(mockServer.registerTool).toHaveBeenCalledTimes(2);
+      expect(mockServer.registerTool).toHaveBeenCalledTimes(4);
       expect(mockServer.registerTool).toHaveBeenCalledWith(
         'extract_text',
         expect.objectContaining({
@@ -77,6 +81,16 @@ describe('PdfTextMcpServerStdio', () => {
         }),
         expect.any(Function)
       );
+      expect(mockServer.registerTool).toHaveBeenCalledWith(
+        'get_outline',
+        expect.objectContaining({ description: expect.stringContaining('outline') }),
+        expect.any(Function)
+      );
+      expect(mockServer.registerTool).toHaveBeenCalledWith(
+        'extract_section',
+        expect.objectContaining({ description: expect.stringContaining('outline section') }),
+        expect.any(Function)
+      );
     });
   });
 
@@ -101,6 +115,26 @@ describe('PdfTextMcpServerStdio', () => {
     });
   });
 
+  describe('watch directories', () => {
+    it('should start and stop the indexer when directories are configured', async () => {
+      const server = new PdfTextMcpServerStdio({ ...testConfig, watchDirectories: ['/inbox'] });
+
+      await server.start();
+      await server.stop();
+
+      expect(WatchIndexer).toHaveBeenCalledWith(mockExtractor, { directories: ['/inbox'] });
+      const indexer = (WatchIndexer as jest.Mock).mock.instances[0];
+      expect(indexer.start).toHaveBeenCalled();
+      expect(indexer.stop).toHaveBeenCalled();
+    });
+
+    it('should not create an indexer by default', () => {
+      new PdfTextMcpServerStdio(testConfig);
+
+      expect(WatchIndexer).not.toHaveBeenCalled();
+    });
+  });
+
   describe('stop', () => {
     it('should close the server gracefully', async () => {
       const server = new PdfTextMcpServerStdio(testConfig);
@@ -117,6 +151,7 @@ describe('PdfTextMcpServerStdio', () => {
   describe('tool handlers', () => {
     let extractTextHandler: any;
     let extractMetadataHandler: any;
+    let extractSectionHandler: any;
 
     beforeEach(() => {
       new PdfTextMcpServerStdio(testConfig);
@@ -124,6 +159,7 @@ describe('PdfTextMcpServerStdio', () => {
 
       extractTextHandler = registerToolCalls.find(call => call[0] === 'extract_text')[2];
       extractMetadataHandler = registerToolCalls.find(call => call[0] === 'extract_metadata')[2];
+      extractSectionHandler = registerToolCalls.find(call => call[0] === 'extract_section')[2];
     });
 
     describe('extract_text handler', () => {
@@ -139,7 +175,7 @@ describe('PdfTextMcpServerStdio', () => {
         const result = await extractTextHandler({ filePath: '/test/file.pdf' }, {});
 
         expect(fs.access).toHaveBeenCalledWith('/test/file.pdf');
-        expect(mockExtractor.extractText).toHaveBeenCalledWith('/test/file.pdf');
+        expect(mockExtractor.extractText).toHaveBeenCalledWith('/test/file.pdf', undefined);
         expect(result).toEqual({
           content: [
             {
@@ -150,6 +186,17 @@ describe('PdfTextMcpServerStdio', () => {
         });
       });
 
+      it('should pass page numbers and labels as a page range', async () => {
+        mockExtractor.extractText.mockResolvedValue({ text: 'Preface', pageCount: 4 } as any);
+
+        await extractTextHandler({ filePath: '/test/file.pdf', startPage: 'iv', endPage: 7 }, {});
+
+        expect(mockExtractor.extractText).toHaveBeenCalledWith('/test/file.pdf', {
+          startPage: 'iv',
+          endPage: 7,
+        });
+      });
+
       it('should throw McpError if file not found', async () => {
         (fs.access as jest.Mock).mockRejectedValue(new Error('File not found'));
 
@@ -212,6 +259,28 @@ describe('PdfTextMcpServerStdio', () => {
         ).rejects.toThrow(McpError);
       });
     });
+
+    describe('extract_section handler', () => {
+      it('should extract the named section', async () => {
+        const mockResult = {
+          text: 'Termination clause',
+          pageCount: 2,
+          processingTime: 50,
+          fileSize: 1024,
+          section: { title: 'Section 4: Termination', level: 0, pageNumber: 3, endPageNumber: 4 },
+        };
+        mockExtractor.extractSection.mockResolvedValue(mockResult as any);
+
+        const result = await extractSectionHandler(
+          { filePath: '/test/file.pdf', section: 'Section 4' },
+          {}
+        );
+
+        expect(fs.access).toHaveBeenCalledWith('/test/file.pdf');
+        expect(mockExtractor.extractSection).toHaveBeenCalledWith('/test/file.pdf', 'Section 4');
+        expect(result.content[0].text).toBe(JSON.stringify(mockResult, null, 2));
+      });
+    });
   });
 
   describe('buildFromConfig', () => {
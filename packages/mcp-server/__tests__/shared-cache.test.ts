@@ -0,0 +1,66 @@
+/**
+ * Unit tests for the shared result cache
+ */
+
+import { promises as fs } from 'fs';
+import * as path from 'path';
+import * as os from 'os';
+import { SharedResultCache } from '../src/shared-cache';
+
+describe('SharedResultCache', () => {
+  const content = Buffer.from('%PDF-1.7 test content');
+  let tempDir: string;
+  let cache: SharedResultCache;
+
+  beforeEach(async () => {
+    tempDir = await fs.mkdtemp(path.join(os.tmpdir(), 'shared-cache-test-'));
+    cache = new SharedResultCache(path.join(tempDir, 'cache'), 10);
+  });
+
+  afterEach(async () => {
+    await fs.rm(tempDir, { recursive: true, force: true });
+  });
+
+  it('should return undefined on a miss and the stored value on a hit', async () => {
+    const key = SharedResultCache.key('extract_text', content);
+
+    expect(await cache.get(key)).toBeUndefined();
+    await cache.set(key, { text: 'hello', pageCount: 1 });
+    expect(await cache.get(key)).toEqual({ text: 'hello', pageCount: 1 });
+  });
+
+  it('should share entries between instances on the same directory', async () => {
+    const key = SharedResultCache.key('extract_metadata', content);
+    await cache.set(key, { pageCount: 3 });
+
+    const other = new SharedResultCache(path.join(tempDir, 'cache'), 10);
+    expect(await other.get(key)).toEqual({ pageCount: 3 });
+  });
+
+  it('should compute once and serve repeats from the cache', async () => {
+    const key = SharedResultCache.key('extract_text', content);
+    const compute = jest.fn().mockResolvedValue({ text: 'hello' });
+
+    expect(await cache.getOrCompute(key, compute)).toEqual({ text: 'hello' });
+    expect(await cache.getOrCompute(key, compute)).toEqual({ text: 'hello' });
+    expect(compute).toHaveBeenCalledTimes(1);
+  });
+
+  it('should keep concurrent writes of one key apart', async () => {
+    const key = SharedResultCache.key('extract_text', content);
+
+    await Promise.all([cache.set(key, { text: 'first' }), cache.set(key, { text: 'second' })]);
+
+    expect([{ text: 'first' }, { text: 'second' }]).toContainEqual(await cache.get(key));
+    expect(await fs.readdir(path.join(tempDir, 'cache'))).toEqual([`${key}.json`]);
+  });
+
+  it('should key by tool, content and variant', () => {
+    const key = SharedResultCache.key('extract_text', content);
+
+    expect(SharedResultCache.key('extract_text', content)).toBe(key);
+    expect(SharedResultCache.key('extract_metadata', content)).not.toBe(key);
+    expect(SharedResultCache.key('extract_text', Buffer.from('other'))).not.toBe(key);
+    expect(SharedResultCache.key('extract_text', content, { startPage: 2 })).not.toBe(key);
+  });
+});
@@ -0,0 +1,380 @@
+/**
+ * Unit tests for the Unix domain socket transport
+ */
+
+import { promises as fs } from 'fs';
+import { connect, createServer, Socket } from 'net';
+import * as path from 'path';
+import * as os from 'os';
+import { gzipSync } from 'zlib';
+import { PdfExtractor } from '@pdf-text-mcp/pdf-parser';
+import {
+  decodeRequest,
+  encodeRequest,
+  FrameDecoder,
+  SocketTransport,
+  SOCKET_OPERATION_EXTRACT_METADATA,
+  SOCKET_OPERATION_EXTRACT_TEXT,
+  SOCKET_ENCODING_GZIP,
+  SOCKET_FORMAT_BINARY,
+  SOCKET_STATUS_ERROR,
+  SOCKET_STATUS_OK,
+} from '../src/socket-transport';
+import { decodeTextResult } from '../src/result-format';
+
+jest.mock('@pdf-text-mcp/pdf-parser');
+
+interface Response {
+  status: number;
+  operation: number;
+  requestId: number;
+  fields: any;
+  text: string;
+  body?: Buffer;
+}
+
+function parseResponse(payload: Buffer): Response {
+  const jsonLength = payload.readUInt32BE(8);
+  const response: Response = {
+    status: payload.readUInt8(0),
+    operation: payload.readUInt8(1),
+    requestId: payload.readUInt32BE(4),
+    fields: undefined,
+    text: '',
+  };
+  if (payload.readUInt8(2) === SOCKET_FORMAT_BINARY) {
+    response.body = payload.subarray(16);
+    return response;
+  }
+  response.fields = JSON.parse(payload.subarray(16, 16 + jsonLength).toString('utf8'));
+  response.text = payload.subarray(16 + jsonLength).toString('utf8');
+  return response;
+}
+
+function collectResponses(socket: Socket, count: number): Promise<Response[]> {
+  const decoder = new FrameDecoder(1024 * 1024);
+  const responses: Response[] = [];
+  return new Promise((resolve) => {
+    socket.on('data', (chunk: Buffer) => {
+      decoder.push(chunk).forEach((payload) => responses.push(parseResponse(payload)));
+      if (responses.length >= count) {
+        resolve(responses);
+      }
+    });
+  });
+}
+
+describe('FrameDecoder', () => {
+  const frame = (payload: string) => {
+    const length = Buffer.alloc(4);
+    length.writeUInt32BE(payload.length, 0);
+    return Buffer.concat([length, Buffer.from(payload)]);
+  };
+
+  it('should reassemble frames split at any byte', () => {
+    const stream = Buffer.concat([frame('first'), frame(''), frame('second')]);
+    const decoder = new FrameDecoder(100);
+
+    const payloads = Array.from(stream).flatMap((byte) => decoder.push(Buffer.from([byte])));
+
+    expect(payloads.map((payload) => payload.toString())).toEqual(['first', '', 'second']);
+  });
+
+  it('should return several frames from one chunk', () => {
+    const decoder = new FrameDecoder(100);
+
+    const payloads = decoder.push(Buffer.concat([frame('a'), frame('bc')]));
+
+    expect(payloads.map((payload) => payload.toString())).toEqual(['a', 'bc']);
+  });
+
+  it('should reject oversized frames', () => {
+    const decoder = new FrameDecoder(3);
+
+    expect(() => decoder.push(frame('toolong'))).toThrow('exceeds maximum');
+  });
+});
+
+describe('request encoding', () => {
+  it('should round-trip a request', () => {
+    const request = {
+      operation: SOCKET_OPERATION_EXTRACT_TEXT,
+      encoding: SOCKET_ENCODING_GZIP,
+      format: SOCKET_FORMAT_BINARY,
+      requestId: 7,
+      startPage: 2,
+      endPage: 5,
+      content: Buffer.from('%PDF-1.7'),
+    };
+
+    const encoded = encodeRequest(request);
+
+    expect(encoded.readUInt32BE(0)).toBe(encoded.length - 4);
+    expect(decodeRequest(encoded.subarray(4))).toEqual(request);
+  });
+});
+
+describe('SocketTransport', () => {
+  let tempDir: string;
+  let socketPath: string;
+  let mockExtractor: jest.Mocked<PdfExtractor>;
+  let transport: SocketTransport;
+  let client: Socket;
+  let consoleErrorSpy: jest.SpyInstance;
+
+  beforeEach(async () => {
+    tempDir = await fs.mkdtemp(path.join(os.tmpdir(), 'socket-transport-test-'));
+    socketPath = path.join(tempDir, 'pdf-text-mcp.sock');
+    mockExtractor = {
+      extractTextFromBuffer: jest.fn().mockResolvedValue({
+        text: 'שלום hello',
+        pageCount: 2,
+        processingTime: 5,
+        fileSize: 8,
+        textDirection: 'mixed',
+      }),
+      getMetadataFromBuffer: jest.fn().mockResolvedValue({ pageCount: 2, version: '1.7' }),
+    } as any;
+    consoleErrorSpy = jest.spyOn(console, 'error').mockImplementation();
+
+    transport = new SocketTransport(mockExtractor, { socketPath, maxFileSize: 1024 });
+    await transport.start();
+    client = connect(socketPath);
+  });
+
+  afterEach(async () => {
+    client.destroy();
+    await transport.stop();
+    await fs.rm(tempDir, { recursive: true, force: true });
+    consoleErrorSpy.mockRestore();
+  });
+
+  it('should extract text from raw bytes and return it as UTF-8', async () => {
+    const responses = collectResponses(client, 1);
+    client.write(
+      encodeRequest({
+        operation: SOCKET_OPERATION_EXTRACT_TEXT,
+        requestId: 1,
+        startPage: 2,
+        endPage: 0,
+        content: Buffer.from('%PDF-1.7'),
+      })
+    );
+
+    const [response] = await responses;
+
+    expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(Buffer.from('%PDF-1.7'), {
+      startPage: 2,
+      endPage: undefined,
+    });
+    expect(response).toEqual({
+      status: SOCKET_STATUS_OK,
+      operation: SOCKET_OPERATION_EXTRACT_TEXT,
+      requestId: 1,
+      fields: { pageCount: 2, processingTime: 5, fileSize: 8, textDirection: 'mixed' },
+      text: 'שלום hello',
+    });
+  });
+
+  it('should return a binary result when asked for', async () => {
+    const responses = collectResponses(client, 2);
+    client.write(
+      Buffer.concat([
+        encodeRequest({
+          operation: SOCKET_OPERATION_EXTRACT_TEXT,
+          format: SOCKET_FORMAT_BINARY,
+          requestId: 1,
+          startPage: 0,
+          endPage: 0,
+          content: Buffer.from('%PDF-1.7'),
+        }),
+        encodeRequest({
+          operation: SOCKET_OPERATION_EXTRACT_METADATA,
+          format: SOCKET_FORMAT_BINARY,
+          requestId: 2,
+          startPage: 0,
+          endPage: 0,
+          content: Buffer.from('%PDF-1.7'),
+        }),
+      ])
+    );
+
+    const byId = new Map((await responses).map((response) => [response.requestId, response]));
+    const text = byId.get(1) as Response;
+    const view = decodeTextResult(text.body as Buffer);
+
+    expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(
+      Buffer.from('%PDF-1.7'),
+      undefined,
+      { pageOffsets: true }
+    );
+    expect(text.status).toBe(SOCKET_STATUS_OK);
+    expect(view.pageCount).toBe(2);
+    expect(view.fileSize).toBe(8);
+    expect(view.text.toString('utf8')).toBe('שלום hello');
+    // Metadata stays JSON
+    expect(byId.get(2)?.body).toBeUndefined();
+    expect(byId.get(2)?.fields).toEqual({ pageCount: 2, version: '1.7' });
+  });
+
+  it('should answer pipelined requests by request id', async () => {
+    const responses = collectResponses(client, 2);
+    client.write(
+      Buffer.concat([
+        encodeRequest({
+          operation: SOCKET_OPERATION_EXTRACT_METADATA,
+          requestId: 10,
+          startPage: 0,
+          endPage: 0,
+          content: Buffer.from('%PDF-1.7'),
+        }),
+        encodeRequest({
+          operation: SOCKET_OPERATION_EXTRACT_TEXT,
+          requestId: 11,
+          startPage: 0,
+          endPage: 0,
+          content: Buffer.from('%PDF-1.7'),
+        }),
+      ])
+    );
+
+    const byId = new Map((await responses).map((response) => [response.requestId, response]));
+
+    expect(byId.get(10)?.fields).toEqual({ pageCount: 2, version: '1.7' });
+    expect(byId.get(11)?.text).toBe('שלום hello');
+    expect(mockExtractor.extractTextFromBuffer).toHaveBeenCalledWith(
+      Buffer.from('%PDF-1.7'),
+      undefined
+    );
+  });
+
+  it('should decompress gzip-encoded content', async () => {
+    const responses = collectResponses(client, 1);
+    client.write(
+      encodeRequest({
+        operation: SOCKET_OPERATION_EXTRACT_METADATA,
+        encoding: SOCKET_ENCODING_GZIP,
+        requestId: 4,
+        startPage: 0,
+        endPage: 0,
+        content: gzipSync(Buffer.from('%PDF-1.7')),
+      })
+    );
+
+    const [response] = await responses;
+
+    expect(response.status).toBe(SOCKET_STATUS_OK);
+    expect(mockExtractor.getMetadataFromBuffer).toHaveBeenCalledWith(Buffer.from('%PDF-1.7'));
+  });
+
+  it('should reject content that inflates past the max file size', async () => {
+    const responses = collectResponses(client, 1);
+    client.write(
+      encodeRequest({
+        operation: SOCKET_OPERATION_EXTRACT_METADATA,
+        encoding: SOCKET_ENCODING_GZIP,
+        requestId: 5,
+        startPage: 0,
+        endPage: 0,
+        content: gzipSync(Buffer.alloc(4096)),
+      })
+    );
+
+    const [response] = await responses;
+
+    expect(response.status).toBe(SOCKET_STATUS_ERROR);
+    expect(response.fields.message).toContain('exceeds maximum');
+    expect(mockExtractor.getMetadataFromBuffer).not.toHaveBeenCalled();
+  });
+
+  it('should report extraction errors', async () => {
+    mockExtractor.extractTextFromBuffer.mockRejectedValueOnce(new Error('Invalid PDF'));
+    const responses = collectResponses(client, 1);
+    client.write(
+      encodeRequest({
+        operation: SOCKET_OPERATION_EXTRACT_TEXT,
+        requestId: 3,
+        startPage: 0,
+        endPage: 0,
+        content: Buffer.from('junk'),
+      })
+    );
+
+    const [response] = await responses;
+
+    expect(response.status).toBe(SOCKET_STATUS_ERROR);
+    expect(response.requestId).toBe(3);
+    expect(response.fields).toEqual({ message: 'Invalid PDF' });
+  });
+
+  it('should not read past the in-flight limit of a connection', async () => {
+    client.destroy();
+    await transport.stop();
+    transport = new SocketTransport(mockExtractor, {
+      socketPath,
+      maxFileSize: 1024,
+      maxInFlight: 1,
+    });
+    await transport.start();
+    client = connect(socketPath);
+
+    let finishFirst: () => void = () => undefined;
+    mockExtractor.getMetadataFromBuffer.mockImplementationOnce(
+      () => new Promise((resolve) => (finishFirst = () => resolve({ pageCount: 1 } as any)))
+    );
+    const responses = collectResponses(client, 3);
+    client.write(
+      Buffer.concat(
+        [1, 2, 3].map((requestId) =>
+          encodeRequest({
+            operation: SOCKET_OPERATION_EXTRACT_METADATA,
+            requestId,
+            startPage: 0,
+            endPage: 0,
+            content: Buffer.from('%PDF-1.7'),
+          })
+        )
+      )
+    );
+
+    await new Promise((resolve) => setTimeout(resolve, 50));
+    expect(mockExtractor.getMetadataFromBuffer).toHaveBeenCalledTimes(1);
+
+    finishFirst();
+    const answered = await responses;
+
+    expect(answered.map((response) => response.requestId)).toEqual([1, 2, 3]);
+    expect(mockExtractor.getMetadataFromBuffer).toHaveBeenCalledTimes(3);
+  });
+
+  it('should only remove the socket file it bound', async () => {
+    client.destroy();
+    // Another process replaced the socket file
+    await fs.rm(socketPath);
+    const other = createServer();
+    await new Promise<void>((resolve) => other.listen(socketPath, resolve));
+
+    await transport.stop();
+
+    await expect(fs.stat(socketPath)).resolves.toBeDefined();
+    await new Promise((resolve) => other.close(resolve));
+  });
+
+  it('should refuse a socket path another process listens on', async () => {
+    const second = new SocketTransport(mockExtractor, { socketPath, maxFileSize: 1024 });
+
+    await expect(second.start()).rejects.toThrow('already in use');
+  });
+
+  it('should replace a stale socket file', async () => {
+    client.destroy();
+    await transport.stop();
+    await fs.writeFile(socketPath, '');
+
+    transport = new SocketTransport(mockExtractor, { socketPath, maxFileSize: 1024 });
+    await transport.start();
+    client = connect(socketPath);
+
+    await new Promise((resolve) => client.once('connect', resolve));
+  });
+});
@@ -0,0 +1,91 @@
+/**
+ * Unit tests for the watch-folder indexer
+ */
+
+import { promises as fs } from 'fs';
+import * as path from 'path';
+import * as os from 'os';
+import { PdfExtractor } from '@pdf-text-mcp/pdf-parser';
+import { WatchIndexer } from '../src/watch-indexer';
+
+jest.mock('@pdf-text-mcp/pdf-parser');
+
+async function waitFor(condition: () => boolean, timeoutMs = 2000): Promise<void> {
+  const deadline = Date.now() + timeoutMs;
+  while (!condition()) {
+    if (Date.now() > deadline) {
+      throw new Error('Condition not met in time');
+    }
+    await new Promise((resolve) => setTimeout(resolve, 10));
+  }
+}
+
+describe('WatchIndexer', () => {
+  let tempDir: string;
+  let mockExtractor: jest.Mocked<PdfExtractor>;
+  let indexer: WatchIndexer;
+
+  beforeEach(async () => {
+    tempDir = await fs.mkdtemp(path.join(os.tmpdir(), 'watch-indexer-test-'));
+    mockExtractor = { extractText: jest.fn().mockResolvedValue({}) } as any;
+    indexer = new WatchIndexer(mockExtractor, { directories: [tempDir], settleMs: 20 });
+  });
+
+  afterEach(async () => {
+    await indexer.stop();
+    await fs.rm(tempDir, { recursive: true, force: true });
+  });
+
+  it('should pre-extract PDFs already in the directory', async () => {
+    await fs.writeFile(path.join(tempDir, 'existing.pdf'), '%PDF-1.7');
+    await fs.writeFile(path.join(tempDir, 'notes.txt'), 'not a pdf');
+
+    await indexer.start();
+    await waitFor(() => indexer.indexedCount === 1);
+
+    expect(mockExtractor.extractText).toHaveBeenCalledTimes(1);
+    expect(mockExtractor.extractText).toHaveBeenCalledWith(path.join(tempDir, 'existing.pdf'));
+  });
+
+  it('should pre-extract PDFs dropped into the directory once written', async () => {
+    await indexer.start();
+
+    await fs.writeFile(path.join(tempDir, 'dropped.pdf'), '%PDF-1.7');
+    await waitFor(() => indexer.indexedCount === 1);
+
+    expect(mockExtractor.extractText).toHaveBeenCalledWith(path.join(tempDir, 'dropped.pdf'));
+  });
+
+  it('should hold background extraction while a foreground call runs', async () => {
+    await fs.writeFile(path.join(tempDir, 'queued.pdf'), '%PDF-1.7');
+
+    let finishForeground: () => void = () => undefined;
+    const foreground = indexer.foreground(
+      path.join(tempDir, 'other.pdf'),
+      () => new Promise<void>((resolve) => (finishForeground = resolve))
+    );
+    await indexer.start();
+    await new Promise((resolve) => setTimeout(resolve, 50));
+
+    expect(mockExtractor.extractText).not.toHaveBeenCalled();
+    expect(indexer.queuedCount).toBe(1);
+
+    finishForeground();
+    await foreground;
+    await waitFor(() => indexer.indexedCount === 1);
+  });
+
+  it('should leave queued files requested in the foreground to the foreground call', async () => {
+    const filePath = path.join(tempDir, 'requested.pdf');
+    await fs.writeFile(filePath, '%PDF-1.7');
+
+    await indexer.foreground(filePath, async () => {
+      await indexer.start();
+      expect(indexer.queuedCount).toBe(1);
+    });
+    await indexer.foreground(filePath, async () => undefined);
+
+    expect(indexer.queuedCount).toBe(0);
+    expect(mockExtractor.extractText).not.toHaveBeenCalled();
+  });
+});
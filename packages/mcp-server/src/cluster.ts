@@ -0,0 +1,132 @@
+/**
+ * Multi-process cluster mode for the HTTP server
+ *
+ * The primary process forks worker processes that each run a complete HTTP
+ * server on the shared port; Node's cluster module hands incoming connections
+ * to the workers. JSON parsing, base64 decoding and result serialization are
+ * then spread over several event loops instead of one.
+ *
+ * Prometheus metrics live in each worker. A worker serving /metrics asks the
+ * primary, which collects and aggregates every worker's registry.
+ */
+
+import cluster, { Worker } from 'cluster';
+import { AggregatorRegistry } from 'prom-client';
+
+const METRICS_REQUEST = 'pdf-text-mcp:cluster-metrics-request';
+const METRICS_RESPONSE = 'pdf-text-mcp:cluster-metrics-response';
+const METRICS_REQUEST_TIMEOUT_MS = 5000;
+
+// Restarting a worker that keeps crashing on startup would spin; back off instead
+const RESPAWN_DELAY_MS = 1000;
+
+interface MetricsRequest {
+  type: typeof METRICS_REQUEST;
+  id: number;
+}
+
+interface MetricsResponse {
+  type: typeof METRICS_RESPONSE;
+  id: number;
+  metrics?: string;
+  error?: string;
+}
+
+/**
+ * Whether this process is a cluster worker
+ */
+export function isClusterWorker(): boolean {
+  return cluster.isWorker;
+}
+
+/**
+ * Run the cluster primary: fork workers, replace crashed ones, aggregate
+ * metrics and forward shutdown signals. Workers run the regular server.
+ */
+export function runClusterPrimary(workerCount: number): void {
+  const aggregator = new AggregatorRegistry();
+  let shuttingDown = false;
+  let liveWorkers = 0;
+
+  const fork = () => {
+    if (shuttingDown) {
+      return;
+    }
+    liveWorkers++;
+    cluster.fork();
+  };
+  for (let i = 0; i < workerCount; i++) {
+    fork();
+  }
+  console.error(`PDF Text Extraction MCP Server cluster primary started ${workerCount} workers`);
+
+  cluster.on('exit', (worker, code, signal) => {
+    liveWorkers--;
+    if (shuttingDown) {
+      if (liveWorkers === 0) {
+        process.exit(0);
+      }
+      return;
+    }
+    console.error(
+      `Worker ${worker.process.pid} exited (${signal ?? code}), starting a replacement`
+    );
+    setTimeout(fork, RESPAWN_DELAY_MS);
+  });
+
+  cluster.on('message', (worker: Worker, message: MetricsRequest) => {
+    if (!message || message.type !== METRICS_REQUEST) {
+      return;
+    }
+    aggregator.clusterMetrics().then(
+      (metrics) => worker.send({ type: METRICS_RESPONSE, id: message.id, metrics }),
+      (error: Error) =>
+        worker.send({ type: METRICS_RESPONSE, id: message.id, error: error.message })
+    );
+  });
+
+  const shutdown = (signal: NodeJS.Signals) => {
+    if (shuttingDown) {
+      return;
+    }
+    shuttingDown = true;
+    console.error(`\nReceived ${signal}, stopping cluster workers...`);
+    if (liveWorkers === 0) {
+      process.exit(0);
+    }
+    Object.values(cluster.workers ?? {}).forEach((worker) => worker?.process.kill(signal));
+  };
+  process.on('SIGINT', () => shutdown('SIGINT'));
+  process.on('SIGTERM', () => shutdown('SIGTERM'));
+}
+
+let nextMetricsRequestId = 0;
+
+/**
+ * Ask the primary for the metrics of all workers, in Prometheus text format
+ */
+export function requestClusterMetrics(): Promise<string> {
+  const id = ++nextMetricsRequestId;
+
+  return new Promise<string>((resolve, reject) => {
+    const onMessage = (message: MetricsResponse) => {
+      if (!message || message.type !== METRICS_RESPONSE || message.id !== id) {
+        return;
+      }
+      clearTimeout(timer);
+      process.off('message', onMessage);
+      if (message.error !== undefined) {
+        reject(new Error(message.error));
+      } else {
+        resolve(message.metrics ?? '');
+      }
+    };
+    const timer = setTimeout(() => {
+      process.off('message', onMessage);
+      reject(new Error('Timed out waiting for cluster metrics'));
+    }, METRICS_REQUEST_TIMEOUT_MS);
+
+    process.on('message', onMessage);
+    (process.send as (message: MetricsRequest) => boolean)({ type: METRICS_REQUEST, id });
+  });
+}
@@ -3,8 +3,28 @@
  * Loads settings from environment variables with sensible defaults
  */
 
+import { readFileSync } from 'fs';
+import * as path from 'path';
 import { ServerConfig, TransportMode } from './types';
-import { DEFAULT_MAX_FILE_SIZE, DEFAULT_TIMEOUT } from '@pdf-text-mcp/pdf-parser';
+import {
+  DEFAULT_MAX_FILE_SIZE,
+  DEFAULT_TIMEOUT,
+  DEFAULT_PAGE_WORKERS,
+  DEFAULT_REVISION_CACHE_SIZE,
+  DEFAULT_FILE_CACHE_SIZE,
+  DEFAULT_PLACEMENT_CACHE_SIZE,
+  DEFAULT_PLACEMENT_CACHE_BYTES,
+  DEFAULT_MAX_CONCURRENCY,
+} from '@pdf-text-mcp/pdf-parser';
+
+// Reported in the MCP handshake; clients key cached results on it, so it must
+// change with every release (src/ and dist/ both sit next to package.json)
+const PACKAGE_VERSION: string = JSON.parse(
+  readFileSync(path.join(__dirname, '..', 'package.json'), 'utf8')
+).version;
+
+// File cache size when watch directories are set but FILE_CACHE_SIZE is not
+const WATCH_FILE_CACHE_SIZE = 256;
 
 /**
  * Load server configuration from environment variables
@@ -13,15 +33,70 @@ export function loadConfig(): ServerConfig {
   // Transport mode: stdio (default) for local Claude Desktop, websocket for remote deployment
   const transportMode = (process.env.TRANSPORT_MODE as TransportMode) || 'stdio';
 
+  // Comma-separated directories to pre-extract PDFs from (stdio mode)
+  const watchDirectories = splitList(process.env.WATCH_DIRECTORIES);
+
   return {
     name: 'pdf-text-mcp-server',
-    version: '1.0.0',
+    version: PACKAGE_VERSION,
     // Maximum file size (default: 100MB)
     maxFileSize: process.env.MAX_FILE_SIZE
       ? Math.floor(Number(process.env.MAX_FILE_SIZE))
       : DEFAULT_MAX_FILE_SIZE,
     // Extraction timeout (default: 30 seconds)
     timeout: process.env.TIMEOUT ? parseInt(process.env.TIMEOUT, 10) : DEFAULT_TIMEOUT,
+    // Page-span threads per document (default: 1, sequential)
+    pageWorkers: process.env.PAGE_WORKERS
+      ? parseInt(process.env.PAGE_WORKERS, 10)
+      : DEFAULT_PAGE_WORKERS,
+    // Revisions kept for incremental re-extraction (default: 0, disabled)
+    revisionCacheSize: process.env.REVISION_CACHE_SIZE
+      ? parseInt(process.env.REVISION_CACHE_SIZE, 10)
+      : DEFAULT_REVISION_CACHE_SIZE,
+    // Files whose results are cached by path, stdio mode (default: 0, disabled;
+    // pre-extraction needs the cache, so watching directories turns it on)
+    fileCacheSize: process.env.FILE_CACHE_SIZE
+      ? parseInt(process.env.FILE_CACHE_SIZE, 10)
+      : watchDirectories.length > 0
+        ? WATCH_FILE_CACHE_SIZE
+        : DEFAULT_FILE_CACHE_SIZE,
+    watchDirectories,
+    // Documents whose text placements are kept for page-range requests (default: 0, disabled)
+    placementCacheSize: process.env.PLACEMENT_CACHE_SIZE
+      ? parseInt(process.env.PLACEMENT_CACHE_SIZE, 10)
+      : DEFAULT_PLACEMENT_CACHE_SIZE,
+    // Bytes of placements the cache may hold (default: 256MB)
+    placementCacheBytes: process.env.PLACEMENT_CACHE_BYTES
+      ? Math.floor(Number(process.env.PLACEMENT_CACHE_BYTES))
+      : DEFAULT_PLACEMENT_CACHE_BYTES,
+    // Upper bound of the adaptive concurrency limit (default: 0, unlimited)
+    maxConcurrency: process.env.MAX_CONCURRENCY
+      ? parseInt(process.env.MAX_CONCURRENCY, 10)
+      : DEFAULT_MAX_CONCURRENCY,
+    // Read-ahead block cache for path-based text extraction (default: off)
+    prefetchReads: process.env.PREFETCH_READS === 'true',
+    // Metadata without loading the whole xref of classic-xref files (default: off)
+    lazyMetadata: process.env.LAZY_METADATA === 'true',
+    // Near-duplicate flagging threshold (default: 0, disabled)
+    nearDuplicateThreshold: process.env.NEAR_DUPLICATE_THRESHOLD
+      ? Number(process.env.NEAR_DUPLICATE_THRESHOLD)
+      : 0,
+    nearDuplicateIndexSize: process.env.NEAR_DUPLICATE_INDEX_SIZE
+      ? parseInt(process.env.NEAR_DUPLICATE_INDEX_SIZE, 10)
+      : 10000,
+    // Cluster mode: worker processes on the shared HTTP port (default: 0, single process)
+    clusterWorkers: process.env.CLUSTER_WORKERS ? parseInt(process.env.CLUSTER_WORKERS, 10) : 0,
+    // Result cache shared by the workers of this host (default: unset, disabled)
+    sharedCacheDir: process.env.SHARED_CACHE_DIR || undefined,
+    sharedCacheSize: process.env.SHARED_CACHE_SIZE
+      ? parseInt(process.env.SHARED_CACHE_SIZE, 10)
+      : 10000,
+    // Cache-affinity routing between replicas (default: unset, disabled)
+    selfUrl: process.env.SELF_URL || undefined,
+    peerUrls: splitList(process.env.PEER_URLS),
+    peerDns: process.env.PEER_DNS || undefined,
+    // Unix domain socket transport (default: unset, disabled)
+    socketPath: process.env.SOCKET_PATH || undefined,
     // Transport configuration
     transportMode,
     port: process.env.PORT ? parseInt(process.env.PORT, 10) : 3000,
@@ -29,3 +104,13 @@ export function loadConfig(): ServerConfig {
     apiKey: process.env.API_KEY,
   };
 }
+
+/**
+ * Split a comma-separated environment variable, dropping empty items
+ */
+function splitList(value: string | undefined): string[] {
+  return (value || '')
+    .split(',')
+    .map((item) => item.trim())
+    .filter((item) => item.length > 0);
+}
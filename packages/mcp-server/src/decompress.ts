@@ -0,0 +1,76 @@
+/**
+ * Decompression of compressed PDF uploads
+ *
+ * Uncompressed PDFs (scanned-form templates, PDF/A with uncompressed streams)
+ * shrink 3-5x with gzip or zstd, so callers may upload them compressed. The
+ * upload is inflated as a stream and abandoned as soon as the output passes
+ * the size limit, so a small decompression bomb cannot exhaust memory.
+ */
+
+import { Transform } from 'stream';
+import * as zlib from 'zlib';
+
+export const CONTENT_ENCODINGS = ['identity', 'gzip', 'zstd'] as const;
+export type ContentEncoding = (typeof CONTENT_ENCODINGS)[number];
+
+/**
+ * Thrown when the decompressed upload would exceed the size limit
+ */
+export class DecompressedSizeError extends Error {
+  constructor(maxSize: number) {
+    super(`Decompressed content exceeds maximum (${maxSize} bytes)`);
+    this.name = 'DecompressedSizeError';
+  }
+}
+
+// zstd support arrived in Node.js 22.15; typed loosely for older type definitions
+const createZstdDecompress = (zlib as unknown as { createZstdDecompress?: () => Transform })
+  .createZstdDecompress;
+
+/**
+ * Decompress an upload, rejecting once its output passes maxSize bytes
+ * @param content Uploaded bytes
+ * @param encoding How the bytes are compressed; 'identity' returns them as is
+ * @param maxSize Largest decompressed size accepted
+ */
+export function decompressUpload(
+  content: Buffer,
+  encoding: ContentEncoding,
+  maxSize: number
+): Promise<Buffer> {
+  if (encoding === 'identity') {
+    return Promise.resolve(content);
+  }
+
+  let decompressor: Transform;
+  if (encoding === 'gzip') {
+    decompressor = zlib.createGunzip();
+  } else if (createZstdDecompress) {
+    decompressor = createZstdDecompress();
+  } else {
+    return Promise.reject(
+      new Error(`zstd content encoding requires Node.js 22.15 or later (running ${process.version})`)
+    );
+  }
+
+  return new Promise((resolve, reject) => {
+    const chunks: Buffer[] = [];
+    let size = 0;
+
+    decompressor.on('data', (chunk: Buffer) => {
+      size += chunk.length;
+      if (size > maxSize) {
+        decompressor.destroy(new DecompressedSizeError(maxSize));
+        return;
+      }
+      chunks.push(chunk);
+    });
+    decompressor.on('error', (error) => {
+      chunks.length = 0;
+      reject(error);
+    });
+    decompressor.on('end', () => resolve(Buffer.concat(chunks, size)));
+
+    decompressor.end(content);
+  });
+}
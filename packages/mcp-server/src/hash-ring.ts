@@ -0,0 +1,70 @@
+/**
+ * Consistent-hash ring
+ *
+ * Each node is placed on the ring at many pseudo-random points (virtual
+ * nodes), and a key belongs to the first node clockwise from its own hash.
+ * Adding or removing a node only moves the keys of that node's arcs, so the
+ * other nodes keep their share of the keys (and of the cache hits).
+ */
+
+import { createHash } from 'crypto';
+
+// Points per node; enough to keep shares within a few percent of even
+const DEFAULT_VIRTUAL_NODES = 128;
+
+function hashPoint(value: string): number {
+  return createHash('sha1').update(value).digest().readUInt32BE(0);
+}
+
+export class HashRing {
+  private readonly points: number[] = [];
+  private readonly owners: string[] = [];
+  private readonly nodeList: string[];
+
+  /**
+   * @param nodes Node identifiers; order and duplicates do not matter
+   */
+  constructor(nodes: string[], virtualNodes: number = DEFAULT_VIRTUAL_NODES) {
+    this.nodeList = Array.from(new Set(nodes)).sort();
+
+    const entries: { point: number; node: string }[] = [];
+    for (const node of this.nodeList) {
+      for (let i = 0; i < virtualNodes; i++) {
+        entries.push({ point: hashPoint(`${node}#${i}`), node });
+      }
+    }
+    // Ties (rare) resolve by node so that every replica builds the same ring
+    entries.sort((a, b) => a.point - b.point || (a.node < b.node ? -1 : 1));
+    for (const { point, node } of entries) {
+      this.points.push(point);
+      this.owners.push(node);
+    }
+  }
+
+  get nodes(): string[] {
+    return this.nodeList;
+  }
+
+  /**
+   * Node owning a key, or undefined for an empty ring
+   */
+  owner(key: string): string | undefined {
+    if (this.points.length === 0) {
+      return undefined;
+    }
+
+    const point = hashPoint(key);
+    let low = 0;
+    let high = this.points.length;
+    while (low < high) {
+      const mid = (low + high) >>> 1;
+      if (this.points[mid] < point) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    // Past the last point wraps around to the first
+    return this.owners[low === this.points.length ? 0 : low];
+  }
+}
@@ -18,11 +18,16 @@
  *   MAX_FILE_SIZE  - Maximum file size in bytes (default: 100MB)
  *   TIMEOUT        - Extraction timeout in milliseconds (default: 30000)
  *   ENABLE_BIDI    - Enable bidirectional text support (default: true)
+ *   CLUSTER_WORKERS - Worker processes sharing the HTTP port (default: 0, single process)
+ *   SOCKET_PATH    - Unix domain socket served alongside either transport (optional)
  */
 
 import { buildFromConfig as buildFromConfigHTTP } from './servers/pdf-text-mcp-server-http';
 import { buildFromConfig as buildFromConfigStdio } from './servers/pdf-text-mcp-server-stdio';
 import { loadConfig } from './config';
+import { isClusterWorker, runClusterPrimary } from './cluster';
+import { removeStaleSocket } from './socket-transport';
+import { rmSync } from 'fs';
 
 /**
  * Main function - starts the MCP server
@@ -32,6 +37,23 @@ async function main() {
     // Load configuration from environment
     const config = loadConfig();
 
+    // In cluster mode the primary only supervises; workers run the server below
+    if (
+      config.transportMode === 'http' &&
+      config.clusterWorkers &&
+      config.clusterWorkers > 1 &&
+      !isClusterWorker()
+    ) {
+      // The primary holds the shared Unix socket, so it alone replaces and removes the file
+      if (config.socketPath) {
+        const socketPath = config.socketPath;
+        await removeStaleSocket(socketPath);
+        process.on('exit', () => rmSync(socketPath, { force: true }));
+      }
+      runClusterPrimary(config.clusterWorkers);
+      return;
+    }
+
     // Create and start the server
     const server =
       config.transportMode === 'http' ? buildFromConfigHTTP(config) : buildFromConfigStdio(config);
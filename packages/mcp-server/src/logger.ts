@@ -3,9 +3,14 @@
  *
  * Provides JSON-formatted logging with correlation IDs for request tracing.
  * Logs are written to stdout for collection by Promtail/Loki.
+ *
+ * Log calls only buffer the record. Records are formatted and written in one
+ * batch after the current turn of the event loop, so request handling does
+ * not pay for JSON formatting or stdout writes.
  */
 
 import winston from 'winston';
+import { writeSync } from 'fs';
 import { randomUUID } from 'crypto';
 
 /**
@@ -24,25 +29,175 @@ export interface LogContext {
   [key: string]: any;
 }
 
+type LogLevel = 'error' | 'warn' | 'info' | 'debug';
+
+/**
+ * A log call, kept unformatted until the batch is flushed
+ */
+interface PendingRecord {
+  level: LogLevel;
+  message: string;
+  context?: LogContext;
+  time: number;
+  sampleRate?: number;
+}
+
+// Records buffered before info and debug records are dropped (errors and warnings never are)
+const MAX_PENDING_RECORDS = 10000;
+
+// winston's key for the formatted line
+const MESSAGE = Symbol.for('message');
+
+/**
+ * Console transport that writes its lines to stdout in one write per batch
+ */
+class BatchConsoleTransport extends winston.Transport {
+  private lines: string[] = [];
+  private drainScheduled = false;
+
+  log(info: any, callback: () => void): void {
+    this.lines.push(info[MESSAGE]);
+    if (!this.drainScheduled) {
+      this.drainScheduled = true;
+      setImmediate(() => this.drain());
+    }
+    callback();
+  }
+
+  /**
+   * Write the pending lines; synchronously when the process is exiting
+   */
+  drain(sync: boolean = false): void {
+    this.drainScheduled = false;
+    if (this.lines.length === 0) {
+      return;
+    }
+    const output = this.lines.join('\n') + '\n';
+    this.lines = [];
+    if (sync) {
+      writeSync(1, output);
+    } else {
+      process.stdout.write(output);
+    }
+  }
+}
+
+const transport = new BatchConsoleTransport();
+
 /**
- * Winston logger configured for production use
+ * Winston logger configured for production use. It formats records when a
+ * batch is flushed, off the request path; the timestamp is the time of the call.
  */
 const logger = winston.createLogger({
   level: process.env.LOG_LEVEL || 'info',
-  format: winston.format.combine(
-    winston.format.timestamp(),
-    winston.format.errors({ stack: true }),
-    winston.format.json()
-  ),
+  format: winston.format.combine(winston.format.errors({ stack: true }), winston.format.json()),
   defaultMeta: {
     service: 'pdf-text-mcp-server',
   },
-  transports: [
-    // Write all logs to stdout (collected by Promtail)
-    new winston.transports.Console({
-      format: winston.format.combine(winston.format.timestamp(), winston.format.json()),
-    }),
-  ],
+  // Write all logs to stdout (collected by Promtail)
+  transports: [transport],
+});
+
+/**
+ * Fraction of records kept per level. High-volume info and debug records can be
+ * sampled with LOG_SAMPLE_RATE_INFO and LOG_SAMPLE_RATE_DEBUG; errors and
+ * warnings are always kept.
+ */
+const sampleRates: Record<LogLevel, number> = {
+  error: 1,
+  warn: 1,
+  info: parseSampleRate(process.env.LOG_SAMPLE_RATE_INFO),
+  debug: parseSampleRate(process.env.LOG_SAMPLE_RATE_DEBUG),
+};
+
+function parseSampleRate(value: string | undefined): number {
+  const rate = value ? Number(value) : 1;
+  return Number.isFinite(rate) ? Math.min(1, Math.max(0, rate)) : 1;
+}
+
+let pending: PendingRecord[] = [];
+let flushScheduled = false;
+let droppedRecords = 0;
+
+/**
+ * Keep or drop a record. Records of one request share a correlation ID and
+ * are kept or dropped together.
+ */
+function sampled(rate: number, context?: LogContext): boolean {
+  if (rate >= 1) {
+    return true;
+  }
+  const correlationId = context?.correlationId;
+  if (typeof correlationId !== 'string') {
+    return Math.random() < rate;
+  }
+  // FNV-1a with a murmur3 finalizer to mix similar IDs, mapped to [0, 1)
+  let hash = 0x811c9dc5;
+  for (let i = 0; i < correlationId.length; i++) {
+    hash = Math.imul(hash ^ correlationId.charCodeAt(i), 0x01000193);
+  }
+  hash = Math.imul(hash ^ (hash >>> 16), 0x85ebca6b);
+  hash = Math.imul(hash ^ (hash >>> 13), 0xc2b2ae35);
+  hash ^= hash >>> 16;
+  return (hash >>> 0) / 0x100000000 < rate;
+}
+
+function enqueue(level: LogLevel, message: string, context?: LogContext): void {
+  if (!logger.isLevelEnabled(level)) {
+    return;
+  }
+
+  const rate = sampleRates[level];
+  if (!sampled(rate, context)) {
+    return;
+  }
+
+  const important = level === 'error' || level === 'warn';
+  if (!important && pending.length >= MAX_PENDING_RECORDS) {
+    droppedRecords++;
+    return;
+  }
+
+  pending.push({
+    level,
+    message,
+    context,
+    time: Date.now(),
+    sampleRate: rate < 1 ? rate : undefined,
+  });
+  if (!flushScheduled) {
+    flushScheduled = true;
+    setImmediate(flush);
+  }
+}
+
+/**
+ * Format and write the buffered records now. Runs on its own after each turn
+ * of the event loop that logged something, and synchronously on exit.
+ */
+export function flush(): void {
+  flushScheduled = false;
+  const records = pending;
+  pending = [];
+
+  if (droppedRecords > 0) {
+    logger.warn('Log records dropped', { droppedRecords, timestamp: new Date().toISOString() });
+    droppedRecords = 0;
+  }
+  for (const { level, message, context, time, sampleRate } of records) {
+    logger.log({
+      ...context,
+      level,
+      message,
+      timestamp: new Date(time).toISOString(),
+      ...(sampleRate !== undefined ? { sampleRate } : {}),
+    });
+  }
+}
+
+process.on('exit', () => {
+  flush();
+  transport.drain(true);
 });
 
 /**
@@ -56,21 +211,21 @@ export function generateCorrelationId(): string {
  * Log an info message with optional context
  */
 export function info(message: string, context?: LogContext): void {
-  logger.info(message, context);
+  enqueue('info', message, context);
 }
 
 /**
  * Log a warning message with optional context
  */
 export function warn(message: string, context?: LogContext): void {
-  logger.warn(message, context);
+  enqueue('warn', message, context);
 }
 
 /**
  * Log an error message with optional context
  */
 export function error(message: string, error?: Error, context?: LogContext): void {
-  logger.error(message, {
+  enqueue('error', message, {
     ...context,
     error: error ? { message: error.message, stack: error.stack } : undefined,
   });
@@ -80,7 +235,7 @@ export function error(message: string, error?: Error, context?: LogContext): voi
  * Log a debug message with optional context
  */
 export function debug(message: string, context?: LogContext): void {
-  logger.debug(message, context);
+  enqueue('debug', message, context);
 }
 
 /**
@@ -111,4 +266,5 @@ export default {
   debug,
   generateCorrelationId,
   createChildLogger,
+  flush,
 };
@@ -4,7 +4,16 @@
  * Exposes metrics for monitoring server health, performance, and usage.
  */
 
-import { Registry, Counter, Histogram, Gauge, collectDefaultMetrics } from 'prom-client';
+import {
+  AggregatorRegistry,
+  Registry,
+  Counter,
+  Histogram,
+  Gauge,
+  collectDefaultMetrics,
+} from 'prom-client';
+import type { ConcurrencyStats, PdfWarmupResult, ReadCacheStats } from '@pdf-text-mcp/pdf-parser';
+import { isClusterWorker, requestClusterMetrics } from './cluster';
 
 /**
  * Prometheus registry for all metrics
@@ -14,6 +23,9 @@ export const register = new Registry();
 // Collect default metrics (CPU, memory, event loop lag, etc.)
 collectDefaultMetrics({ register, prefix: 'nodejs_' });
 
+// In cluster mode, this is the registry each worker reports to the primary
+AggregatorRegistry.setRegistries([register]);
+
 /**
  * HTTP request metrics
  */
@@ -87,6 +99,112 @@ export const errorsTotal = new Counter({
   registers: [register],
 });
 
+/**
+ * Adaptive concurrency metrics, read from the extractor on collection
+ */
+let concurrencySource: (() => ConcurrencyStats | undefined) | undefined;
+
+export const extractionConcurrencyLimit = new Gauge({
+  name: 'extraction_concurrency_limit',
+  help: 'Current adaptive limit on concurrent text extractions',
+  registers: [register],
+  collect() {
+    const stats = concurrencySource?.();
+    if (stats) {
+      this.set(stats.limit);
+    }
+  },
+});
+
+export const extractionsInFlight = new Gauge({
+  name: 'extractions_in_flight',
+  help: 'Text extractions running under the concurrency limit',
+  registers: [register],
+  collect() {
+    const stats = concurrencySource?.();
+    if (stats) {
+      this.set(stats.inFlight);
+    }
+  },
+});
+
+export const extractionsQueued = new Gauge({
+  name: 'extractions_queued',
+  help: 'Text extractions waiting for a slot under the concurrency limit',
+  registers: [register],
+  collect() {
+    const stats = concurrencySource?.();
+    if (stats) {
+      this.set(stats.queued);
+    }
+  },
+});
+
+/**
+ * Report the extractor's concurrency limiter through the gauges above
+ */
+export function trackConcurrency(source: () => ConcurrencyStats | undefined): void {
+  concurrencySource = source;
+}
+
+/**
+ * Prefetching file reader metrics, read from the native counters on collection
+ */
+let readCacheSource: (() => ReadCacheStats | undefined) | undefined;
+
+export const readCacheBlocks = new Gauge({
+  name: 'read_cache_blocks',
+  help: 'Blocks read through the prefetching file reader since start, by outcome',
+  labelNames: ['outcome'],
+  registers: [register],
+  collect() {
+    const stats = readCacheSource?.();
+    if (stats) {
+      this.set({ outcome: 'hit' }, stats.hits);
+      this.set({ outcome: 'wait' }, stats.waits);
+      this.set({ outcome: 'miss' }, stats.misses);
+      this.set({ outcome: 'prefetch' }, stats.prefetches);
+    }
+  },
+});
+
+/**
+ * Report the extractor's prefetching file reader counters through the gauge above
+ */
+export function trackReadCache(source: () => ReadCacheStats | undefined): void {
+  readCacheSource = source;
+}
+
+/**
+ * Cold-start metrics, set once before the server reports ready
+ */
+export const coldStartDuration = new Gauge({
+  name: 'cold_start_duration_seconds',
+  help: 'Time spent on one-time initialization before the first request, by phase',
+  labelNames: ['phase'],
+  registers: [register],
+});
+
+/**
+ * Record the timings of the addon warm-up
+ */
+export function recordColdStart(result: PdfWarmupResult): void {
+  coldStartDuration.set({ phase: 'addon_load' }, result.addonLoadTime / 1000);
+  coldStartDuration.set({ phase: 'extraction' }, result.extractionTime / 1000);
+  coldStartDuration.set({ phase: 'bidi' }, result.bidiTime / 1000);
+  coldStartDuration.set({ phase: 'warmup' }, result.totalTime / 1000);
+}
+
+/**
+ * Cache-affinity routing metrics
+ */
+export const peerForwardsTotal = new Counter({
+  name: 'peer_forwards_total',
+  help: 'Tool calls owned by another replica, by outcome',
+  labelNames: ['outcome'],
+  registers: [register],
+});
+
 /**
  * System metrics
  */
@@ -95,6 +213,10 @@ export const memoryUsage = new Gauge({
   help: 'Memory usage in bytes',
   labelNames: ['type'],
   registers: [register],
+  // Refresh system metrics on every collection, including cluster aggregation
+  collect() {
+    updateSystemMetrics();
+  },
 });
 
 export const cpuUsage = new Gauge({
@@ -175,10 +297,22 @@ export function recordError(errorType: string, toolName?: string): void {
   errorsTotal.inc({ error_type: errorType, tool_name: toolName || 'unknown' });
 }
 
+/**
+ * Record a tool call routed to its owning replica ('forwarded'), or served
+ * here because the owner was unreachable ('fallback')
+ */
+export function recordPeerForward(outcome: 'forwarded' | 'fallback'): void {
+  peerForwardsTotal.inc({ outcome });
+}
+
 /**
  * Get metrics in Prometheus format
  */
 export async function getMetrics(): Promise<string> {
+  if (isClusterWorker()) {
+    // Any worker answers for the whole cluster
+    return requestClusterMetrics();
+  }
   updateSystemMetrics();
   return register.metrics();
 }
@@ -0,0 +1,200 @@
+/**
+ * Cache-affinity routing between HTTP replicas
+ *
+ * Replicas share a consistent-hash ring of their URLs. A tool call is keyed
+ * by the hash of its fileContent, and a replica receiving a call owned by
+ * another replica forwards it there, once, so repeat requests for a document
+ * reach the replica whose caches already hold it.
+ *
+ * Membership comes from a static PEER_URLS list and/or a DNS name whose
+ * addresses are the replicas (a headless Kubernetes Service). Peers are
+ * probed on /health; unreachable peers leave the ring until they answer again.
+ *
+ * Replicas found through DNS are known by http://<address>:<port>, so with
+ * peerDns a replica's own identity on the ring is its address in the DNS
+ * answers too: a SELF_URL host name is resolved and matched against them.
+ * Every replica then hashes the same member names.
+ */
+
+import { promises as dns } from 'dns';
+import { isIP } from 'net';
+import { createHash } from 'crypto';
+import { HashRing } from './hash-ring';
+
+/** Marks a forwarded request, which the receiving replica always serves itself */
+export const FORWARDED_HEADER = 'x-pdf-text-mcp-forwarded';
+
+const DEFAULT_PROBE_INTERVAL_MS = 5000;
+const PROBE_TIMEOUT_MS = 1000;
+
+export interface PeerRouterOptions {
+  /** URL other replicas reach this replica at, e.g. http://10.0.0.5:3000 */
+  selfUrl: string;
+  /** Static replica URLs (this replica's own URL may be included) */
+  peerUrls?: string[];
+  /** Host name resolving to all replica addresses (headless Service) */
+  peerDns?: string;
+  /** Port of the replicas found through peerDns */
+  peerPort?: number;
+  /** Milliseconds between membership refreshes */
+  probeIntervalMs?: number;
+  /** Milliseconds to wait for a forwarded request */
+  forwardTimeoutMs?: number;
+}
+
+function normalizeUrl(url: string): string {
+  return url.trim().replace(/\/+$/, '');
+}
+
+export class PeerRouter {
+  private selfUrl: string;
+  private readonly staticPeers: string[];
+  private ring: HashRing;
+  private timer?: NodeJS.Timeout;
+
+  constructor(private readonly options: PeerRouterOptions) {
+    this.selfUrl = normalizeUrl(options.selfUrl);
+    this.staticPeers = (options.peerUrls ?? [])
+      .map(normalizeUrl)
+      .filter((url) => url.length > 0 && url !== this.selfUrl);
+    // Until the first probe, assume every static peer is up
+    this.ring = new HashRing([this.selfUrl, ...this.staticPeers]);
+  }
+
+  /**
+   * Discover and probe peers now, then periodically
+   */
+  async start(): Promise<void> {
+    await this.refresh();
+    this.timer = setInterval(
+      () => void this.refresh(),
+      this.options.probeIntervalMs ?? DEFAULT_PROBE_INTERVAL_MS
+    );
+    this.timer.unref();
+  }
+
+  stop(): void {
+    clearInterval(this.timer);
+    this.timer = undefined;
+  }
+
+  /** Replicas currently on the ring, this one included */
+  get members(): string[] {
+    return this.ring.nodes;
+  }
+
+  /**
+   * Routing key of an MCP request body: the hash of a tool call's fileContent.
+   * Other requests (initialize, tools/list, batches) have none and stay local.
+   */
+  static routingKey(body: unknown): string | undefined {
+    if (typeof body !== 'object' || body === null || Array.isArray(body)) {
+      return undefined;
+    }
+    const { method, params } = body as { method?: unknown; params?: any };
+    const fileContent = params?.arguments?.fileContent;
+    if (method !== 'tools/call' || typeof fileContent !== 'string') {
+      return undefined;
+    }
+    return createHash('sha256').update(fileContent).digest('hex');
+  }
+
+  /**
+   * URL of the replica owning a key, or undefined when this replica owns it
+   */
+  ownerOf(key: string): string | undefined {
+    const owner = this.ring.owner(key);
+    return owner === this.selfUrl ? undefined : owner;
+  }
+
+  /**
+   * Forward an MCP request body to its owner. Resolves to undefined when the
+   * owner cannot be reached, in which case the caller serves the request and
+   * the owner leaves the ring until it answers a probe.
+   */
+  async forward(
+    ownerUrl: string,
+    body: unknown,
+    headers: Record<string, string>
+  ): Promise<Response | undefined> {
+    try {
+      return await fetch(`${ownerUrl}/mcp`, {
+        method: 'POST',
+        headers: { ...headers, 'content-type': 'application/json', [FORWARDED_HEADER]: '1' },
+        body: JSON.stringify(body),
+        signal: this.options.forwardTimeoutMs
+          ? AbortSignal.timeout(this.options.forwardTimeoutMs)
+          : undefined,
+      });
+    } catch {
+      this.setMembers(this.members.filter((member) => member !== ownerUrl));
+      return undefined;
+    }
+  }
+
+  private async refresh(): Promise<void> {
+    const candidates = new Set(this.staticPeers);
+    if (this.options.peerDns) {
+      try {
+        const addresses = await dns.lookup(this.options.peerDns, { all: true });
+        const port = this.options.peerPort ?? 3000;
+        const dnsPeers = addresses.map(({ address }) => addressUrl(address, port));
+        dnsPeers.forEach((peer) => candidates.add(peer));
+        this.selfUrl = await this.resolveSelf(new Set(dnsPeers));
+      } catch {
+        // Keep the static peers; DNS is retried on the next refresh
+      }
+    }
+    candidates.delete(this.selfUrl);
+
+    const reachable = await Promise.all(
+      Array.from(candidates).map(async (peer) => ((await probe(peer)) ? peer : undefined))
+    );
+    this.setMembers([
+      this.selfUrl,
+      ...reachable.filter((peer): peer is string => peer !== undefined),
+    ]);
+  }
+
+  /**
+   * This replica's identity among DNS-discovered peers: the URL of the address
+   * its SELF_URL host resolves to that appears in the DNS answers. SELF_URL
+   * itself when it already names an address or none of its addresses appear.
+   */
+  private async resolveSelf(dnsPeers: Set<string>): Promise<string> {
+    const configured = normalizeUrl(this.options.selfUrl);
+    const url = new URL(configured);
+    const hostname = url.hostname.replace(/^\[|\]$/g, '');
+    if (isIP(hostname)) {
+      return configured;
+    }
+    const port = Number(url.port || this.options.peerPort || 3000);
+    const addresses = await dns.lookup(hostname, { all: true }).catch(() => []);
+    const match = addresses
+      .map(({ address }) => addressUrl(address, port))
+      .find((candidate) => dnsPeers.has(candidate));
+    return match ?? configured;
+  }
+
+  private setMembers(members: string[]): void {
+    const sorted = Array.from(new Set(members)).sort();
+    if (sorted.join('\n') !== this.ring.nodes.join('\n')) {
+      this.ring = new HashRing(sorted);
+    }
+  }
+}
+
+function addressUrl(address: string, port: number): string {
+  return `http://${isIP(address) === 6 ? `[${address}]` : address}:${port}`;
+}
+
+async function probe(peerUrl: string): Promise<boolean> {
+  try {
+    const response = await fetch(`${peerUrl}/health`, {
+      signal: AbortSignal.timeout(PROBE_TIMEOUT_MS),
+    });
+    return response.ok;
+  } catch {
+    return false;
+  }
+}
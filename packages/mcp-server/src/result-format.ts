@@ -0,0 +1,147 @@
+/**
+ * Binary encoding of text extraction results
+ *
+ * A compact alternative to JSON for machine-to-machine callers, served by the
+ * Unix socket and the HTTP /extract endpoint when asked for. Fields sit at
+ * fixed offsets and the text is raw UTF-8, so a reader takes views over the
+ * received bytes instead of parsing them. All integers are little-endian, the
+ * byte order of the hosts that read them, so the page offsets can be viewed
+ * as a Uint32Array (or numpy/memoryview cast) without conversion.
+ *
+ * Layout (40-byte header, then three sections back to back):
+ *   0  char[4] magic          "PTXR"
+ *   4  u16     version        1
+ *   6  u16     flags          bit 0: text is right-to-left
+ *   8  u32     pageCount
+ *  12  u32     offsetCount    page offsets that follow: pageCount, or 0 when unknown
+ *  16  f64     processingTime milliseconds
+ *  24  f64     fileSize       bytes
+ *  32  u32     fieldsLength   bytes of the fields section
+ *  36  u32     textLength     bytes of the text section
+ *  40  u32[offsetCount]       byte offset of each page in the text section
+ *      fields                 UTF-8 JSON of any other result fields, or empty
+ *      text                   UTF-8 text
+ */
+
+import { endianness } from 'os';
+
+export const RESULT_FORMAT_MEDIA_TYPE = 'application/vnd.pdf-text-mcp.result';
+
+const MAGIC = Buffer.from('PTXR', 'latin1');
+const VERSION = 1;
+const FLAG_RTL = 1;
+const HEADER_SIZE = 40;
+
+/**
+ * Text extraction result as encoded. Whatever else the result carries (e.g.
+ * reusedPageCount, nearDuplicateOf) goes to the fields section.
+ */
+export interface EncodableTextResult {
+  text: string;
+  pageCount: number;
+  processingTime: number;
+  fileSize: number;
+  textDirection: 'ltr' | 'rtl';
+  pageOffsets?: number[];
+}
+
+/**
+ * Views over a binary result; text and page offsets share memory with the input
+ */
+export interface TextResultView {
+  pageCount: number;
+  processingTime: number;
+  fileSize: number;
+  textDirection: 'ltr' | 'rtl';
+  /** Byte offset of each page in text, empty when the result has none */
+  pageOffsets: Uint32Array;
+  /** Other result fields */
+  fields: Record<string, unknown>;
+  /** UTF-8 text */
+  text: Buffer;
+}
+
+/**
+ * Encode a text result. Returned as separate buffers so the text is written
+ * without another copy.
+ */
+export function encodeTextResult(result: EncodableTextResult): Buffer[] {
+  const { text, pageCount, processingTime, fileSize, textDirection, pageOffsets, ...rest } =
+    result as EncodableTextResult & Record<string, unknown>;
+  // The signature is for near-duplicate detection, not for callers
+  delete rest.minhash;
+
+  const offsets = pageOffsets ?? [];
+  const fields =
+    Object.keys(rest).length > 0 ? Buffer.from(JSON.stringify(rest), 'utf8') : Buffer.alloc(0);
+  const textBytes = Buffer.from(text, 'utf8');
+
+  const header = Buffer.alloc(HEADER_SIZE + offsets.length * 4);
+  MAGIC.copy(header, 0);
+  header.writeUInt16LE(VERSION, 4);
+  header.writeUInt16LE(textDirection === 'rtl' ? FLAG_RTL : 0, 6);
+  header.writeUInt32LE(pageCount, 8);
+  header.writeUInt32LE(offsets.length, 12);
+  header.writeDoubleLE(processingTime, 16);
+  header.writeDoubleLE(fileSize, 24);
+  header.writeUInt32LE(fields.length, 32);
+  header.writeUInt32LE(textBytes.length, 36);
+  offsets.forEach((offset, i) => header.writeUInt32LE(offset, HEADER_SIZE + i * 4));
+
+  return [header, fields, textBytes];
+}
+
+/**
+ * Read a binary result without copying its text
+ * @throws Error if data is not a complete result of a known version
+ */
+export function decodeTextResult(data: Buffer): TextResultView {
+  if (data.length < HEADER_SIZE || !data.subarray(0, 4).equals(MAGIC)) {
+    throw new Error('Not a binary text result');
+  }
+  const version = data.readUInt16LE(4);
+  if (version !== VERSION) {
+    throw new Error(`Unsupported binary result version: ${version}`);
+  }
+
+  const offsetCount = data.readUInt32LE(12);
+  const fieldsLength = data.readUInt32LE(32);
+  const textLength = data.readUInt32LE(36);
+  const fieldsStart = HEADER_SIZE + offsetCount * 4;
+  const textStart = fieldsStart + fieldsLength;
+  if (data.length < textStart + textLength) {
+    throw new Error(`Binary result truncated: ${data.length} of ${textStart + textLength} bytes`);
+  }
+
+  return {
+    pageCount: data.readUInt32LE(8),
+    processingTime: data.readDoubleLE(16),
+    fileSize: data.readDoubleLE(24),
+    textDirection: data.readUInt16LE(6) & FLAG_RTL ? 'rtl' : 'ltr',
+    pageOffsets: viewUint32LE(data, HEADER_SIZE, offsetCount),
+    fields: fieldsLength > 0 ? JSON.parse(data.toString('utf8', fieldsStart, textStart)) : {},
+    text: data.subarray(textStart, textStart + textLength),
+  };
+}
+
+/**
+ * UTF-8 text of one page of a decoded result, as a view
+ */
+export function pageText(view: TextResultView, page: number): Buffer {
+  const start = view.pageOffsets[page];
+  const end = page + 1 < view.pageOffsets.length ? view.pageOffsets[page + 1] : view.text.length;
+  return view.text.subarray(start, end);
+}
+
+function viewUint32LE(data: Buffer, start: number, count: number): Uint32Array {
+  const byteOffset = data.byteOffset + start;
+  if (endianness() === 'LE' && byteOffset % 4 === 0) {
+    return new Uint32Array(data.buffer, byteOffset, count);
+  }
+  // Unaligned (or big-endian host): copy
+  const values = new Uint32Array(count);
+  for (let i = 0; i < count; i++) {
+    values[i] = data.readUInt32LE(start + i * 4);
+  }
+  return values;
+}
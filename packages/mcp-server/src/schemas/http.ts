@@ -1,8 +1,11 @@
 import { z } from 'zod';
+import { CONTENT_ENCODINGS } from '../decompress';
 
 // http transport schemas - extracting from pdf file content
 
 const fileContentDescription = 'Base64-encoded PDF content to extract from';
+const contentEncodingDescription =
+  'Compression of the PDF before base64 encoding: "gzip", "zstd" or "identity" (default, uncompressed)';
 
 /**
  * Tool schema for file content parameter
@@ -14,17 +17,59 @@ export const FileContentToolSchema = {
       type: 'string',
       description: fileContentDescription,
     },
+    contentEncoding: {
+      type: 'string',
+      enum: [...CONTENT_ENCODINGS],
+      description: contentEncodingDescription,
+    },
   },
   required: ['fileContent'],
 };
 
 /**
- * Zod schema and type for extract_text and extract_metadata tool parameters
+ * Zod schema and type for extract_metadata, get_outline and other whole-document tool parameters
  */
 export const FileContentParamsSchema = {
   /** Base64-encoded PDF content to extract from */
   fileContent: z.string().describe(fileContentDescription),
+  /** Compression of the PDF inside fileContent */
+  contentEncoding: z.enum(CONTENT_ENCODINGS).optional().describe(contentEncodingDescription),
 };
 
 const FileContentParamsSchemaObject = z.object(FileContentParamsSchema);
 export type FileContentParamsType = z.infer<typeof FileContentParamsSchemaObject>;
+
+const startPageDescription =
+  'First page to extract: a 1-based page number, or a page label as printed on the page (e.g. "iv", "12", "A-1"). Defaults to the first page';
+const endPageDescription =
+  'Last page to extract: a 1-based page number or a page label. Defaults to the last page';
+const pageSchema = z.union([z.number().int().positive(), z.string().min(1)]);
+
+/**
+ * Zod schema and type for extract_text tool parameters
+ */
+export const FileContentTextParamsSchema = {
+  ...FileContentParamsSchema,
+  /** First page to extract, by number or label */
+  startPage: pageSchema.optional().describe(startPageDescription),
+  /** Last page to extract, by number or label */
+  endPage: pageSchema.optional().describe(endPageDescription),
+};
+
+const FileContentTextParamsSchemaObject = z.object(FileContentTextParamsSchema);
+export type FileContentTextParamsType = z.infer<typeof FileContentTextParamsSchemaObject>;
+
+const sectionDescription =
+  'Outline (bookmark) title of the section to extract, e.g. "Section 4" or "Termination"';
+
+/**
+ * Zod schema and type for extract_section tool parameters
+ */
+export const FileContentSectionParamsSchema = {
+  ...FileContentParamsSchema,
+  /** Outline title of the section to extract */
+  section: z.string().min(1).describe(sectionDescription),
+};
+
+const FileContentSectionParamsSchemaObject = z.object(FileContentSectionParamsSchema);
+export type FileContentSectionParamsType = z.infer<typeof FileContentSectionParamsSchemaObject>;
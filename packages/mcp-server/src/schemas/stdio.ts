@@ -19,7 +19,7 @@ export const FilePathToolSchema = {
 };
 
 /**
- * Zod schema and type for extract_text and extract_metadata tool parameters
+ * Zod schema and type for extract_metadata, get_outline and other whole-document tool parameters
  */
 
 export const FilePathParamsSchema = {
@@ -29,3 +29,38 @@ export const FilePathParamsSchema = {
 
 const FilePathParamsSchemaObject = z.object(FilePathParamsSchema);
 export type FilePathParamsType = z.infer<typeof FilePathParamsSchemaObject>;
+
+const startPageDescription =
+  'First page to extract: a 1-based page number, or a page label as printed on the page (e.g. "iv", "12", "A-1"). Defaults to the first page';
+const endPageDescription =
+  'Last page to extract: a 1-based page number or a page label. Defaults to the last page';
+const pageSchema = z.union([z.number().int().positive(), z.string().min(1)]);
+
+/**
+ * Zod schema and type for extract_text tool parameters
+ */
+export const FilePathTextParamsSchema = {
+  ...FilePathParamsSchema,
+  /** First page to extract, by number or label */
+  startPage: pageSchema.optional().describe(startPageDescription),
+  /** Last page to extract, by number or label */
+  endPage: pageSchema.optional().describe(endPageDescription),
+};
+
+const FilePathTextParamsSchemaObject = z.object(FilePathTextParamsSchema);
+export type FilePathTextParamsType = z.infer<typeof FilePathTextParamsSchemaObject>;
+
+const sectionDescription =
+  'Outline (bookmark) title of the section to extract, e.g. "Section 4" or "Termination"';
+
+/**
+ * Zod schema and type for extract_section tool parameters
+ */
+export const FilePathSectionParamsSchema = {
+  ...FilePathParamsSchema,
+  /** Outline title of the section to extract */
+  section: z.string().min(1).describe(sectionDescription),
+};
+
+const FilePathSectionParamsSchemaObject = z.object(FilePathSectionParamsSchema);
+export type FilePathSectionParamsType = z.infer<typeof FilePathSectionParamsSchemaObject>;
@@ -7,14 +7,29 @@
  */
 
 import { McpServer } from '@modelcontextprotocol/sdk/server/mcp.js';
-import { PdfExtractor } from '@pdf-text-mcp/pdf-parser';
-import { ServerConfig } from '../types';
+import {
+  DEFAULT_MAX_FILE_SIZE,
+  LshIndex,
+  PdfExtractionResult,
+  PdfExtractor,
+  PdfPageRange,
+} from '@pdf-text-mcp/pdf-parser';
+import { ExtractTextToolResult, ServerConfig } from '../types';
 import { PDFTextMcpServer } from './pdf-text-mcp-server';
+import { SocketTransport } from '../socket-transport';
+import * as metrics from '../metrics';
+
+// MinHash signature shape used for near-duplicate detection. 16 bands of 8 rows
+// make documents above ~0.8 similarity almost certain to share a band.
+const NEAR_DUPLICATE_BANDS = 16;
+const NEAR_DUPLICATE_ROWS_PER_BAND = 8;
 
 export abstract class BasePdfTextMcpServer implements PDFTextMcpServer {
   protected server: McpServer;
   protected extractor: PdfExtractor;
   protected config: ServerConfig;
+  protected nearDuplicateIndex?: LshIndex;
+  protected socketTransport?: SocketTransport;
 
   constructor(config: ServerConfig) {
     this.config = config;
@@ -34,13 +49,47 @@ export abstract class BasePdfTextMcpServer implements PDFTextMcpServer {
       }
     );
 
+    if (config.nearDuplicateThreshold && config.nearDuplicateThreshold > 0) {
+      this.nearDuplicateIndex = new LshIndex({
+        bands: NEAR_DUPLICATE_BANDS,
+        rowsPerBand: NEAR_DUPLICATE_ROWS_PER_BAND,
+        maxEntries: config.nearDuplicateIndexSize,
+      });
+    }
+
     // Initialize the PDF extractor with our configuration
     // Note: Bidi is always enabled at the native library level (requires ICU)
     this.extractor = new PdfExtractor({
       maxFileSize: config.maxFileSize,
       timeout: config.timeout,
+      pageWorkers: config.pageWorkers,
+      revisionCacheSize: config.revisionCacheSize,
+      fileCacheSize: config.fileCacheSize,
+      placementCacheSize: config.placementCacheSize,
+      placementCacheBytes: config.placementCacheBytes,
+      maxConcurrency: config.maxConcurrency,
+      prefetchReads: config.prefetchReads,
+      lazyMetadata: config.lazyMetadata,
+      minhashPermutations: this.nearDuplicateIndex
+        ? NEAR_DUPLICATE_BANDS * NEAR_DUPLICATE_ROWS_PER_BAND
+        : 0,
     });
 
+    if (config.maxConcurrency && config.maxConcurrency > 0) {
+      metrics.trackConcurrency(() => this.extractor.concurrency);
+    }
+    if (config.prefetchReads) {
+      metrics.trackReadCache(() => this.extractor.readCache);
+    }
+
+    // Same-host callers share the extractor (and its caches) over a Unix socket
+    if (config.socketPath) {
+      this.socketTransport = new SocketTransport(this.extractor, {
+        socketPath: config.socketPath,
+        maxFileSize: config.maxFileSize ?? DEFAULT_MAX_FILE_SIZE,
+      });
+    }
+
     // Let subclass register its specific tools
     this.setupTools();
   }
@@ -64,6 +113,61 @@ export abstract class BasePdfTextMcpServer implements PDFTextMcpServer {
    */
   abstract stop(): Promise<void>;
 
+  /**
+   * Page range of extract_text arguments, or undefined for the whole document.
+   * Pages may be given by number or by page label.
+   */
+  protected toPageRange(args: {
+    startPage?: number | string;
+    endPage?: number | string;
+  }): PdfPageRange | undefined {
+    if (args.startPage === undefined && args.endPage === undefined) {
+      return undefined;
+    }
+    return { startPage: args.startPage ?? 1, endPage: args.endPage };
+  }
+
+  /**
+   * Flag an extraction result as a near-duplicate of an earlier document and
+   * remember it for later ones. The raw signature is not returned to clients.
+   * documentId is only evaluated when near-duplicate detection is enabled.
+   * Results of a page range are neither flagged nor remembered. Page offsets,
+   * which only binary results use, are not returned either.
+   */
+  protected flagNearDuplicate(
+    extraction: PdfExtractionResult,
+    documentId: () => string,
+    pageRange?: PdfPageRange
+  ): ExtractTextToolResult {
+    const result = { ...extraction };
+    delete result.pageOffsets;
+    if (!this.nearDuplicateIndex || !result.minhash) {
+      return result;
+    }
+
+    const { minhash, ...toolResult } = result;
+    if (pageRange || minhash.length === 0) {
+      // A signature of some pages is not comparable with whole documents, and
+      // text without words (scanned, image-only) has nothing to compare
+      return toolResult;
+    }
+    const id = documentId();
+    const threshold = this.config.nearDuplicateThreshold as number;
+    const match = this.nearDuplicateIndex
+      .query(minhash, threshold)
+      .find((candidate) => candidate.id !== id);
+    this.nearDuplicateIndex.add(id, minhash);
+
+    if (!match) {
+      return toolResult;
+    }
+    return {
+      ...toolResult,
+      nearDuplicateOf: match.id,
+      nearDuplicateSimilarity: Math.round(match.similarity * 1000) / 1000,
+    };
+  }
+
   /**
    * Log server configuration to stderr.
    * Helper method for consistent logging across implementations.
@@ -4,24 +4,79 @@
 import { ToolCallback } from '@modelcontextprotocol/sdk/server/mcp.js';
 import { StreamableHTTPServerTransport } from '@modelcontextprotocol/sdk/server/streamableHttp.js';
 import { ErrorCode, McpError } from '@modelcontextprotocol/sdk/types.js';
+import {
+  DEFAULT_MAX_FILE_SIZE,
+  PdfErrorCode,
+  PdfExtractionError,
+  warmup,
+} from '@pdf-text-mcp/pdf-parser';
 import { ServerConfig } from '../types';
-import { FileContentParamsSchema, FileContentParamsType } from '../schemas/http';
+import {
+  FileContentParamsSchema,
+  FileContentParamsType,
+  FileContentSectionParamsSchema,
+  FileContentTextParamsSchema,
+} from '../schemas/http';
 import { PDFTextMcpServer } from './pdf-text-mcp-server';
 import { BasePdfTextMcpServer } from './base-pdf-text-mcp-server';
+import { SharedResultCache } from '../shared-cache';
+import { FORWARDED_HEADER, PeerRouter } from '../peer-router';
+import {
+  CONTENT_ENCODINGS,
+  ContentEncoding,
+  decompressUpload,
+  DecompressedSizeError,
+} from '../decompress';
+import { encodeTextResult, RESULT_FORMAT_MEDIA_TYPE } from '../result-format';
 import * as logger from '../logger';
 import * as metrics from '../metrics';
 
 import express from 'express';
 import { createServer } from 'http';
+import { createHash } from 'crypto';
+
+/**
+ * Identify uploaded content by hash (HTTP requests carry no file name)
+ */
+function contentId(content: Buffer): string {
+  return `sha256:${createHash('sha256').update(content).digest('hex').slice(0, 16)}`;
+}
+
+/**
+ * Page number or label of a /extract query parameter
+ */
+function queryPage(value: unknown): number | string | undefined {
+  if (typeof value !== 'string' || value === '') {
+    return undefined;
+  }
+  return /^\d+$/.test(value) ? Number(value) : value;
+}
 
 export class PdfTextMcpServerHttp extends BasePdfTextMcpServer {
   private requestCount: number = 0;
   private errorCount: number = 0;
   private httpServer?: any;
   private ready: boolean = false;
+  private sharedCache?: SharedResultCache;
+  private peerRouter?: PeerRouter;
 
   constructor(config: ServerConfig) {
     super(config);
+
+    if (config.sharedCacheDir) {
+      this.sharedCache = new SharedResultCache(config.sharedCacheDir, config.sharedCacheSize ?? 0);
+    }
+
+    if (config.selfUrl) {
+      this.peerRouter = new PeerRouter({
+        selfUrl: config.selfUrl,
+        peerUrls: config.peerUrls,
+        peerDns: config.peerDns,
+        peerPort: config.port || 3000,
+        // The owner may be extracting; leave it the extraction timeout and some
+        forwardTimeoutMs: (config.timeout || 30000) + 5000,
+      });
+    }
   }
 
   protected setupTools(): void {
@@ -29,47 +84,139 @@ export class PdfTextMcpServerHttp extends BasePdfTextMcpServer {
       'extract_text',
       {
         description:
-          'Extract text content from a PDF base64-encoded content. Bidirectional text (Hebrew, Arabic, etc.) is always supported. Returns the extracted text, page count, and processing metadata. Provide fileContent (base64-encoded PDF)',
+          'Extract text content from a PDF base64-encoded content. Bidirectional text (Hebrew, Arabic, etc.) is always supported. Returns the extracted text, page count, and processing metadata. Provide fileContent (base64-encoded PDF), and optionally startPage/endPage as page numbers or printed page labels (e.g. "iv", "A-1") to extract only those pages',
+        inputSchema: FileContentTextParamsSchema,
+      },
+      (args, extra) => {
+        const pageRange = this.toPageRange(args);
+        return this.createFileContentOperationHandler('extract_text', async (fileContent: Buffer) =>
+          this.flagNearDuplicate(
+            await this.cached('extract_text', fileContent, pageRange, () =>
+              this.extractor.extractTextFromBuffer(fileContent, pageRange)
+            ),
+            () => contentId(fileContent),
+            pageRange
+          )
+        )(args, extra);
+      }
+    );
+
+    this.server.registerTool(
+      'extract_metadata',
+      {
+        description:
+          'Extract metadata from a PDF base64-encoded content including title, author, subject, creator, producer, dates, page count, version, and printed page labels when the document defines them. Provide fileContent (base64-encoded PDF)',
         inputSchema: FileContentParamsSchema,
       },
-      this.createFileContentOperationHandler((fileContent: Buffer) =>
-        this.extractor.extractTextFromBuffer(fileContent)
+      this.createFileContentOperationHandler('extract_metadata', (fileContent: Buffer) =>
+        this.cached('extract_metadata', fileContent, undefined, () =>
+          this.extractor.getMetadataFromBuffer(fileContent)
+        )
       )
     );
 
     this.server.registerTool(
-      'extract_metadata',
+      'get_outline',
       {
         description:
-          'Extract metadata from a PDF base64-encoded content including title, author, subject, creator, producer, dates, page count, and version. Provide fileContent (base64-encoded PDF)',
+          'Get the outline (bookmarks) of a PDF from base64-encoded content without extracting text. Returns each entry with its title, nesting level, and first and last page. Provide fileContent (base64-encoded PDF)',
         inputSchema: FileContentParamsSchema,
       },
-      this.createFileContentOperationHandler((fileContent: Buffer) =>
-        this.extractor.getMetadataFromBuffer(fileContent)
+      this.createFileContentOperationHandler('get_outline', (fileContent: Buffer) =>
+        this.cached('get_outline', fileContent, undefined, () =>
+          this.extractor.getOutlineFromBuffer(fileContent)
+        )
       )
     );
+
+    this.server.registerTool(
+      'extract_section',
+      {
+        description:
+          'Extract the text of one outline section of a PDF from base64-encoded content, reading only that section\'s pages. The section is matched by title (exact, then prefix, then substring, ignoring case). Use get_outline to list sections. Provide fileContent (base64-encoded PDF) and section',
+        inputSchema: FileContentSectionParamsSchema,
+      },
+      (args, extra) =>
+        this.createFileContentOperationHandler('extract_section', (fileContent: Buffer) =>
+          this.cached('extract_section', fileContent, args.section, () =>
+            this.extractor.extractSectionFromBuffer(fileContent, args.section)
+          )
+        )(args, extra)
+    );
+  }
+
+  /**
+   * Run an extractor call through the shared result cache, when one is configured.
+   * Cluster workers on the same host share the cache directory. A result's
+   * processingTime is that of this call, not of the call that cached it.
+   */
+  private async cached<T>(
+    toolName: string,
+    fileContent: Buffer,
+    variant: unknown,
+    operation: () => Promise<T>
+  ): Promise<T> {
+    if (!this.sharedCache) {
+      return operation();
+    }
+    const startTime = Date.now();
+    const key = SharedResultCache.key(toolName, fileContent, variant);
+    const result = await this.sharedCache.getOrCompute(key, operation);
+    if (result && typeof result === 'object' && 'processingTime' in result) {
+      return { ...result, processingTime: Date.now() - startTime };
+    }
+    return result;
+  }
+
+  /**
+   * Decompress an uploaded PDF, up to the maximum file size
+   */
+  private async decompress(
+    uploaded: Buffer,
+    contentEncoding: ContentEncoding
+  ): Promise<Buffer> {
+    try {
+      return await decompressUpload(
+        uploaded,
+        contentEncoding,
+        this.config.maxFileSize ?? DEFAULT_MAX_FILE_SIZE
+      );
+    } catch (error) {
+      const message = error instanceof Error ? error.message : String(error);
+      throw new McpError(
+        ErrorCode.InvalidRequest,
+        error instanceof DecompressedSizeError
+          ? message
+          : `Cannot decompress ${contentEncoding} fileContent: ${message}`
+      );
+    }
   }
 
   private createFileContentOperationHandler<T>(
+    toolName: string,
     operation: (fileContent: Buffer) => Promise<T>
   ): ToolCallback<typeof FileContentParamsSchema> {
     return async (args: FileContentParamsType) => {
       const correlationId = logger.generateCorrelationId();
       const startTime = Date.now();
-      const toolName = operation.name.includes('Metadata') ? 'extract_metadata' : 'extract_text';
 
       try {
         // Validate parameters
-        const { fileContent } = args;
+        const { fileContent, contentEncoding = 'identity' } = args;
 
-        // Decode base64 content to buffer
-        const buffer = Buffer.from(fileContent, 'base64');
+        // Decode base64 content to buffer, then decompress it if it was compressed
+        const uploaded = Buffer.from(fileContent, 'base64');
+        const buffer = await this.decompress(uploaded, contentEncoding);
         const fileSize = buffer.length;
 
         logger.info('Tool request received', {
           correlationId,
           toolName,
           fileSize,
+          ...(contentEncoding !== 'identity' && {
+            contentEncoding,
+            uploadSize: uploaded.length,
+          }),
         });
 
         // Check file size
@@ -171,7 +318,13 @@ export class PdfTextMcpServerHttp extends BasePdfTextMcpServer {
         console.error(`Health check: http://${host}:${port}/health`);
         console.error(`Readiness check: http://${host}:${port}/ready`);
         console.error(`Metrics: http://${host}:${port}/metrics`);
-        this.logConfiguration('http', { apiKeyEnabled: !!this.config.apiKey });
+        this.logConfiguration('http', {
+          apiKeyEnabled: !!this.config.apiKey,
+          clusterWorkers: this.config.clusterWorkers,
+          sharedCacheDir: this.config.sharedCacheDir,
+          selfUrl: this.config.selfUrl,
+          socketPath: this.config.socketPath,
+        });
 
         logger.info('Server started', {
           host,
@@ -184,6 +337,24 @@ export class PdfTextMcpServerHttp extends BasePdfTextMcpServer {
       });
     });
 
+    await this.socketTransport?.start();
+
+    if (this.peerRouter) {
+      await this.peerRouter.start();
+      logger.info('Cache-affinity routing enabled', { members: this.peerRouter.members });
+    }
+
+    // Pay the first extraction's one-time costs before taking traffic
+    const warmupResult = await warmup();
+    metrics.recordColdStart(warmupResult);
+    logger.info('Warm-up complete', {
+      addonLoadTime: warmupResult.addonLoadTime,
+      extractionTime: warmupResult.extractionTime,
+      bidiTime: warmupResult.bidiTime,
+      totalTime: warmupResult.totalTime,
+      threads: warmupResult.threads,
+    });
+
     // Mark as ready
     this.ready = true;
   }
@@ -278,6 +449,10 @@ export class PdfTextMcpServerHttp extends BasePdfTextMcpServer {
 
     // MCP endpoint - handles all MCP protocol messages
     app.all('/mcp', mcpTrackingMiddleware, authMiddleware, async (req, res) => {
+      if (await this.forwardToOwner(req, res)) {
+        return;
+      }
+
       // In stateless mode, create a new transport for each request to prevent
       // request ID collisions. Different clients may use the same JSON-RPC request
       // IDs, which would cause responses to be routed to the wrong HTTP connections
@@ -295,14 +470,154 @@ export class PdfTextMcpServerHttp extends BasePdfTextMcpServer {
       await transport.handleRequest(req, res, req.body);
     });
 
+    // Plain text extraction for callers that do not speak MCP: the PDF is the raw
+    // request body, the result JSON or binary depending on the Accept header. The
+    // body is decompressed by handleExtract, which also knows zstd.
+    app.post(
+      '/extract',
+      authMiddleware,
+      express.raw({
+        type: () => true,
+        inflate: false,
+        limit: this.config.maxFileSize ?? DEFAULT_MAX_FILE_SIZE,
+      }),
+      (req, res) => this.handleExtract(req, res)
+    );
+
     return createServer(app);
   }
 
+  /**
+   * Serve POST /extract. Pages are chosen with the startPage and endPage query
+   * parameters (numbers or page labels). The body may be compressed, as named by
+   * Content-Encoding (gzip or zstd). A client preferring RESULT_FORMAT_MEDIA_TYPE
+   * over JSON in Accept gets the binary result, the only one carrying page offsets.
+   */
+  private async handleExtract(req: express.Request, res: express.Response): Promise<void> {
+    const startTime = Date.now();
+    const body: Buffer = Buffer.isBuffer(req.body) ? req.body : Buffer.alloc(0);
+    const contentEncoding = (req.headers['content-encoding'] ?? 'identity').toLowerCase();
+    const binary =
+      req.accepts(['application/json', RESULT_FORMAT_MEDIA_TYPE]) === RESULT_FORMAT_MEDIA_TYPE;
+
+    if (!(CONTENT_ENCODINGS as readonly string[]).includes(contentEncoding)) {
+      res.status(415).json({ error: `Unsupported Content-Encoding: ${contentEncoding}` });
+      return;
+    }
+
+    let content: Buffer;
+    try {
+      content = await decompressUpload(
+        body,
+        contentEncoding as ContentEncoding,
+        this.config.maxFileSize ?? DEFAULT_MAX_FILE_SIZE
+      );
+    } catch (error) {
+      const message = error instanceof Error ? error.message : String(error);
+      if (error instanceof DecompressedSizeError) {
+        res.status(413).json({ error: message, code: PdfErrorCode.FILE_TOO_LARGE });
+      } else {
+        res.status(400).json({ error: `Cannot decompress ${contentEncoding} body: ${message}` });
+      }
+      return;
+    }
+
+    try {
+      const pageRange = this.toPageRange({
+        startPage: queryPage(req.query.startPage),
+        endPage: queryPage(req.query.endPage),
+      });
+      // Results with page offsets are cached apart from those of JSON callers and tools
+      const result = binary
+        ? await this.cached('extract_text', content, { pageRange, pageOffsets: true }, () =>
+            this.extractor.extractTextFromBuffer(content, pageRange, { pageOffsets: true })
+          )
+        : await this.cached('extract_text', content, pageRange, () =>
+            this.extractor.extractTextFromBuffer(content, pageRange)
+          );
+      const processingTime = Date.now() - startTime;
+      metrics.recordToolInvocation('extract_text', 'success', processingTime / 1000, {
+        fileSize: content.length,
+        pageCount: result.pageCount,
+        processingTime,
+      });
+
+      if (binary) {
+        const parts = encodeTextResult(result);
+        res.status(200);
+        res.set('Content-Type', RESULT_FORMAT_MEDIA_TYPE);
+        res.set('Content-Length', String(parts.reduce((length, part) => length + part.length, 0)));
+        parts.forEach((part) => res.write(part));
+        res.end();
+        return;
+      }
+
+      const fields = { ...result };
+      delete fields.minhash;
+      res.json(fields);
+    } catch (error) {
+      const processingTime = Date.now() - startTime;
+      const err = error instanceof Error ? error : new Error(String(error));
+      logger.error('Extract request failed', err, { fileSize: content.length, processingTime });
+      metrics.recordToolInvocation('extract_text', 'error', processingTime / 1000);
+      metrics.recordError(err.name, 'extract_text');
+
+      if (error instanceof PdfExtractionError) {
+        const status = error.code === PdfErrorCode.FILE_TOO_LARGE ? 413 : 422;
+        res.status(status).json({ error: error.message, code: error.code });
+      } else {
+        res.status(500).json({ error: err.message });
+      }
+    }
+  }
+
+  /**
+   * Send a tool call to the replica owning its content, when that is another
+   * replica. Returns false when the request should be served here: it is not
+   * a tool call on content, it was already forwarded once, this replica owns
+   * it, or the owner is unreachable.
+   */
+  private async forwardToOwner(req: express.Request, res: express.Response): Promise<boolean> {
+    if (!this.peerRouter || req.headers[FORWARDED_HEADER]) {
+      return false;
+    }
+    const key = PeerRouter.routingKey(req.body);
+    const owner = key === undefined ? undefined : this.peerRouter.ownerOf(key);
+    if (owner === undefined) {
+      return false;
+    }
+
+    const headers: Record<string, string> = {};
+    for (const name of ['accept', 'authorization']) {
+      const value = req.headers[name];
+      if (typeof value === 'string') {
+        headers[name] = value;
+      }
+    }
+
+    const response = await this.peerRouter.forward(owner, req.body, headers);
+    if (!response) {
+      logger.warn('Owner replica unreachable, serving locally', { owner });
+      metrics.recordPeerForward('fallback');
+      return false;
+    }
+
+    metrics.recordPeerForward('forwarded');
+    const contentType = response.headers.get('content-type');
+    if (contentType) {
+      res.set('Content-Type', contentType);
+    }
+    res.status(response.status).send(Buffer.from(await response.arrayBuffer()));
+    return true;
+  }
+
   /**
    * Stop the server gracefully
    */
   async stop(): Promise<void> {
     this.ready = false;
+    this.peerRouter?.stop();
+    await this.socketTransport?.stop();
 
     // Close MCP server
     await this.server.close();
@@ -12,14 +12,28 @@ import {
 } from '@modelcontextprotocol/sdk/types.js';
 import { RequestHandlerExtra } from '@modelcontextprotocol/sdk/shared/protocol.js';
 import { ServerConfig } from '../types';
-import { FilePathParamsSchema, FilePathParamsType } from '../schemas/stdio';
+import {
+  FilePathParamsSchema,
+  FilePathParamsType,
+  FilePathSectionParamsSchema,
+  FilePathTextParamsSchema,
+} from '../schemas/stdio';
 import { PDFTextMcpServer } from './pdf-text-mcp-server';
 import { BasePdfTextMcpServer } from './base-pdf-text-mcp-server';
+import { WatchIndexer } from '../watch-indexer';
 import * as fs from 'fs/promises';
 
 export class PdfTextMcpServerStdio extends BasePdfTextMcpServer {
+  private watchIndexer?: WatchIndexer;
+
   constructor(config: ServerConfig) {
     super(config);
+
+    if (config.watchDirectories && config.watchDirectories.length > 0) {
+      this.watchIndexer = new WatchIndexer(this.extractor, {
+        directories: config.watchDirectories,
+      });
+    }
   }
 
   protected setupTools(): void {
@@ -27,25 +41,57 @@ export class PdfTextMcpServerStdio extends BasePdfTextMcpServer {
       'extract_text',
       {
         description:
-          'Extract text content from a PDF file. Bidirectional text (Hebrew, Arabic, etc.) is always supported. Returns the extracted text, page count, and processing metadata. Provide filePath.',
+          'Extract text content from a PDF file. Bidirectional text (Hebrew, Arabic, etc.) is always supported. Returns the extracted text, page count, and processing metadata. Provide filePath, and optionally startPage/endPage as page numbers or printed page labels (e.g. "iv", "A-1") to extract only those pages.',
+        inputSchema: FilePathTextParamsSchema,
+      },
+      (args, extra) => {
+        const pageRange = this.toPageRange(args);
+        return this.createFilePathOperationHandler(async (filePath: string) =>
+          this.flagNearDuplicate(
+            await this.extractor.extractText(filePath, pageRange),
+            () => filePath,
+            pageRange
+          )
+        )(args, extra);
+      }
+    );
+
+    this.server.registerTool(
+      'extract_metadata',
+      {
+        description:
+          'Extract metadata from a PDF file including title, author, subject, creator, producer, dates, page count, version, and printed page labels when the document defines them. Provide filePath.',
         inputSchema: FilePathParamsSchema,
       },
       this.createFilePathOperationHandler((filePath: string) =>
-        this.extractor.extractText(filePath)
+        this.extractor.getMetadata(filePath)
       )
     );
 
     this.server.registerTool(
-      'extract_metadata',
+      'get_outline',
       {
         description:
-          'Extract metadata from a PDF file including title, author, subject, creator, producer, dates, page count, and version. Provide filePath.',
+          'Get the outline (bookmarks) of a PDF file without extracting text. Returns each entry with its title, nesting level, and first and last page. Provide filePath.',
         inputSchema: FilePathParamsSchema,
       },
       this.createFilePathOperationHandler((filePath: string) =>
-        this.extractor.getMetadata(filePath)
+        this.extractor.getOutline(filePath)
       )
     );
+
+    this.server.registerTool(
+      'extract_section',
+      {
+        description:
+          'Extract the text of one outline section of a PDF file, reading only that section\'s pages. The section is matched by title (exact, then prefix, then substring, ignoring case). Use get_outline to list sections. Provide filePath and section.',
+        inputSchema: FilePathSectionParamsSchema,
+      },
+      (args, extra) =>
+        this.createFilePathOperationHandler((filePath: string) =>
+          this.extractor.extractSection(filePath, args.section)
+        )(args, extra)
+    );
   }
 
   private createFilePathOperationHandler<T>(
@@ -66,8 +112,10 @@ export class PdfTextMcpServerStdio extends BasePdfTextMcpServer {
           throw new McpError(ErrorCode.InvalidRequest, `File not found: ${filePath}`);
         }
 
-        // Execute the operation
-        const result = await operation(filePath);
+        // Execute the operation, pausing background pre-extraction meanwhile
+        const result = this.watchIndexer
+          ? await this.watchIndexer.foreground(filePath, () => operation(filePath))
+          : await operation(filePath);
 
         // Return result in MCP format
         return {
@@ -102,13 +150,22 @@ export class PdfTextMcpServerStdio extends BasePdfTextMcpServer {
 
     // Log to stderr (not stdout, which is used for MCP protocol)
     console.error('PDF Text Extraction MCP Server running on stdio');
-    this.logConfiguration('stdio');
+    this.logConfiguration('stdio', {
+      watchDirectories: this.config.watchDirectories,
+      socketPath: this.config.socketPath,
+    });
+
+    await this.socketTransport?.start();
+    await this.watchIndexer?.start();
   }
 
   /**
    * Stop the server gracefully
    */
   async stop(): Promise<void> {
+    await this.watchIndexer?.stop();
+    await this.socketTransport?.stop();
+
     // Close MCP server
     await this.server.close();
     console.error('PDF Text Extraction MCP Server stopped.');
@@ -0,0 +1,127 @@
+/**
+ * Local-disk result cache shared by the processes of one host
+ *
+ * Results are stored as one JSON file per key. Writes go to a temporary file
+ * that is renamed into place, so concurrent readers in other cluster workers
+ * see either nothing or a complete entry. Pointing the directory at a tmpfs
+ * such as /dev/shm keeps the tier in memory.
+ */
+
+import { promises as fs } from 'fs';
+import * as path from 'path';
+import { createHash, randomBytes } from 'crypto';
+
+// Entries are pruned (oldest first) once per this many writes
+const PRUNE_INTERVAL = 100;
+
+export class SharedResultCache {
+  private writesSincePrune = 0;
+  private pruning = false;
+
+  /**
+   * @param directory Cache directory, created on first write
+   * @param maxEntries Entries kept after pruning
+   */
+  constructor(
+    private readonly directory: string,
+    private readonly maxEntries: number
+  ) {}
+
+  /**
+   * Cache key of a tool call on some content
+   * @param variant Further arguments that change the result (page range, section)
+   */
+  static key(toolName: string, content: Buffer, variant?: unknown): string {
+    return createHash('sha256')
+      .update(toolName)
+      .update('\0')
+      .update(JSON.stringify(variant ?? null))
+      .update('\0')
+      .update(content)
+      .digest('hex');
+  }
+
+  async get<T>(key: string): Promise<T | undefined> {
+    const entryPath = this.entryPath(key);
+    try {
+      const value = JSON.parse(await fs.readFile(entryPath, 'utf8')) as T;
+      // Pruning removes the least recently touched entries
+      const now = new Date();
+      fs.utimes(entryPath, now, now).catch(() => undefined);
+      return value;
+    } catch {
+      // Missing, or removed by another process while pruning
+      return undefined;
+    }
+  }
+
+  async set<T>(key: string, value: T): Promise<void> {
+    const entryPath = this.entryPath(key);
+    // Unique per write: concurrent writes of one key, even from one process, get their own file
+    const tempPath = `${entryPath}.${process.pid}.${randomBytes(6).toString('hex')}.tmp`;
+    try {
+      await fs.mkdir(this.directory, { recursive: true });
+      await fs.writeFile(tempPath, JSON.stringify(value));
+      await fs.rename(tempPath, entryPath);
+    } catch {
+      // The cache is an optimization; a failed write only costs a later miss
+      await fs.rm(tempPath, { force: true }).catch(() => undefined);
+      return;
+    }
+
+    if (++this.writesSincePrune >= PRUNE_INTERVAL) {
+      this.writesSincePrune = 0;
+      void this.prune();
+    }
+  }
+
+  /**
+   * Get a cached result, or compute and cache it
+   */
+  async getOrCompute<T>(key: string, compute: () => Promise<T>): Promise<T> {
+    const cached = await this.get<T>(key);
+    if (cached !== undefined) {
+      return cached;
+    }
+    const value = await compute();
+    await this.set(key, value);
+    return value;
+  }
+
+  private entryPath(key: string): string {
+    return path.join(this.directory, `${key}.json`);
+  }
+
+  private async prune(): Promise<void> {
+    if (this.pruning) {
+      return;
+    }
+    this.pruning = true;
+
+    try {
+      const names = (await fs.readdir(this.directory)).filter((name) => name.endsWith('.json'));
+      if (names.length <= this.maxEntries) {
+        return;
+      }
+
+      const entries = await Promise.all(
+        names.map(async (name) => {
+          const entryPath = path.join(this.directory, name);
+          const stats = await fs.stat(entryPath).catch(() => undefined);
+          return { entryPath, mtimeMs: stats ? stats.mtimeMs : 0 };
+        })
+      );
+      entries.sort((a, b) => a.mtimeMs - b.mtimeMs);
+
+      await Promise.all(
+        entries
+          .slice(0, entries.length - this.maxEntries)
+          .map(({ entryPath }) => fs.rm(entryPath, { force: true }))
+      );
+    } catch {
+      // Another worker may be pruning the same directory
+    } finally {
+      this.pruning = false;
+    }
+  }
+}
@@ -0,0 +1,417 @@
+/**
+ * Unix domain socket transport for same-host callers
+ *
+ * Skips MCP, HTTP, JSON request bodies and base64: callers send raw PDF bytes
+ * and get the text back as raw UTF-8, or as a binary result (see
+ * result-format.ts). Every message in either direction is a frame: a 4-byte
+ * big-endian payload length followed by the payload.
+ *
+ * Request payload (16-byte header, then the PDF bytes):
+ *   u8  operation     1 = extract text, 2 = extract metadata
+ *   u8  encoding      compression of the PDF bytes: 0 = none, 1 = gzip, 2 = zstd
+ *   u8  format        text results: 0 = JSON and text, 1 = binary result
+ *   u8  reserved
+ *   u32 requestId     echoed in the response
+ *   u32 startPage     1-based, 0 = from the first page (extract text only)
+ *   u32 endPage       1-based, 0 = to the last page (extract text only)
+ *
+ * Response payload (16-byte header, then the JSON, then the text):
+ *   u8  status        0 = ok, 1 = error
+ *   u8  operation
+ *   u8  format        format of the body: 0 = JSON and text, 1 = binary result
+ *   u8  reserved
+ *   u32 requestId
+ *   u32 jsonLength    UTF-8 JSON: result fields other than text, or {code, message}
+ *   u32 reserved
+ *
+ * A binary body (text results asked for in format 1) has jsonLength 0 and is
+ * the encoded result. Metadata and errors are always JSON.
+ *
+ * Requests on one connection run concurrently, up to maxInFlight at a time;
+ * the connection is not read while that many are running. Responses carry the
+ * request id and may arrive out of order.
+ *
+ * A single process binds the socket under a private name and renames it into
+ * place, and on stop removes the socket file only if it is still the one it
+ * bound. In cluster mode the primary holds the listening socket and hands
+ * connections to the workers; it removes a stale socket file before forking
+ * and the socket file at exit, and workers never remove it.
+ */
+
+import { connect, createServer, Server, Socket } from 'net';
+import { promises as fs } from 'fs';
+import { randomBytes } from 'crypto';
+import { PdfExtractionError, PdfExtractor, PdfPageRange } from '@pdf-text-mcp/pdf-parser';
+import { isClusterWorker } from './cluster';
+import { ContentEncoding, decompressUpload } from './decompress';
+import { EncodableTextResult, encodeTextResult } from './result-format';
+
+export const SOCKET_OPERATION_EXTRACT_TEXT = 1;
+export const SOCKET_OPERATION_EXTRACT_METADATA = 2;
+
+export const SOCKET_ENCODING_IDENTITY = 0;
+export const SOCKET_ENCODING_GZIP = 1;
+export const SOCKET_ENCODING_ZSTD = 2;
+
+const ENCODINGS: Record<number, ContentEncoding> = {
+  [SOCKET_ENCODING_IDENTITY]: 'identity',
+  [SOCKET_ENCODING_GZIP]: 'gzip',
+  [SOCKET_ENCODING_ZSTD]: 'zstd',
+};
+
+export const SOCKET_FORMAT_JSON = 0;
+export const SOCKET_FORMAT_BINARY = 1;
+
+export const SOCKET_STATUS_OK = 0;
+export const SOCKET_STATUS_ERROR = 1;
+
+const LENGTH_PREFIX_SIZE = 4;
+const HEADER_SIZE = 16;
+
+const DEFAULT_MAX_IN_FLIGHT = 8;
+
+export interface SocketTransportOptions {
+  /** Filesystem path of the socket; a stale socket file is replaced */
+  socketPath: string;
+  /** Largest PDF accepted, after decompression; larger frames close the connection */
+  maxFileSize: number;
+  /** Requests running at once per connection (default: 8) */
+  maxInFlight?: number;
+}
+
+export interface SocketRequest {
+  operation: number;
+  /** SOCKET_ENCODING_* of content (default: uncompressed) */
+  encoding?: number;
+  /** SOCKET_FORMAT_* of a text result (default: JSON and text) */
+  format?: number;
+  requestId: number;
+  startPage: number;
+  endPage: number;
+  content: Buffer;
+}
+
+/**
+ * Reassembles length-prefixed frames from stream chunks. Chunks are kept as a
+ * list and copied once per frame, not once per chunk.
+ */
+export class FrameDecoder {
+  private chunks: Buffer[] = [];
+  private buffered = 0;
+
+  /**
+   * @param maxFrameSize Largest payload accepted
+   */
+  constructor(private readonly maxFrameSize: number) {}
+
+  /**
+   * Add a chunk and return the payloads it completes.
+   * Throws when a frame announces a payload larger than maxFrameSize.
+   */
+  push(chunk: Buffer): Buffer[] {
+    this.chunks.push(chunk);
+    this.buffered += chunk.length;
+
+    const frames: Buffer[] = [];
+    while (this.buffered >= LENGTH_PREFIX_SIZE) {
+      const length = this.peekLength();
+      if (length > this.maxFrameSize) {
+        throw new Error(`Frame of ${length} bytes exceeds maximum (${this.maxFrameSize} bytes)`);
+      }
+      if (this.buffered < LENGTH_PREFIX_SIZE + length) {
+        break;
+      }
+      const data = this.chunks.length === 1 ? this.chunks[0] : Buffer.concat(this.chunks);
+      frames.push(data.subarray(LENGTH_PREFIX_SIZE, LENGTH_PREFIX_SIZE + length));
+      const rest = data.subarray(LENGTH_PREFIX_SIZE + length);
+      this.chunks = rest.length > 0 ? [rest] : [];
+      this.buffered = rest.length;
+    }
+    return frames;
+  }
+
+  private peekLength(): number {
+    const first = this.chunks[0];
+    if (first.length >= LENGTH_PREFIX_SIZE) {
+      return first.readUInt32BE(0);
+    }
+    return Buffer.concat(this.chunks).readUInt32BE(0);
+  }
+}
+
+export function encodeRequest(request: SocketRequest): Buffer {
+  const header = Buffer.alloc(LENGTH_PREFIX_SIZE + HEADER_SIZE);
+  header.writeUInt32BE(HEADER_SIZE + request.content.length, 0);
+  header.writeUInt8(request.operation, 4);
+  header.writeUInt8(request.encoding ?? SOCKET_ENCODING_IDENTITY, 5);
+  header.writeUInt8(request.format ?? SOCKET_FORMAT_JSON, 6);
+  header.writeUInt32BE(request.requestId, 8);
+  header.writeUInt32BE(request.startPage, 12);
+  header.writeUInt32BE(request.endPage, 16);
+  return Buffer.concat([header, request.content]);
+}
+
+export function decodeRequest(payload: Buffer): SocketRequest {
+  if (payload.length < HEADER_SIZE) {
+    throw new Error(`Request of ${payload.length} bytes is shorter than its header`);
+  }
+  return {
+    operation: payload.readUInt8(0),
+    encoding: payload.readUInt8(1),
+    format: payload.readUInt8(2),
+    requestId: payload.readUInt32BE(4),
+    startPage: payload.readUInt32BE(8),
+    endPage: payload.readUInt32BE(12),
+    content: payload.subarray(HEADER_SIZE),
+  };
+}
+
+/**
+ * Encode a response frame. The text goes out as raw UTF-8 after the JSON.
+ * Returned as separate buffers so large texts are written without a copy.
+ */
+export function encodeResponse(
+  status: number,
+  operation: number,
+  requestId: number,
+  fields: object,
+  text: string = ''
+): Buffer[] {
+  const json = Buffer.from(JSON.stringify(fields), 'utf8');
+  const textBytes = Buffer.from(text, 'utf8');
+  const header = Buffer.alloc(LENGTH_PREFIX_SIZE + HEADER_SIZE);
+  header.writeUInt32BE(HEADER_SIZE + json.length + textBytes.length, 0);
+  header.writeUInt8(status, 4);
+  header.writeUInt8(operation, 5);
+  header.writeUInt32BE(requestId, 8);
+  header.writeUInt32BE(json.length, 12);
+  return [header, json, textBytes];
+}
+
+/**
+ * Encode a successful text response carrying a binary result
+ */
+export function encodeBinaryResponse(
+  operation: number,
+  requestId: number,
+  result: EncodableTextResult
+): Buffer[] {
+  const body = encodeTextResult(result);
+  const header = Buffer.alloc(LENGTH_PREFIX_SIZE + HEADER_SIZE);
+  header.writeUInt32BE(HEADER_SIZE + body.reduce((length, part) => length + part.length, 0), 0);
+  header.writeUInt8(SOCKET_STATUS_OK, 4);
+  header.writeUInt8(operation, 5);
+  header.writeUInt8(SOCKET_FORMAT_BINARY, 6);
+  header.writeUInt32BE(requestId, 8);
+  return [header, ...body];
+}
+
+/**
+ * Remove a socket file left by a previous run, which would fail listen() with
+ * EADDRINUSE. A socket some process still listens on is left alone.
+ */
+export async function removeStaleSocket(socketPath: string): Promise<void> {
+  if (!(await isListening(socketPath))) {
+    await fs.rm(socketPath, { force: true });
+  }
+}
+
+export class SocketTransport {
+  private server?: Server;
+  private readonly sockets = new Set<Socket>();
+  /** Inode of the socket file this process bound, removed again by stop() */
+  private boundInode?: number;
+
+  constructor(
+    private readonly extractor: PdfExtractor,
+    private readonly options: SocketTransportOptions
+  ) {}
+
+  async start(): Promise<void> {
+    const { socketPath } = this.options;
+    this.server = createServer((socket) => this.handleConnection(socket));
+
+    if (isClusterWorker()) {
+      // Workers share the primary's socket, which the primary replaces and removes
+      await listen(this.server, socketPath);
+    } else {
+      if (await isListening(socketPath)) {
+        throw new Error(`Socket path already in use: ${socketPath}`);
+      }
+      // Bind under a private name and rename it into place, replacing any stale
+      // file. Closing a server unlinks the path it was bound to, which then is
+      // the private name, never a socket file another process put at socketPath.
+      const bindPath = `${socketPath}.${process.pid}.${randomBytes(6).toString('hex')}.tmp`;
+      await listen(this.server, bindPath);
+      try {
+        await fs.rename(bindPath, socketPath);
+        this.boundInode = (await fs.stat(socketPath)).ino;
+      } catch (error) {
+        await new Promise<void>((resolve) => this.server?.close(() => resolve()));
+        this.server = undefined;
+        throw error;
+      }
+    }
+    console.error(`PDF Text Extraction socket transport listening on ${socketPath}`);
+  }
+
+  async stop(): Promise<void> {
+    const server = this.server;
+    if (!server) {
+      return;
+    }
+    this.server = undefined;
+    this.sockets.forEach((socket) => socket.destroy());
+    await new Promise<void>((resolve) => server.close(() => resolve()));
+
+    // Only remove the socket file this process bound, not one that replaced it
+    const boundInode = this.boundInode;
+    this.boundInode = undefined;
+    const stats = await fs.stat(this.options.socketPath).catch(() => undefined);
+    if (boundInode !== undefined && stats?.ino === boundInode) {
+      await fs.rm(this.options.socketPath, { force: true });
+    }
+  }
+
+  private handleConnection(socket: Socket): void {
+    this.sockets.add(socket);
+    const decoder = new FrameDecoder(HEADER_SIZE + this.options.maxFileSize);
+    const maxInFlight = this.options.maxInFlight ?? DEFAULT_MAX_IN_FLIGHT;
+    const queued: Buffer[] = [];
+    let inFlight = 0;
+
+    // Start queued requests up to the limit; stop reading while any must wait,
+    // so a pipelining client cannot queue frames without bound
+    const dispatch = () => {
+      while (inFlight < maxInFlight && queued.length > 0) {
+        inFlight++;
+        void this.handleRequest(socket, queued.shift() as Buffer).finally(() => {
+          inFlight--;
+          dispatch();
+        });
+      }
+      if (inFlight >= maxInFlight || queued.length > 0) {
+        socket.pause();
+      } else {
+        socket.resume();
+      }
+    };
+
+    socket.on('data', (chunk: Buffer) => {
+      let frames: Buffer[];
+      try {
+        frames = decoder.push(chunk);
+      } catch (error) {
+        // The stream cannot be resynchronized after an oversized frame
+        this.send(socket, SOCKET_STATUS_ERROR, 0, 0, errorFields(error));
+        socket.end();
+        return;
+      }
+      queued.push(...frames);
+      dispatch();
+    });
+    socket.on('error', () => socket.destroy());
+    socket.on('close', () => this.sockets.delete(socket));
+  }
+
+  private async handleRequest(socket: Socket, payload: Buffer): Promise<void> {
+    let request: SocketRequest;
+    try {
+      request = decodeRequest(payload);
+    } catch (error) {
+      this.send(socket, SOCKET_STATUS_ERROR, 0, 0, errorFields(error));
+      return;
+    }
+
+    const { operation, requestId } = request;
+    try {
+      const encoding = ENCODINGS[request.encoding ?? SOCKET_ENCODING_IDENTITY];
+      if (!encoding) {
+        throw new Error(`Unknown encoding: ${request.encoding}`);
+      }
+      if (request.format !== undefined && request.format > SOCKET_FORMAT_BINARY) {
+        throw new Error(`Unknown format: ${request.format}`);
+      }
+      const content = await decompressUpload(request.content, encoding, this.options.maxFileSize);
+
+      if (operation === SOCKET_OPERATION_EXTRACT_TEXT) {
+        const pageRange: PdfPageRange | undefined =
+          request.startPage > 0 || request.endPage > 0
+            ? {
+                startPage: request.startPage > 0 ? request.startPage : 1,
+                endPage: request.endPage > 0 ? request.endPage : undefined,
+              }
+            : undefined;
+        if (request.format === SOCKET_FORMAT_BINARY) {
+          // Only binary results carry page offsets
+          const result = await this.extractor.extractTextFromBuffer(content, pageRange, {
+            pageOffsets: true,
+          });
+          this.write(socket, encodeBinaryResponse(operation, requestId, result));
+        } else {
+          const { text, ...fields } = await this.extractor.extractTextFromBuffer(
+            content,
+            pageRange
+          );
+          this.send(socket, SOCKET_STATUS_OK, operation, requestId, fields, text);
+        }
+      } else if (operation === SOCKET_OPERATION_EXTRACT_METADATA) {
+        const metadata = await this.extractor.getMetadataFromBuffer(content);
+        this.send(socket, SOCKET_STATUS_OK, operation, requestId, metadata);
+      } else {
+        throw new Error(`Unknown operation: ${operation}`);
+      }
+    } catch (error) {
+      this.send(socket, SOCKET_STATUS_ERROR, operation, requestId, errorFields(error));
+    }
+  }
+
+  private send(
+    socket: Socket,
+    status: number,
+    operation: number,
+    requestId: number,
+    fields: object,
+    text?: string
+  ): void {
+    this.write(socket, encodeResponse(status, operation, requestId, fields, text));
+  }
+
+  private write(socket: Socket, parts: Buffer[]): void {
+    if (socket.destroyed) {
+      return;
+    }
+    // One writev for all parts of the frame
+    socket.cork();
+    parts.forEach((part) => socket.write(part));
+    socket.uncork();
+  }
+}
+
+function listen(server: Server, socketPath: string): Promise<void> {
+  return new Promise<void>((resolve, reject) => {
+    server.once('error', reject);
+    server.listen(socketPath, () => {
+      server.off('error', reject);
+      resolve();
+    });
+  });
+}
+
+function isListening(socketPath: string): Promise<boolean> {
+  return new Promise((resolve) => {
+    const probe = connect(socketPath);
+    probe.once('connect', () => {
+      probe.destroy();
+      resolve(true);
+    });
+    probe.once('error', () => resolve(false));
+  });
+}
+
+function errorFields(error: unknown): { code?: string; message: string } {
+  if (error instanceof PdfExtractionError) {
+    return { code: error.code, message: error.message };
+  }
+  return { message: error instanceof Error ? error.message : String(error) };
+}
@@ -3,6 +3,7 @@
  */
 
 import { z } from 'zod';
+import { PdfExtractionResult } from '@pdf-text-mcp/pdf-parser';
 
 /**
  * Transport mode for MCP server
@@ -21,6 +22,42 @@ export interface ServerConfig {
   maxFileSize?: number;
   /** Timeout for PDF extraction (milliseconds) */
   timeout?: number;
+  /** Threads extracting page spans of one document concurrently (1 = sequential) */
+  pageWorkers?: number;
+  /** Document revisions whose page texts are kept for incremental updates (0 = disabled) */
+  revisionCacheSize?: number;
+  /** Local files whose results are cached by path, validated by stat (0 = disabled) */
+  fileCacheSize?: number;
+  /** Documents whose text placements are kept to serve page ranges (0 = disabled) */
+  placementCacheSize?: number;
+  /** Bytes of serialized placements the placement cache may hold */
+  placementCacheBytes?: number;
+  /** Directories whose PDFs are pre-extracted in the background (stdio mode) */
+  watchDirectories?: string[];
+  /** Worker processes sharing the HTTP port (0 or 1 = single process, http mode) */
+  clusterWorkers?: number;
+  /** Directory of the result cache shared by processes on this host (http mode) */
+  sharedCacheDir?: string;
+  /** Entries kept in the shared result cache */
+  sharedCacheSize?: number;
+  /** URL other replicas reach this replica at; enables cache-affinity routing (http mode) */
+  selfUrl?: string;
+  /** Static URLs of the replicas sharing the routing ring */
+  peerUrls?: string[];
+  /** Host name resolving to every replica (headless Service) */
+  peerDns?: string;
+  /** Upper bound of the adaptive limit on concurrent extractions (0 = unlimited) */
+  maxConcurrency?: number;
+  /** Read files for path-based text extraction through a read-ahead block cache */
+  prefetchReads?: boolean;
+  /** Read metadata by locating only the objects it needs in the xref */
+  lazyMetadata?: boolean;
+  /** Unix domain socket for same-host callers, alongside either transport mode */
+  socketPath?: string;
+  /** Similarity at which extract_text flags a near-duplicate of an earlier document (0 = off) */
+  nearDuplicateThreshold?: number;
+  /** Documents remembered for near-duplicate detection */
+  nearDuplicateIndexSize?: number;
   /** Transport mode: stdio for local, http for remote */
   transportMode: TransportMode;
   /** Port for HTTP server (only used when transportMode is 'http') */
@@ -31,6 +68,17 @@ export interface ServerConfig {
   apiKey?: string;
 }
 
+/**
+ * extract_text tool result: the extraction result, with near-duplicate
+ * information in place of the raw MinHash signature
+ */
+export type ExtractTextToolResult = Omit<PdfExtractionResult, 'minhash' | 'pageOffsets'> & {
+  /** Document this one is a near-duplicate of (path, or content hash over HTTP) */
+  nearDuplicateOf?: string;
+  /** Estimated similarity to nearDuplicateOf (0..1) */
+  nearDuplicateSimilarity?: number;
+};
+
 /**
  * Zod schema for extract_text tool parameters
  * This validates the JSON parameters sent by the AI
@@ -0,0 +1,204 @@
+/**
+ * Watch-folder indexer for stdio deployments
+ *
+ * Watches directories for new or changed PDFs and extracts them in the
+ * background so the extractor's file cache is warm by the time the agent
+ * asks about them. Files are extracted one at a time, after their writes have
+ * settled, and never while a foreground tool call is running.
+ */
+
+import { watch, FSWatcher, promises as fs } from 'fs';
+import * as path from 'path';
+import { PdfExtractor } from '@pdf-text-mcp/pdf-parser';
+
+// Quiet period after the last change event before a file is extracted
+const DEFAULT_SETTLE_MS = 1000;
+
+export interface WatchIndexerOptions {
+  /** Directories whose PDFs are pre-extracted (not recursive) */
+  directories: string[];
+  /** Milliseconds without change events before a file counts as written */
+  settleMs?: number;
+}
+
+export class WatchIndexer {
+  private readonly settleMs: number;
+  private readonly watchers: FSWatcher[] = [];
+  private readonly settleTimers = new Map<string, NodeJS.Timeout>();
+  // Insertion-ordered and de-duplicated
+  private readonly queue = new Set<string>();
+  private idleWaiters: (() => void)[] = [];
+  private foregroundCount = 0;
+  private current?: { filePath: string; done: Promise<void> };
+  private draining = false;
+  private stopped = true;
+  private indexed = 0;
+
+  constructor(
+    private readonly extractor: PdfExtractor,
+    private readonly options: WatchIndexerOptions
+  ) {
+    this.settleMs = options.settleMs ?? DEFAULT_SETTLE_MS;
+  }
+
+  /**
+   * Start watching, and queue the PDFs already in the directories
+   */
+  async start(): Promise<void> {
+    this.stopped = false;
+
+    for (const directory of this.options.directories) {
+      const resolved = path.resolve(directory);
+      try {
+        const watcher = watch(resolved, (_eventType, fileName) => {
+          if (fileName) {
+            this.schedule(path.join(resolved, fileName.toString()));
+          }
+        });
+        watcher.on('error', (error) => {
+          console.error(`Stopped watching ${resolved}: ${error.message}`);
+        });
+        this.watchers.push(watcher);
+
+        for (const fileName of await fs.readdir(resolved)) {
+          this.enqueue(path.join(resolved, fileName));
+        }
+      } catch (error) {
+        console.error(
+          `Cannot watch ${resolved}: ${error instanceof Error ? error.message : String(error)}`
+        );
+      }
+    }
+  }
+
+  async stop(): Promise<void> {
+    this.stopped = true;
+    this.watchers.forEach((watcher) => watcher.close());
+    this.watchers.length = 0;
+    this.settleTimers.forEach((timer) => clearTimeout(timer));
+    this.settleTimers.clear();
+    this.queue.clear();
+    this.releaseIdleWaiters();
+    await this.current?.done;
+  }
+
+  /**
+   * Run a foreground tool call. Background extraction pauses until no foreground
+   * call is running. If the indexer is extracting the same file right now, the
+   * call waits for it and is then served from the warm cache.
+   */
+  async foreground<T>(filePath: string, operation: () => Promise<T>): Promise<T> {
+    this.foregroundCount++;
+    try {
+      const resolved = path.resolve(filePath);
+      // The foreground call extracts (and caches) it itself
+      this.queue.delete(resolved);
+      if (this.current && this.current.filePath === resolved) {
+        await this.current.done;
+      }
+      return await operation();
+    } finally {
+      this.foregroundCount--;
+      if (this.foregroundCount === 0) {
+        this.releaseIdleWaiters();
+      }
+    }
+  }
+
+  /** Files pre-extracted since start */
+  get indexedCount(): number {
+    return this.indexed;
+  }
+
+  /** Files waiting to be pre-extracted */
+  get queuedCount(): number {
+    return this.queue.size;
+  }
+
+  private schedule(filePath: string): void {
+    if (this.stopped || !isPdf(filePath)) {
+      return;
+    }
+
+    // Writers produce a burst of events; extract once they stop
+    clearTimeout(this.settleTimers.get(filePath));
+    this.settleTimers.set(
+      filePath,
+      setTimeout(() => {
+        this.settleTimers.delete(filePath);
+        this.enqueue(filePath);
+      }, this.settleMs)
+    );
+  }
+
+  private enqueue(filePath: string): void {
+    if (this.stopped || !isPdf(filePath)) {
+      return;
+    }
+    this.queue.delete(filePath);
+    this.queue.add(filePath);
+    void this.drain();
+  }
+
+  private async drain(): Promise<void> {
+    if (this.draining) {
+      return;
+    }
+    this.draining = true;
+
+    try {
+      while (!this.stopped && this.queue.size > 0) {
+        await this.waitForIdle();
+        // Let pending I/O callbacks (such as new foreground requests) run first
+        await new Promise((resolve) => setImmediate(resolve));
+        if (this.stopped || this.foregroundCount > 0) {
+          continue;
+        }
+
+        const filePath = this.queue.values().next().value as string | undefined;
+        if (filePath === undefined) {
+          break;
+        }
+        this.queue.delete(filePath);
+
+        const done = this.indexFile(filePath);
+        this.current = { filePath, done };
+        await done;
+        this.current = undefined;
+      }
+    } finally {
+      this.draining = false;
+    }
+  }
+
+  private async indexFile(filePath: string): Promise<void> {
+    try {
+      const stats = await fs.stat(filePath);
+      if (!stats.isFile()) {
+        return;
+      }
+      await this.extractor.extractText(filePath);
+      this.indexed++;
+    } catch {
+      // Removed, still being written or not a readable PDF. A later change event
+      // queues it again, and foreground calls report their own errors.
+    }
+  }
+
+  private waitForIdle(): Promise<void> {
+    if (this.foregroundCount === 0 || this.stopped) {
+      return Promise.resolve();
+    }
+    return new Promise((resolve) => this.idleWaiters.push(resolve));
+  }
+
+  private releaseIdleWaiters(): void {
+    const waiters = this.idleWaiters;
+    this.idleWaiters = [];
+    waiters.forEach((resolve) => resolve());
+  }
+}
+
+function isPdf(filePath: string): boolean {
+  return path.extname(filePath).toLowerCase() === '.pdf';
+}
@@ -1,7 +1,18 @@
 """PDF MCP Client - Shared library for pdf-text-mcp server communication."""
 
-from .http_client import MCPHTTPClient
+from .cache import ResultCache
+from .hedging import HedgingPolicy
+from .http_client import BatchResult, MCPHTTPClient
+from .result_format import TextResult, decode_text_result
 from .utils import PDFUtils
 
-__all__ = ["MCPHTTPClient", "PDFUtils"]
+__all__ = [
+    "BatchResult",
+    "HedgingPolicy",
+    "MCPHTTPClient",
+    "PDFUtils",
+    "ResultCache",
+    "TextResult",
+    "decode_text_result",
+]
 __version__ = "0.1.0"
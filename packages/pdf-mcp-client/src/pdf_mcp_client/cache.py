@@ -0,0 +1,146 @@
+"""Local disk cache of extraction results.
+
+Results are keyed by the SHA-256 of the PDF content, the tool and the server
+version, so a renamed or copied file still hits and a server upgrade starts
+afresh. Each entry is one JSON file written atomically (temporary file, then
+rename), so several processes can share a cache directory.
+"""
+
+import hashlib
+import json
+import os
+import tempfile
+import threading
+from pathlib import Path
+from typing import Any
+
+DEFAULT_MAX_BYTES = 512 * 1024 * 1024  # 512MB
+
+# After exceeding max_bytes, prune down to this fraction of it
+PRUNE_TARGET_RATIO = 0.9
+
+
+class ResultCache:
+    """Size-limited on-disk cache of tool results.
+
+    Least recently used entries are removed once the cache grows past
+    `max_bytes`; hits refresh an entry's modification time.
+
+    Usage:
+        cache = ResultCache(ResultCache.default_directory())
+        async with MCPHTTPClient("http://localhost:3000", cache=cache) as client:
+            text = await client.extract_text("/path/to/document.pdf")
+    """
+
+    def __init__(self, directory: str | Path, max_bytes: int = DEFAULT_MAX_BYTES):
+        """Initialize result cache.
+
+        Args:
+            directory: Cache directory, created if missing
+            max_bytes: Total size of entries kept
+        """
+        self.directory = Path(directory).expanduser()
+        self.max_bytes = max_bytes
+        self._lock = threading.Lock()
+        self._total_bytes: int | None = None
+
+    @staticmethod
+    def default_directory() -> Path:
+        """Per-user cache directory ($XDG_CACHE_HOME/pdf-mcp-client)."""
+        base = os.environ.get("XDG_CACHE_HOME") or Path.home() / ".cache"
+        return Path(base) / "pdf-mcp-client"
+
+    @staticmethod
+    def key(tool_name: str, content_hash: str, server_version: str) -> str:
+        """Cache key of a tool result.
+
+        Args:
+            tool_name: Tool that produced the result
+            content_hash: SHA-256 hex digest of the PDF content
+            server_version: Version reported by the server
+
+        Returns:
+            Hex digest identifying the entry
+        """
+        return hashlib.sha256(
+            f"{tool_name}\0{server_version}\0{content_hash}".encode()
+        ).hexdigest()
+
+    def _entry_path(self, key: str) -> Path:
+        return self.directory / key[:2] / f"{key}.json"
+
+    def get(self, key: str) -> dict[str, Any] | None:
+        """Return the cached result, or None on a miss."""
+        path = self._entry_path(key)
+        try:
+            with open(path, encoding="utf-8") as f:
+                value: dict[str, Any] = json.load(f)
+        except (OSError, ValueError):
+            # Missing, being replaced, or pruned by another process
+            return None
+        try:
+            os.utime(path)
+        except OSError:
+            pass
+        return value
+
+    def set(self, key: str, value: dict[str, Any]) -> None:
+        """Store a result, pruning old entries when over the size limit."""
+        path = self._entry_path(key)
+        data = json.dumps(value).encode("utf-8")
+        try:
+            # A rewrite replaces the old entry, whose bytes no longer count
+            old_size = path.stat().st_size
+        except OSError:
+            old_size = 0
+        try:
+            path.parent.mkdir(parents=True, exist_ok=True)
+            fd, temp_path = tempfile.mkstemp(dir=path.parent, suffix=".tmp")
+            try:
+                with os.fdopen(fd, "wb") as f:
+                    f.write(data)
+                os.replace(temp_path, path)
+            except BaseException:
+                os.unlink(temp_path)
+                raise
+        except OSError:
+            # The cache is an optimization; a failed write only costs a later miss
+            return
+
+        with self._lock:
+            if self._total_bytes is None:
+                self._total_bytes = sum(size for _, _, size in self._entries())
+            else:
+                self._total_bytes += len(data) - old_size
+            if self._total_bytes > self.max_bytes:
+                self._prune()
+
+    def clear(self) -> None:
+        """Remove every entry."""
+        with self._lock:
+            for entry_path, _, _ in self._entries():
+                entry_path.unlink(missing_ok=True)
+            self._total_bytes = 0
+
+    def _entries(self) -> list[tuple[Path, float, int]]:
+        """(path, mtime, size) of every entry."""
+        entries = []
+        for entry_path in self.directory.glob("*/*.json"):
+            try:
+                stat = entry_path.stat()
+            except OSError:
+                continue
+            entries.append((entry_path, stat.st_mtime, stat.st_size))
+        return entries
+
+    def _prune(self) -> None:
+        """Remove least recently used entries down to the prune target."""
+        entries = sorted(self._entries(), key=lambda entry: entry[1])
+        total = sum(size for _, _, size in entries)
+        target = self.max_bytes * PRUNE_TARGET_RATIO
+        for entry_path, _, size in entries:
+            if total <= target:
+                break
+            entry_path.unlink(missing_ok=True)
+            total -= size
+        self._total_bytes = total
@@ -0,0 +1,86 @@
+"""Request hedging policy.
+
+A request still running after the observed p95 latency is likely stuck behind
+a slow replica (GC pause, noisy neighbour). Sending a duplicate then, and
+taking whichever answers first, trims the tail at the cost of a few extra
+requests. A budget keeps those extra requests to a fixed share of traffic, so
+a slow cluster is not hit with a wave of duplicates.
+"""
+
+import math
+from collections import deque
+
+DEFAULT_HEDGE_PERCENTILE = 0.95
+DEFAULT_HEDGE_BUDGET = 0.05
+
+# Latencies kept for the percentile
+LATENCY_WINDOW = 1000
+
+# No hedging until this many latencies were observed
+MIN_LATENCY_SAMPLES = 20
+
+# Percentile is recomputed once per this many new latencies
+RECOMPUTE_INTERVAL = 10
+
+# Unused budget saved up for bursts, in hedges
+MAX_SAVED_HEDGES = 10.0
+
+
+class HedgingPolicy:
+    """When to hedge a request, and whether the budget allows it.
+
+    Every request earns `budget` of a hedge and every hedge spends one, so at
+    most that share of requests is duplicated over time.
+    """
+
+    def __init__(
+        self,
+        percentile: float = DEFAULT_HEDGE_PERCENTILE,
+        budget: float = DEFAULT_HEDGE_BUDGET,
+    ):
+        """Initialize hedging policy.
+
+        Args:
+            percentile: Latency percentile after which a request is hedged
+            budget: Largest share of requests hedged (0.05 = 5%)
+        """
+        self.percentile = percentile
+        self.budget = budget
+        self._latencies: deque[float] = deque(maxlen=LATENCY_WINDOW)
+        self._new_latencies = 0
+        self._delay: float | None = None
+        self._tokens = 0.0
+        self.requests = 0
+        self.hedges = 0
+        self.hedge_wins = 0
+
+    def record(self, seconds: float) -> None:
+        """Record the latency of a completed request."""
+        self._latencies.append(seconds)
+        self._new_latencies += 1
+        if len(self._latencies) < MIN_LATENCY_SAMPLES:
+            return
+        if self._delay is None or self._new_latencies >= RECOMPUTE_INTERVAL:
+            self._new_latencies = 0
+            ordered = sorted(self._latencies)
+            index = min(len(ordered) - 1, math.ceil(self.percentile * len(ordered)) - 1)
+            self._delay = ordered[max(0, index)]
+
+    def start_request(self) -> float | None:
+        """Count a new request toward the budget.
+
+        Returns:
+            Seconds to wait before hedging it, or None while too few
+            latencies have been observed
+        """
+        self.requests += 1
+        self._tokens = min(MAX_SAVED_HEDGES, self._tokens + self.budget)
+        return self._delay
+
+    def try_hedge(self) -> bool:
+        """Spend budget on a hedge, if there is enough."""
+        if self._tokens < 1.0:
+            return False
+        self._tokens -= 1.0
+        self.hedges += 1
+        return True
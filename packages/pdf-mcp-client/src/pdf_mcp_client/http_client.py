@@ -4,15 +4,79 @@ This client makes direct HTTP calls to the MCP server, bypassing the LLM
 to avoid token costs when sending PDF content.
 """
 
+import asyncio
+import itertools
 import json
+import random
+from collections.abc import AsyncIterator, Callable, Iterable, Sequence
+from dataclasses import dataclass
+from datetime import datetime, timezone
+from email.utils import parsedate_to_datetime
 from typing import Any, Literal
 from urllib.parse import urljoin
 
 import httpx
 
+from .cache import ResultCache
+from .hedging import HedgingPolicy
 from .protocol import MCPProtocol
+from .result_format import RESULT_FORMAT_MEDIA_TYPE, TextResult, decode_text_result
 from .utils import PDFUtils
 
+CLIENT_NAME = "pdf-mcp-client"
+CLIENT_VERSION = "0.1.0"
+
+
+ToolName = Literal["extract_text", "extract_metadata"]
+
+# Responses asking the client to slow down and retry later
+RETRY_STATUS_CODES = (429, 503)
+
+
+def _http2_available() -> bool:
+    """Whether httpx can speak HTTP/2 (the optional h2 package is installed)."""
+    try:
+        import h2  # noqa: F401
+    except ImportError:
+        return False
+    return True
+
+
+def _retry_after_seconds(response: httpx.Response) -> float | None:
+    """Parse a Retry-After header given as seconds or as an HTTP date."""
+    value = response.headers.get("Retry-After")
+    if value is None:
+        return None
+    try:
+        return max(0.0, float(value))
+    except ValueError:
+        pass
+    try:
+        retry_at = parsedate_to_datetime(value)
+    except (TypeError, ValueError):
+        return None
+    return max(0.0, (retry_at - datetime.now(timezone.utc)).total_seconds())
+
+
+@dataclass
+class BatchResult:
+    """Outcome of one file of an extract_many batch.
+
+    Attributes:
+        pdf_path: Path of the PDF, as given
+        result: Extracted text (extract_text) or metadata (extract_metadata)
+        error: Exception raised for this file, if it failed
+    """
+
+    pdf_path: str
+    result: Any = None
+    error: Exception | None = None
+
+    @property
+    def ok(self) -> bool:
+        """True when the file was extracted."""
+        return self.error is None
+
 
 class MCPHTTPClient:
     """Direct HTTP client for MCP server communication.
@@ -33,6 +97,14 @@ class MCPHTTPClient:
         api_key: str | None = None,
         timeout: float = 30.0,
         read_timeout: float = 60.0,
+        max_connections: int = 10,
+        max_retries: int = 5,
+        backoff_base: float = 0.5,
+        backoff_max: float = 30.0,
+        cache: ResultCache | None = None,
+        server_version: str | None = None,
+        hedging: HedgingPolicy | None = None,
+        hedge_urls: Sequence[str] = (),
     ):
         """Initialize MCP HTTP client.
 
@@ -41,6 +113,17 @@ class MCPHTTPClient:
             api_key: Optional API key for authentication
             timeout: Connection timeout in seconds
             read_timeout: Read timeout in seconds
+            max_connections: Size of the connection pool
+            max_retries: Retries of a tool call answered with 429 or 503
+            backoff_base: First backoff delay in seconds when no Retry-After is given
+            backoff_max: Longest backoff delay in seconds
+            cache: Local result cache; hits skip the server entirely
+            server_version: Server version for cache keys; asked from the
+                server (once per client) when not given
+            hedging: Hedging policy; tool calls slower than its percentile are
+                sent again and the first response wins
+            hedge_urls: Base URLs of other replicas that receive hedged calls,
+                in turn (default: base_url, for a load balancer to spread)
         """
         self.base_url = base_url.rstrip("/")
         self.mcp_endpoint = urljoin(self.base_url + "/", "mcp")
@@ -52,43 +135,159 @@ class MCPHTTPClient:
         if api_key:
             headers["Authorization"] = f"Bearer {api_key}"
 
+        # Keep-alive connections are reused across calls; HTTP/2 is negotiated
+        # (over TLS) when the h2 package is installed
         self.client = httpx.AsyncClient(
-            headers=headers, timeout=httpx.Timeout(timeout, read=read_timeout)
+            headers=headers,
+            timeout=httpx.Timeout(timeout, read=read_timeout),
+            limits=httpx.Limits(
+                max_connections=max_connections,
+                max_keepalive_connections=max_connections,
+            ),
+            http2=_http2_available(),
         )
         self._request_id = 0
+        self.max_retries = max_retries
+        self.backoff_base = backoff_base
+        self.backoff_max = backoff_max
+        self.cache = cache
+        self._server_version = server_version
+        self._server_version_lock = asyncio.Lock()
+        # Cache misses being computed, so concurrent callers share one call
+        self._pending: dict[str, asyncio.Future[dict[str, Any]]] = {}
+        self.hedging = hedging
+        self._hedge_endpoints = itertools.cycle(
+            [urljoin(url.rstrip("/") + "/", "mcp") for url in hedge_urls]
+            or [self.mcp_endpoint]
+        )
 
     def _next_request_id(self) -> int:
         """Generate next request ID."""
         self._request_id += 1
         return self._request_id
 
-    async def _call_tool(
-        self,
-        tool_name: Literal["extract_text", "extract_metadata"],
-        file_content_base64: str,
-    ) -> dict[str, Any]:
-        """Call MCP tool with base64-encoded PDF content.
+    def _retry_delay(self, response: httpx.Response, attempt: int) -> float:
+        """Seconds to wait before retrying a throttled call.
+
+        Honors Retry-After, stretched by up to 20% so that clients throttled
+        together do not return together. Without it, uses exponential backoff
+        with full jitter.
+        """
+        retry_after = _retry_after_seconds(response)
+        if retry_after is not None:
+            return retry_after * random.uniform(1.0, 1.2)
+        return random.uniform(0, min(self.backoff_max, self.backoff_base * 2**attempt))
+
+    async def _post_hedged(
+        self, body: Callable[[], AsyncIterator[bytes]], headers: dict[str, str]
+    ) -> httpx.Response:
+        """POST a tool call, hedging it when it outlasts the policy's percentile.
+
+        The first response (of any status) wins and the other request is
+        cancelled. If one of the two requests fails, the other is awaited.
+
+        The winner's latency is recorded from the original send, which is what
+        the caller waited, also when the hedge won. A cancelled loser records
+        how long it had been running, a lower bound of its latency.
+        """
+        if self.hedging is None:
+            return await self.client.post(self.mcp_endpoint, content=body(), headers=headers)
+
+        loop = asyncio.get_running_loop()
+        hedging = self.hedging
+        delay = hedging.start_request()
+        sent = loop.time()
+        primary = asyncio.create_task(
+            self.client.post(self.mcp_endpoint, content=body(), headers=headers)
+        )
+        started = {primary: sent}
+        tasks = {primary}
+        record_losers = False
+        try:
+            if delay is not None:
+                await asyncio.wait(tasks, timeout=delay)
+                if not primary.done() and hedging.try_hedge():
+                    hedge_endpoint = next(self._hedge_endpoints)
+                    hedge = asyncio.create_task(
+                        self.client.post(hedge_endpoint, content=body(), headers=headers)
+                    )
+                    started[hedge] = loop.time()
+                    tasks.add(hedge)
+
+            while True:
+                done, _ = await asyncio.wait(tasks, return_when=asyncio.FIRST_COMPLETED)
+                for task in done:
+                    tasks.discard(task)
+                    if task.exception() is None or not tasks:
+                        response = task.result()
+                        # Quick throttling answers would understate latency
+                        if response.status_code not in RETRY_STATUS_CODES:
+                            hedging.record(loop.time() - sent)
+                            record_losers = True
+                        if task is not primary:
+                            hedging.hedge_wins += 1
+                        return response
+        finally:
+            now = loop.time()
+            for task in tasks:
+                if record_losers:
+                    hedging.record(now - started[task])
+                task.cancel()
+            await asyncio.gather(*tasks, return_exceptions=True)
+
+    async def _call_tool(self, tool_name: ToolName, pdf_path: str) -> dict[str, Any]:
+        """Call MCP tool with a PDF, streaming its base64 content.
+
+        The JSON-RPC body is written around the file's base64 encoding as it
+        is read, so a large PDF is never held in memory whole.
 
         Args:
             tool_name: Name of the tool to call
-            file_content_base64: Base64-encoded PDF content
+            pdf_path: Path to local PDF file
 
         Returns:
             Tool result (parsed JSON)
 
         Raises:
+            FileNotFoundError: If PDF file doesn't exist
             httpx.HTTPError: On HTTP errors
             ValueError: On MCP protocol errors
         """
-        # Create JSON-RPC request
-        request = MCPProtocol.create_tool_call_request(
+        size = await asyncio.to_thread(PDFUtils.get_pdf_size, pdf_path)
+        head, tail = MCPProtocol.create_tool_call_envelope(
             tool_name=tool_name,
-            arguments={"fileContent": file_content_base64},
+            content_argument="fileContent",
             request_id=self._next_request_id(),
         )
+        # Sent with a length rather than chunked, as servers expect of JSON bodies
+        headers = {
+            "Content-Length": str(len(head) + PDFUtils.base64_length(size) + len(tail))
+        }
 
-        # Send POST request to /mcp endpoint
-        response = await self.client.post(self.mcp_endpoint, json=request)
+        async def body() -> AsyncIterator[bytes]:
+            yield head
+            chunks = PDFUtils.iter_pdf_base64(pdf_path, length=size)
+            try:
+                # File reading stays off the event loop
+                while True:
+                    chunk = await asyncio.to_thread(next, chunks, None)
+                    if chunk is None:
+                        break
+                    yield chunk
+            finally:
+                chunks.close()
+            yield tail
+
+        # Send POST request to /mcp endpoint, backing off while throttled
+        attempt = 0
+        while True:
+            # A fresh body per attempt; the file is read again on retry
+            response = await self._post_hedged(body, headers)
+            throttled = response.status_code in RETRY_STATUS_CODES
+            if not throttled or attempt >= self.max_retries:
+                break
+            await asyncio.sleep(self._retry_delay(response, attempt))
+            attempt += 1
         response.raise_for_status()
 
         # Parse JSON-RPC response
@@ -114,13 +313,82 @@ class MCPHTTPClient:
 
         return {}
 
+    async def get_server_version(self) -> str:
+        """Version of the server, from the MCP initialize handshake.
+
+        Returns:
+            Server version string
+        """
+        async with self._server_version_lock:
+            if self._server_version is None:
+                request = MCPProtocol.create_initialize_request(
+                    CLIENT_NAME, CLIENT_VERSION, request_id=self._next_request_id()
+                )
+                response = await self.client.post(self.mcp_endpoint, json=request)
+                response.raise_for_status()
+                rpc_response = response.json()
+                if "error" in rpc_response:
+                    error = rpc_response["error"]
+                    raise ValueError(
+                        f"MCP error [{error.get('code')}]: {error.get('message')}"
+                    )
+                server_info = rpc_response.get("result", {}).get("serverInfo", {})
+                self._server_version = str(server_info.get("version", "unknown"))
+            return self._server_version
+
+    async def _extract(self, tool_name: ToolName, pdf_path: str) -> dict[str, Any]:
+        """Read a PDF and call a tool on it, through the cache when configured.
+
+        Concurrent calls for the same content and tool share one server call.
+        """
+        if self.cache is None:
+            return await self._call_tool(tool_name, pdf_path)
+
+        cache = self.cache
+        key = ResultCache.key(
+            tool_name,
+            await asyncio.to_thread(PDFUtils.hash_pdf, pdf_path),
+            await self.get_server_version(),
+        )
+
+        while (pending := self._pending.get(key)) is not None:
+            try:
+                return await asyncio.shield(pending)
+            except asyncio.CancelledError:
+                if not pending.cancelled():
+                    raise
+                # The caller computing it was cancelled; compute it here
+
+        future: asyncio.Future[dict[str, Any]] = (
+            asyncio.get_running_loop().create_future()
+        )
+        # Retrieve the exception even when no other caller waited for it
+        future.add_done_callback(lambda f: f.cancelled() or f.exception())
+        self._pending[key] = future
+        try:
+            result = await asyncio.to_thread(cache.get, key)
+            if result is None:
+                result = await self._call_tool(tool_name, pdf_path)
+                await asyncio.to_thread(cache.set, key, result)
+            future.set_result(result)
+            return result
+        except asyncio.CancelledError:
+            future.cancel()
+            raise
+        except Exception as error:
+            future.set_exception(error)
+            raise
+        finally:
+            del self._pending[key]
+
     async def extract_text(self, pdf_path: str) -> str:
         """Extract text from PDF file.
 
         This method:
         1. Reads PDF from local filesystem
-        2. Base64-encodes the content
-        3. Sends directly to MCP server via HTTP (NO LLM TOKENS USED)
+        2. Returns the cached result when a cache is configured and holds it
+        3. Otherwise streams the content, base64-encoded, directly to the
+           MCP server via HTTP (NO LLM TOKENS USED)
 
         Args:
             pdf_path: Path to local PDF file
@@ -133,21 +401,72 @@ class MCPHTTPClient:
             ValueError: If file is not a PDF or MCP error occurs
             httpx.HTTPError: On HTTP communication errors
         """
-        # Read and encode PDF (local operation - no tokens)
-        base64_content = PDFUtils.read_pdf_as_base64(pdf_path)
-
-        # Call MCP tool directly (bypasses LLM - no tokens)
-        result = await self._call_tool("extract_text", base64_content)
+        # Stream the PDF unless cached (bypasses LLM - no tokens)
+        result = await self._extract("extract_text", pdf_path)
 
         return result.get("text", "")
 
+    async def extract_text_result(
+        self,
+        pdf_path: str,
+        start_page: int | str | None = None,
+        end_page: int | str | None = None,
+    ) -> TextResult:
+        """Extract text from PDF file as a binary result, bypassing MCP.
+
+        The PDF is posted as raw bytes to the server's /extract endpoint and the
+        result comes back in the binary result format: no base64, no JSON, and
+        each page's text is a view over the response body.
+
+        Args:
+            pdf_path: Path to local PDF file
+            start_page: First page, as a 1-based number or a page label
+            end_page: Last page, as a 1-based number or a page label
+
+        Returns:
+            Decoded result with page_count, page offsets and the UTF-8 text
+
+        Raises:
+            FileNotFoundError: If PDF file doesn't exist
+            ValueError: If file is not a PDF or the response is not a binary result
+            httpx.HTTPError: On HTTP communication errors
+        """
+        content = await asyncio.to_thread(PDFUtils.read_pdf_bytes, pdf_path)
+        params = {
+            name: str(page)
+            for name, page in (("startPage", start_page), ("endPage", end_page))
+            if page is not None
+        }
+        headers = {
+            "Content-Type": "application/pdf",
+            "Accept": RESULT_FORMAT_MEDIA_TYPE,
+        }
+
+        attempt = 0
+        while True:
+            response = await self.client.post(
+                urljoin(self.base_url + "/", "extract"),
+                content=content,
+                params=params,
+                headers=headers,
+            )
+            throttled = response.status_code in RETRY_STATUS_CODES
+            if not throttled or attempt >= self.max_retries:
+                break
+            await asyncio.sleep(self._retry_delay(response, attempt))
+            attempt += 1
+        response.raise_for_status()
+
+        return decode_text_result(response.content)
+
     async def extract_metadata(self, pdf_path: str) -> dict[str, Any]:
         """Extract metadata from PDF file.
 
         This method:
         1. Reads PDF from local filesystem
-        2. Base64-encodes the content
-        3. Sends directly to MCP server via HTTP (NO LLM TOKENS USED)
+        2. Returns the cached result when a cache is configured and holds it
+        3. Otherwise streams the content, base64-encoded, directly to the
+           MCP server via HTTP (NO LLM TOKENS USED)
 
         Args:
             pdf_path: Path to local PDF file
@@ -160,15 +479,81 @@ class MCPHTTPClient:
             ValueError: If file is not a PDF or MCP error occurs
             httpx.HTTPError: On HTTP communication errors
         """
-        # Read and encode PDF (local operation - no tokens)
-        base64_content = PDFUtils.read_pdf_as_base64(pdf_path)
-
-        # Call MCP tool directly (bypasses LLM - no tokens)
-        result = await self._call_tool("extract_metadata", base64_content)
+        # Stream the PDF unless cached (bypasses LLM - no tokens)
+        result = await self._extract("extract_metadata", pdf_path)
 
         # Result is already the metadata dictionary
         return result
 
+    async def extract_many(
+        self,
+        pdf_paths: Iterable[str],
+        tool_name: ToolName = "extract_text",
+        concurrency: int = 8,
+    ) -> AsyncIterator[BatchResult]:
+        """Extract many PDFs concurrently, yielding results as they complete.
+
+        At most `concurrency` files are read and in flight at a time, and at
+        most `concurrency` finished results wait for the caller, so large or
+        lazily generated path lists are consumed gradually. Throttled calls
+        (429/503) are retried with backoff. A failing file does not stop the
+        batch; its exception is reported on its result.
+
+        Usage:
+            async for item in client.extract_many(paths, concurrency=16):
+                if item.ok:
+                    store(item.pdf_path, item.result)
+
+        Args:
+            pdf_paths: Paths to local PDF files
+            tool_name: 'extract_text' yields text, 'extract_metadata' yields metadata
+            concurrency: Files processed at once
+
+        Yields:
+            BatchResult per file, in completion order
+        """
+        paths = iter(pdf_paths)
+        # Bounded, so workers wait for a slow caller instead of running ahead
+        results: asyncio.Queue[BatchResult | None] = asyncio.Queue(
+            maxsize=max(1, concurrency)
+        )
+
+        async def worker() -> None:
+            cancelled = False
+            try:
+                for pdf_path in paths:
+                    try:
+                        result = await self._extract(tool_name, pdf_path)
+                        if tool_name == "extract_text":
+                            value: Any = result.get("text", "")
+                        else:
+                            value = result
+                        await results.put(BatchResult(pdf_path, result=value))
+                    except Exception as error:
+                        await results.put(BatchResult(pdf_path, error=error))
+            except asyncio.CancelledError:
+                # The caller stopped iterating; nobody reads the queue any more
+                cancelled = True
+                raise
+            finally:
+                if not cancelled:
+                    await results.put(None)
+
+        workers = [asyncio.create_task(worker()) for _ in range(max(1, concurrency))]
+        try:
+            remaining = len(workers)
+            while remaining > 0:
+                item = await results.get()
+                if item is None:
+                    remaining -= 1
+                else:
+                    yield item
+        finally:
+            # The caller may stop iterating early
+            for task in workers:
+                task.cancel()
+            await asyncio.gather(*workers, return_exceptions=True)
+
     async def health_check(self) -> bool:
         """Check if server is healthy.
 
@@ -1,7 +1,12 @@
 """MCP protocol helpers for JSON-RPC communication."""
 
+import json
+import uuid
 from typing import Any, TypedDict
 
+# MCP protocol revision requested on initialize
+MCP_PROTOCOL_VERSION = "2025-03-26"
+
 
 class JSONRPCRequest(TypedDict):
     """JSON-RPC 2.0 request structure."""
@@ -40,6 +45,30 @@ class MCPProtocol:
         """
         return {"jsonrpc": "2.0", "id": request_id, "method": method, "params": params}
 
+    @staticmethod
+    def create_initialize_request(
+        client_name: str, client_version: str, request_id: int | str = 1
+    ) -> JSONRPCRequest:
+        """Create an initialize request.
+
+        Args:
+            client_name: Client name reported to the server
+            client_version: Client version reported to the server
+            request_id: Request ID
+
+        Returns:
+            JSON-RPC request for initialize
+        """
+        return MCPProtocol.create_request(
+            method="initialize",
+            params={
+                "protocolVersion": MCP_PROTOCOL_VERSION,
+                "capabilities": {},
+                "clientInfo": {"name": client_name, "version": client_version},
+            },
+            request_id=request_id,
+        )
+
     @staticmethod
     def create_tool_call_request(
         tool_name: str, arguments: dict[str, Any], request_id: int | str = 1
@@ -59,3 +88,33 @@ class MCPProtocol:
             params={"name": tool_name, "arguments": arguments},
             request_id=request_id,
         )
+
+    @staticmethod
+    def create_tool_call_envelope(
+        tool_name: str,
+        content_argument: str,
+        arguments: dict[str, Any] | None = None,
+        request_id: int | str = 1,
+    ) -> tuple[bytes, bytes]:
+        """Serialize a tools/call request around one streamed string argument.
+
+        The request body is head + value + tail, where value is the argument's
+        content without quotes. It must need no JSON escaping (base64 does not).
+
+        Args:
+            tool_name: Name of the tool to call
+            content_argument: Name of the argument streamed separately
+            arguments: Other tool arguments
+            request_id: Request ID
+
+        Returns:
+            JSON bytes before and after the argument's value
+        """
+        marker = uuid.uuid4().hex
+        request = MCPProtocol.create_tool_call_request(
+            tool_name=tool_name,
+            arguments={**(arguments or {}), content_argument: marker},
+            request_id=request_id,
+        )
+        head, tail = json.dumps(request).split(marker)
+        return head.encode("utf-8"), tail.encode("utf-8")
@@ -0,0 +1,98 @@
+"""Binary text results, as served by the server's /extract endpoint.
+
+The layout is documented in the server's src/result-format.ts: a 40-byte
+little-endian header, the byte offset of each page as u32, a JSON section for
+any other result fields, then the UTF-8 text. Decoding takes memoryviews over
+the received bytes, so neither the text nor the page offsets are copied.
+"""
+
+import json
+import struct
+import sys
+from dataclasses import dataclass, field
+from typing import Any, Literal
+
+RESULT_FORMAT_MEDIA_TYPE = "application/vnd.pdf-text-mcp.result"
+
+_MAGIC = b"PTXR"
+_VERSION = 1
+_FLAG_RTL = 1
+_HEADER = struct.Struct("<4sHHIIddII")
+
+
+@dataclass
+class TextResult:
+    """Decoded binary text result; text and page_offsets are views over the input."""
+
+    page_count: int
+    processing_time: float
+    file_size: int
+    text_direction: Literal["ltr", "rtl"]
+    page_offsets: memoryview
+    text: memoryview
+    fields: dict[str, Any] = field(default_factory=dict)
+
+    def page_text(self, page: int) -> memoryview:
+        """UTF-8 bytes of one page (0-based), as a view."""
+        start = self.page_offsets[page]
+        end = (
+            self.page_offsets[page + 1]
+            if page + 1 < len(self.page_offsets)
+            else len(self.text)
+        )
+        return self.text[start:end]
+
+
+def decode_text_result(data: bytes | bytearray | memoryview) -> TextResult:
+    """Read a binary text result without copying it.
+
+    Args:
+        data: Encoded result, e.g. an HTTP response body
+
+    Returns:
+        Decoded result
+
+    Raises:
+        ValueError: If data is not a complete result of a known version
+    """
+    view = memoryview(data).cast("B")
+    if len(view) < _HEADER.size or view[:4] != _MAGIC:
+        raise ValueError("Not a binary text result")
+    (
+        _,
+        version,
+        flags,
+        page_count,
+        offset_count,
+        processing_time,
+        file_size,
+        fields_length,
+        text_length,
+    ) = _HEADER.unpack_from(view)
+    if version != _VERSION:
+        raise ValueError(f"Unsupported binary result version: {version}")
+
+    fields_start = _HEADER.size + offset_count * 4
+    text_start = fields_start + fields_length
+    if len(view) < text_start + text_length:
+        raise ValueError(
+            f"Binary result truncated: {len(view)} of {text_start + text_length} bytes"
+        )
+
+    offsets = view[_HEADER.size : fields_start]
+    if sys.byteorder == "little":
+        page_offsets = offsets.cast("I")
+    else:
+        page_offsets = memoryview(
+            struct.pack(f"={offset_count}I", *struct.unpack(f"<{offset_count}I", offsets))
+        ).cast("I")
+
+    return TextResult(
+        page_count=page_count,
+        processing_time=processing_time,
+        file_size=int(file_size),
+        text_direction="rtl" if flags & _FLAG_RTL else "ltr",
+        page_offsets=page_offsets,
+        text=view[text_start : text_start + text_length],
+        fields=json.loads(bytes(view[fields_start:text_start])) if fields_length else {},
+    )
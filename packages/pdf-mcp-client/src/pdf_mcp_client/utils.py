@@ -1,8 +1,13 @@
 """Utility functions for PDF processing."""
 
 import base64
+import hashlib
+from collections.abc import Iterator
 from pathlib import Path
 
+# Read size when streaming; a multiple of 3 so chunks encode without padding
+BASE64_CHUNK_SIZE = 3 * 256 * 1024  # 768KB
+
 
 class PDFUtils:
     """Utilities for PDF file operations."""
@@ -28,6 +33,24 @@ class PDFUtils:
             raise ValueError(f"File is not a PDF: {pdf_path}")
         return path.resolve()
 
+    @staticmethod
+    def read_pdf_bytes(pdf_path: str | Path) -> bytes:
+        """Read PDF file content.
+
+        Args:
+            pdf_path: Path to PDF file
+
+        Returns:
+            PDF content
+
+        Raises:
+            FileNotFoundError: If file doesn't exist
+            ValueError: If file is not a PDF
+        """
+        path = PDFUtils.validate_pdf_path(pdf_path)
+        with open(path, "rb") as f:
+            return f.read()
+
     @staticmethod
     def read_pdf_as_base64(pdf_path: str | Path) -> str:
         """Read PDF file and encode as base64 string.
@@ -38,14 +61,73 @@ class PDFUtils:
         Returns:
             Base64-encoded PDF content
 
+        Raises:
+            FileNotFoundError: If file doesn't exist
+            ValueError: If file is not a PDF
+        """
+        return base64.b64encode(PDFUtils.read_pdf_bytes(pdf_path)).decode("ascii")
+
+    @staticmethod
+    def iter_pdf_base64(
+        pdf_path: str | Path,
+        length: int | None = None,
+        chunk_size: int = BASE64_CHUNK_SIZE,
+    ) -> Iterator[bytes]:
+        """Read PDF file in chunks and yield its base64 encoding.
+
+        Joined, the chunks equal read_pdf_as_base64(), but at most one chunk
+        of the file is held in memory.
+
+        Args:
+            pdf_path: Path to PDF file
+            length: Bytes to encode (default: the whole file)
+            chunk_size: Bytes read at a time, rounded down to a multiple of 3
+
+        Yields:
+            Base64-encoded chunks (ASCII bytes)
+
+        Raises:
+            FileNotFoundError: If file doesn't exist
+            ValueError: If file is not a PDF, or is shorter than length
+        """
+        path = PDFUtils.validate_pdf_path(pdf_path)
+        chunk_size = max(3, chunk_size - chunk_size % 3)
+        remaining = length
+        with open(path, "rb") as f:
+            while remaining is None or remaining > 0:
+                if remaining is not None:
+                    chunk_size = min(chunk_size, remaining)
+                chunk = f.read(chunk_size)
+                if not chunk:
+                    break
+                if remaining is not None:
+                    remaining -= len(chunk)
+                yield base64.b64encode(chunk)
+        if remaining:
+            raise ValueError(f"PDF file changed while being read: {pdf_path}")
+
+    @staticmethod
+    def base64_length(size: int) -> int:
+        """Length of the base64 encoding of size bytes."""
+        return 4 * ((size + 2) // 3)
+
+    @staticmethod
+    def hash_pdf(pdf_path: str | Path) -> str:
+        """SHA-256 of PDF file content, read in chunks.
+
+        Args:
+            pdf_path: Path to PDF file
+
+        Returns:
+            Hex digest
+
         Raises:
             FileNotFoundError: If file doesn't exist
             ValueError: If file is not a PDF
         """
         path = PDFUtils.validate_pdf_path(pdf_path)
         with open(path, "rb") as f:
-            pdf_bytes = f.read()
-        return base64.b64encode(pdf_bytes).decode("ascii")
+            return hashlib.file_digest(f, "sha256").hexdigest()
 
     @staticmethod
     def get_pdf_size(pdf_path: str | Path) -> int:
@@ -0,0 +1,72 @@
+"""Unit tests for ResultCache."""
+
+from pathlib import Path
+
+from pdf_mcp_client.cache import ResultCache
+
+
+class TestResultCache:
+    """Tests for ResultCache class."""
+
+    def test_get_miss_then_hit(self, tmp_path: Path):
+        """Test that stored results are returned."""
+        cache = ResultCache(tmp_path / "cache")
+        key = ResultCache.key("extract_text", "abc", "1.0.0")
+
+        assert cache.get(key) is None
+        cache.set(key, {"text": "hello", "pageCount": 1})
+        assert cache.get(key) == {"text": "hello", "pageCount": 1}
+
+    def test_shared_between_instances(self, tmp_path: Path):
+        """Test that another instance on the same directory sees entries."""
+        key = ResultCache.key("extract_text", "abc", "1.0.0")
+        ResultCache(tmp_path).set(key, {"text": "hello"})
+
+        assert ResultCache(tmp_path).get(key) == {"text": "hello"}
+
+    def test_key_depends_on_tool_content_and_server_version(self):
+        """Test that every key component changes the key."""
+        key = ResultCache.key("extract_text", "abc", "1.0.0")
+
+        assert ResultCache.key("extract_text", "abc", "1.0.0") == key
+        assert ResultCache.key("extract_metadata", "abc", "1.0.0") != key
+        assert ResultCache.key("extract_text", "abd", "1.0.0") != key
+        assert ResultCache.key("extract_text", "abc", "1.1.0") != key
+
+    def test_prunes_to_size_limit(self, tmp_path: Path):
+        """Test that old entries are removed past max_bytes."""
+        cache = ResultCache(tmp_path, max_bytes=1000)
+        for i in range(20):
+            key = ResultCache.key("extract_text", str(i), "1.0.0")
+            cache.set(key, {"text": "x" * 100})
+
+        total = sum(path.stat().st_size for path in tmp_path.glob("*/*.json"))
+        assert 0 < total <= 1000
+        latest = ResultCache.key("extract_text", "19", "1.0.0")
+        assert cache.get(latest) == {"text": "x" * 100}
+
+    def test_rewrite_counts_the_entry_once(self, tmp_path: Path):
+        """Test that rewriting an entry does not grow the size total."""
+        cache = ResultCache(tmp_path, max_bytes=1000)
+        key = ResultCache.key("extract_text", "abc", "1.0.0")
+        for _ in range(20):
+            cache.set(key, {"text": "x" * 100})
+
+        assert cache._total_bytes == (tmp_path / key[:2] / f"{key}.json").stat().st_size
+        assert cache.get(key) == {"text": "x" * 100}
+
+    def test_clear(self, tmp_path: Path):
+        """Test that clear removes every entry."""
+        cache = ResultCache(tmp_path)
+        key = ResultCache.key("extract_text", "abc", "1.0.0")
+        cache.set(key, {"text": "hello"})
+
+        cache.clear()
+
+        assert cache.get(key) is None
+
+    def test_default_directory_honors_xdg(self, tmp_path: Path, monkeypatch):
+        """Test default_directory under XDG_CACHE_HOME."""
+        monkeypatch.setenv("XDG_CACHE_HOME", str(tmp_path))
+
+        assert ResultCache.default_directory() == tmp_path / "pdf-mcp-client"
@@ -0,0 +1,48 @@
+"""Unit tests for HedgingPolicy."""
+
+import pytest
+
+from pdf_mcp_client.hedging import HedgingPolicy
+
+
+class TestHedgingPolicy:
+    """Tests for HedgingPolicy class."""
+
+    def test_no_delay_until_enough_latencies(self):
+        """Test that requests are not hedged before latencies are known."""
+        policy = HedgingPolicy()
+        for _ in range(19):
+            policy.record(0.1)
+
+        assert policy.start_request() is None
+
+        policy.record(0.1)
+        assert policy.start_request() == pytest.approx(0.1)
+
+    def test_delay_is_percentile(self):
+        """Test that the delay is the configured latency percentile."""
+        policy = HedgingPolicy(percentile=0.95)
+        for i in range(1, 101):
+            policy.record(i / 100)
+
+        assert policy.start_request() == pytest.approx(0.95)
+
+    def test_budget_limits_hedges(self):
+        """Test that at most the budgeted share of requests is hedged."""
+        policy = HedgingPolicy(budget=0.1)
+
+        hedges = 0
+        for _ in range(100):
+            policy.start_request()
+            hedges += policy.try_hedge()
+
+        assert hedges == 10
+        assert policy.hedges == 10
+
+    def test_zero_budget_never_hedges(self):
+        """Test that a zero budget disables hedging."""
+        policy = HedgingPolicy(budget=0.0)
+        for _ in range(100):
+            policy.start_request()
+
+        assert policy.try_hedge() is False
@@ -1,12 +1,20 @@
 """Unit tests for MCPHTTPClient."""
 
+import asyncio
+import base64
+import json
+import struct
+from contextlib import aclosing
 from pathlib import Path
 
 import httpx
 import pytest
 from pytest_httpx import HTTPXMock
 
+from pdf_mcp_client.cache import ResultCache
+from pdf_mcp_client.hedging import HedgingPolicy
 from pdf_mcp_client.http_client import MCPHTTPClient
+from pdf_mcp_client.result_format import RESULT_FORMAT_MEDIA_TYPE
 
 
 class TestMCPHTTPClient:
@@ -72,6 +80,32 @@ class TestMCPHTTPClient:
 
         assert result == "Sample PDF text"
 
+    @pytest.mark.asyncio
+    async def test_extract_text_result_posts_raw_bytes(
+        self, httpx_mock: HTTPXMock, mock_pdf_file: Path
+    ):
+        """Test that extract_text_result posts the PDF and decodes a binary result."""
+        text = b"page one\n"
+        body = (
+            struct.pack("<4sHHIIddII", b"PTXR", 1, 0, 1, 1, 5.0, 16.0, 0, len(text))
+            + struct.pack("<I", 0)
+            + text
+        )
+        httpx_mock.add_response(
+            url="http://localhost:3000/extract?startPage=2",
+            method="POST",
+            content=body,
+        )
+
+        async with MCPHTTPClient("http://localhost:3000") as client:
+            result = await client.extract_text_result(str(mock_pdf_file), start_page=2)
+
+        request = httpx_mock.get_request()
+        assert request.content == b"fake pdf content"
+        assert request.headers["Accept"] == RESULT_FORMAT_MEDIA_TYPE
+        assert result.page_count == 1
+        assert bytes(result.page_text(0)) == text
+
     @pytest.mark.asyncio
     async def test_extract_text_sends_base64_content(
         self, httpx_mock: HTTPXMock, mock_pdf_file: Path
@@ -99,6 +133,34 @@ class TestMCPHTTPClient:
         assert "fileContent" in body
         assert "extract_text" in body
 
+    @pytest.mark.asyncio
+    async def test_extract_text_streams_large_file(
+        self, httpx_mock: HTTPXMock, tmp_path: Path
+    ):
+        """Test that a file larger than one chunk is sent whole, with a length."""
+        pdf_content = b"%PDF-1.4\n" + bytes(range(256)) * 8192
+        pdf_file = tmp_path / "large.pdf"
+        pdf_file.write_bytes(pdf_content)
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            json={
+                "jsonrpc": "2.0",
+                "id": 1,
+                "result": {"content": [{"type": "text", "text": '{"text": ""}'}]},
+            },
+        )
+
+        async with MCPHTTPClient("http://localhost:3000") as client:
+            await client.extract_text(str(pdf_file))
+
+        request = httpx_mock.get_request()
+        assert request is not None
+        body = request.read()
+        assert int(request.headers["Content-Length"]) == len(body)
+        assert "Transfer-Encoding" not in request.headers
+        arguments = json.loads(body)["params"]["arguments"]
+        assert base64.b64decode(arguments["fileContent"]) == pdf_content
+
     @pytest.mark.asyncio
     async def test_extract_metadata_success(
         self, httpx_mock: HTTPXMock, mock_pdf_file: Path
@@ -309,3 +371,283 @@ class TestMCPHTTPClient:
             result = await client.extract_metadata(str(mock_pdf_file))
 
         assert result == {}
+
+    @pytest.mark.asyncio
+    async def test_extract_text_retries_after_429(
+        self, httpx_mock: HTTPXMock, mock_pdf_file: Path
+    ):
+        """Test that throttled calls are retried after Retry-After."""
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            status_code=429,
+            headers={"Retry-After": "0"},
+        )
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            json={
+                "jsonrpc": "2.0",
+                "id": 1,
+                "result": {"content": [{"type": "text", "text": '{"text": "ok"}'}]},
+            },
+        )
+
+        async with MCPHTTPClient("http://localhost:3000") as client:
+            result = await client.extract_text(str(mock_pdf_file))
+
+        assert result == "ok"
+        assert len(httpx_mock.get_requests()) == 2
+
+    @pytest.mark.asyncio
+    async def test_extract_text_gives_up_after_max_retries(
+        self, httpx_mock: HTTPXMock, mock_pdf_file: Path
+    ):
+        """Test that a call stays throttled only up to max_retries."""
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            status_code=503,
+            headers={"Retry-After": "0"},
+            is_reusable=True,
+        )
+
+        async with MCPHTTPClient("http://localhost:3000", max_retries=2) as client:
+            with pytest.raises(httpx.HTTPStatusError):
+                await client.extract_text(str(mock_pdf_file))
+
+        assert len(httpx_mock.get_requests()) == 3
+
+    @pytest.mark.asyncio
+    async def test_extract_many_streams_results(
+        self, httpx_mock: HTTPXMock, tmp_path: Path
+    ):
+        """Test extract_many with bounded concurrency and per-file errors."""
+        paths = []
+        for i in range(6):
+            pdf_file = tmp_path / f"doc{i}.pdf"
+            pdf_file.write_bytes(b"fake pdf content")
+            paths.append(str(pdf_file))
+        paths.append(str(tmp_path / "missing.pdf"))
+
+        in_flight = 0
+        max_in_flight = 0
+
+        async def respond(request: httpx.Request) -> httpx.Response:
+            nonlocal in_flight, max_in_flight
+            in_flight += 1
+            max_in_flight = max(max_in_flight, in_flight)
+            await asyncio.sleep(0.01)
+            in_flight -= 1
+            return httpx.Response(
+                200,
+                json={
+                    "jsonrpc": "2.0",
+                    "id": 1,
+                    "result": {
+                        "content": [{"type": "text", "text": '{"text": "page"}'}]
+                    },
+                },
+            )
+
+        httpx_mock.add_callback(
+            respond, url="http://localhost:3000/mcp", is_reusable=True
+        )
+
+        async with MCPHTTPClient("http://localhost:3000") as client:
+            results = [
+                item async for item in client.extract_many(paths, concurrency=2)
+            ]
+
+        assert sorted(item.pdf_path for item in results) == sorted(paths)
+        succeeded = [item for item in results if item.ok]
+        failed = [item for item in results if not item.ok]
+        assert len(succeeded) == 6
+        assert all(item.result == "page" for item in succeeded)
+        assert len(failed) == 1
+        assert isinstance(failed[0].error, FileNotFoundError)
+        assert max_in_flight == 2
+
+    @pytest.mark.asyncio
+    async def test_extract_many_waits_for_a_slow_caller(
+        self, httpx_mock: HTTPXMock, tmp_path: Path
+    ):
+        """Test that extract_many does not run ahead of its caller."""
+        pdf_file = tmp_path / "doc.pdf"
+        pdf_file.write_bytes(b"fake pdf content")
+        pulled = 0
+
+        def paths():
+            nonlocal pulled
+            for _ in range(50):
+                pulled += 1
+                yield str(pdf_file)
+
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            json={
+                "jsonrpc": "2.0",
+                "id": 1,
+                "result": {"content": [{"type": "text", "text": '{"text": "page"}'}]},
+            },
+            is_reusable=True,
+        )
+
+        async with MCPHTTPClient("http://localhost:3000") as client:
+            async with aclosing(client.extract_many(paths(), concurrency=2)) as items:
+                async for item in items:
+                    assert item.ok
+                    await asyncio.sleep(0.1)
+                    break
+
+        # One consumed, two queued and one finished result per blocked worker
+        assert pulled <= 5
+
+    @pytest.mark.asyncio
+    async def test_cache_hit_skips_server(
+        self, httpx_mock: HTTPXMock, mock_pdf_file: Path, tmp_path: Path
+    ):
+        """Test that a cached result is served without a request."""
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            json={
+                "jsonrpc": "2.0",
+                "id": 1,
+                "result": {"content": [{"type": "text", "text": '{"text": "cached"}'}]},
+            },
+        )
+        cache = ResultCache(tmp_path / "cache")
+        copy = tmp_path / "copy.pdf"
+        copy.write_bytes(mock_pdf_file.read_bytes())
+
+        async with MCPHTTPClient(
+            "http://localhost:3000", cache=cache, server_version="1.0.0"
+        ) as client:
+            first = await client.extract_text(str(mock_pdf_file))
+            # Same content under another name
+            second = await client.extract_text(str(copy))
+
+        assert first == second == "cached"
+        assert len(httpx_mock.get_requests()) == 1
+
+    @pytest.mark.asyncio
+    async def test_cache_coalesces_concurrent_misses(
+        self, httpx_mock: HTTPXMock, mock_pdf_file: Path, tmp_path: Path
+    ):
+        """Test that concurrent calls for the same content share one request."""
+
+        async def respond(request: httpx.Request) -> httpx.Response:
+            await asyncio.sleep(0.01)
+            return httpx.Response(
+                200,
+                json={
+                    "jsonrpc": "2.0",
+                    "id": 1,
+                    "result": {
+                        "content": [{"type": "text", "text": '{"text": "once"}'}]
+                    },
+                },
+            )
+
+        httpx_mock.add_callback(respond, url="http://localhost:3000/mcp")
+
+        async with MCPHTTPClient(
+            "http://localhost:3000",
+            cache=ResultCache(tmp_path / "cache"),
+            server_version="1.0.0",
+        ) as client:
+            results = await asyncio.gather(
+                *(client.extract_text(str(mock_pdf_file)) for _ in range(5))
+            )
+
+        assert results == ["once"] * 5
+        assert len(httpx_mock.get_requests()) == 1
+
+    @pytest.mark.asyncio
+    async def test_cache_key_uses_server_version(
+        self, httpx_mock: HTTPXMock, mock_pdf_file: Path, tmp_path: Path
+    ):
+        """Test that the server version is asked once, via initialize."""
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            match_json={
+                "jsonrpc": "2.0",
+                "id": 1,
+                "method": "initialize",
+                "params": {
+                    "protocolVersion": "2025-03-26",
+                    "capabilities": {},
+                    "clientInfo": {"name": "pdf-mcp-client", "version": "0.1.0"},
+                },
+            },
+            json={
+                "jsonrpc": "2.0",
+                "id": 1,
+                "result": {
+                    "serverInfo": {"name": "pdf-text-mcp-server", "version": "1.0.0"}
+                },
+            },
+        )
+        httpx_mock.add_response(
+            url="http://localhost:3000/mcp",
+            json={
+                "jsonrpc": "2.0",
+                "id": 2,
+                "result": {"content": [{"type": "text", "text": '{"pageCount": 1}'}]},
+            },
+        )
+
+        async with MCPHTTPClient(
+            "http://localhost:3000", cache=ResultCache(tmp_path / "cache")
+        ) as client:
+            assert await client.extract_metadata(str(mock_pdf_file)) == {"pageCount": 1}
+            assert await client.extract_metadata(str(mock_pdf_file)) == {"pageCount": 1}
+            assert await client.get_server_version() == "1.0.0"
+
+        assert len(httpx_mock.get_requests()) == 2
+
+    @pytest.mark.asyncio
+    async def test_slow_call_is_hedged_to_another_endpoint(
+        self, httpx_mock: HTTPXMock, mock_pdf_file: Path
+    ):
+        """Test that a call slower than p95 is duplicated and the first wins."""
+
+        def respond(text: str, delay: float):
+            async def callback(request: httpx.Request) -> httpx.Response:
+                await asyncio.sleep(delay)
+                return httpx.Response(
+                    200,
+                    json={
+                        "jsonrpc": "2.0",
+                        "id": 1,
+                        "result": {
+                            "content": [
+                                {"type": "text", "text": json.dumps({"text": text})}
+                            ]
+                        },
+                    },
+                )
+
+            return callback
+
+        httpx_mock.add_callback(respond("slow", 5.0), url="http://replica-a:3000/mcp")
+        httpx_mock.add_callback(respond("fast", 0.0), url="http://replica-b:3000/mcp")
+
+        hedging = HedgingPolicy(budget=1.0)
+        for _ in range(20):
+            hedging.record(0.05)
+        recorded: list[float] = []
+        record = hedging.record
+        hedging.record = lambda seconds: (recorded.append(seconds), record(seconds))[1]
+
+        async with MCPHTTPClient(
+            "http://replica-a:3000",
+            hedging=hedging,
+            hedge_urls=["http://replica-b:3000"],
+        ) as client:
+            text = await asyncio.wait_for(client.extract_text(str(mock_pdf_file)), 2.0)
+
+        assert text == "fast"
+        assert hedging.hedges == 1
+        assert hedging.hedge_wins == 1
+        # The winner counts from the original send, not from the hedge; the
+        # cancelled primary adds a lower bound, also past the hedging delay
+        assert len(recorded) == 2
+        assert all(seconds >= 0.05 for seconds in recorded)
@@ -1,5 +1,7 @@
 """Unit tests for MCPProtocol."""
 
+import json
+
 from pdf_mcp_client.protocol import MCPProtocol
 
 
@@ -72,6 +74,41 @@ class TestMCPProtocol:
 
         assert result["params"] == complex_params
 
+    def test_create_initialize_request(self):
+        """Test create_initialize_request structure."""
+        result = MCPProtocol.create_initialize_request(
+            "pdf-mcp-client", "0.1.0", request_id=7
+        )
+
+        assert result == {
+            "jsonrpc": "2.0",
+            "id": 7,
+            "method": "initialize",
+            "params": {
+                "protocolVersion": "2025-03-26",
+                "capabilities": {},
+                "clientInfo": {"name": "pdf-mcp-client", "version": "0.1.0"},
+            },
+        }
+
+    def test_create_tool_call_envelope(self):
+        """Test create_tool_call_envelope wraps a streamed argument."""
+        head, tail = MCPProtocol.create_tool_call_envelope(
+            tool_name="extract_text",
+            content_argument="fileContent",
+            request_id=3,
+        )
+
+        assert json.loads(head + b"SGVsbG8=" + tail) == {
+            "jsonrpc": "2.0",
+            "id": 3,
+            "method": "tools/call",
+            "params": {
+                "name": "extract_text",
+                "arguments": {"fileContent": "SGVsbG8="},
+            },
+        }
+
     def test_create_tool_call_request_basic(self):
         """Test create_tool_call_request with basic parameters."""
         result = MCPProtocol.create_tool_call_request(
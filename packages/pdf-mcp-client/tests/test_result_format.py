@@ -0,0 +1,76 @@
+"""Unit tests for binary text results."""
+
+import json
+import struct
+
+import pytest
+
+from pdf_mcp_client.result_format import decode_text_result
+
+
+def encode(pages: list[str], fields: dict | None = None, rtl: bool = False) -> bytes:
+    """Encode a result the way the server does."""
+    page_bytes = [page.encode("utf-8") for page in pages]
+    offsets = [sum(len(page) for page in page_bytes[:i]) for i in range(len(page_bytes))]
+    text = b"".join(page_bytes)
+    fields_bytes = json.dumps(fields).encode("utf-8") if fields else b""
+    header = struct.pack(
+        "<4sHHIIddII",
+        b"PTXR",
+        1,
+        1 if rtl else 0,
+        len(pages),
+        len(offsets),
+        12.5,
+        2048.0,
+        len(fields_bytes),
+        len(text),
+    )
+    return header + struct.pack(f"<{len(offsets)}I", *offsets) + fields_bytes + text
+
+
+class TestDecodeTextResult:
+    """Tests for decode_text_result."""
+
+    def test_decode_fields_and_pages(self):
+        """Test that header fields, page texts and other fields are decoded."""
+        data = encode(["שלום one\n", "two\n"], {"reusedPageCount": 1}, rtl=True)
+
+        result = decode_text_result(data)
+
+        assert result.page_count == 2
+        assert result.processing_time == 12.5
+        assert result.file_size == 2048
+        assert result.text_direction == "rtl"
+        assert result.fields == {"reusedPageCount": 1}
+        assert bytes(result.page_text(0)).decode("utf-8") == "שלום one\n"
+        assert bytes(result.page_text(1)) == b"two\n"
+
+    def test_text_is_a_view(self):
+        """Test that the text shares memory with the input."""
+        data = bytearray(encode(["page\n"]))
+
+        result = decode_text_result(data)
+        data[-2] = ord("E")
+
+        assert bytes(result.text) == b"pagE\n"
+
+    def test_decode_without_offsets(self):
+        """Test a result without page offsets or other fields."""
+        data = encode([])
+
+        result = decode_text_result(data)
+
+        assert len(result.page_offsets) == 0
+        assert result.fields == {}
+        assert result.text_direction == "ltr"
+
+    def test_reject_truncated(self):
+        """Test that a truncated result is rejected."""
+        with pytest.raises(ValueError, match="truncated"):
+            decode_text_result(encode(["page\n"])[:-1])
+
+    def test_reject_foreign_data(self):
+        """Test that data that is not a binary result is rejected."""
+        with pytest.raises(ValueError, match="Not a binary text result"):
+            decode_text_result(b'{"text": "json"}'.ljust(64))
@@ -1,6 +1,7 @@
 """Unit tests for PDFUtils."""
 
 import base64
+import hashlib
 from pathlib import Path
 
 import pytest
@@ -96,6 +97,34 @@ class TestPDFUtils:
         with pytest.raises(ValueError, match="File is not a PDF"):
             PDFUtils.read_pdf_as_base64(txt_file)
 
+    def test_iter_pdf_base64_matches_whole_encoding(self, tmp_path: Path):
+        """Test iter_pdf_base64 chunks join to the whole-file encoding."""
+        pdf_content = bytes(range(256)) * 41
+        pdf_file = tmp_path / "test.pdf"
+        pdf_file.write_bytes(pdf_content)
+
+        chunks = list(PDFUtils.iter_pdf_base64(pdf_file, chunk_size=1000))
+
+        assert len(chunks) > 1
+        assert b"".join(chunks) == base64.b64encode(pdf_content)
+        assert PDFUtils.base64_length(len(pdf_content)) == len(b"".join(chunks))
+
+    def test_iter_pdf_base64_file_shorter_than_length(self, tmp_path: Path):
+        """Test iter_pdf_base64 raises when the file shrank."""
+        pdf_file = tmp_path / "test.pdf"
+        pdf_file.write_bytes(b"fake pdf content")
+
+        with pytest.raises(ValueError, match="changed while being read"):
+            list(PDFUtils.iter_pdf_base64(pdf_file, length=100))
+
+    def test_hash_pdf(self, tmp_path: Path):
+        """Test hash_pdf returns the SHA-256 of the content."""
+        pdf_file = tmp_path / "test.pdf"
+        pdf_file.write_bytes(b"fake pdf content")
+
+        expected = hashlib.sha256(b"fake pdf content").hexdigest()
+        assert PDFUtils.hash_pdf(pdf_file) == expected
+
     def test_get_pdf_size(self, tmp_path: Path):
         """Test get_pdf_size returns correct file size."""
         pdf_content = b"fake pdf content"
@@ -0,0 +1,99 @@
+import { ConcurrencyLimiter, ConcurrencyPermit } from '../src/concurrency-limiter';
+import { PdfErrorCode } from '../src/types';
+
+const MB = 1024 * 1024;
+
+describe('ConcurrencyLimiter', () => {
+  let now: number;
+
+  beforeEach(() => {
+    now = 0;
+    jest.spyOn(Date, 'now').mockImplementation(() => now);
+  });
+
+  afterEach(() => {
+    jest.restoreAllMocks();
+  });
+
+  /**
+   * Run rounds of `limit` concurrent extractions, each taking msPerMb for 1MB
+   */
+  async function runRounds(limiter: ConcurrencyLimiter, rounds: number, msPerMb: number) {
+    for (let round = 0; round < rounds; round++) {
+      const permits = await Promise.all(
+        Array.from({ length: limiter.limit }, () => limiter.acquire(1000))
+      );
+      now += msPerMb;
+      permits.forEach((permit) => permit.success(MB));
+    }
+  }
+
+  it('should queue acquisitions over the limit and grant them in order', async () => {
+    const limiter = new ConcurrencyLimiter({ initialLimit: 2, maxLimit: 2 });
+    const first = await limiter.acquire(1000);
+    await limiter.acquire(1000);
+
+    const granted: number[] = [];
+    const third = limiter.acquire(1000).then((permit) => {
+      granted.push(3);
+      return permit;
+    });
+    const fourth = limiter.acquire(1000).then(() => granted.push(4));
+    expect(limiter.stats).toEqual({ limit: 2, inFlight: 2, queued: 2 });
+
+    first.ignore();
+    (await third).ignore();
+    await fourth;
+
+    expect(granted).toEqual([3, 4]);
+    expect(limiter.stats).toEqual({ limit: 2, inFlight: 2, queued: 0 });
+  });
+
+  it('should reject with TIMEOUT when the queue wait exceeds the timeout', async () => {
+    jest.restoreAllMocks();
+    const limiter = new ConcurrencyLimiter({ initialLimit: 1, maxLimit: 1 });
+    const held: ConcurrencyPermit = await limiter.acquire(1000);
+
+    await expect(limiter.acquire(10)).rejects.toMatchObject({ code: PdfErrorCode.TIMEOUT });
+    expect(limiter.stats.queued).toBe(0);
+    held.ignore();
+  });
+
+  it('should raise the limit while the extraction cost holds steady', async () => {
+    const limiter = new ConcurrencyLimiter({ initialLimit: 4, maxLimit: 32 });
+
+    await runRounds(limiter, 20, 100);
+
+    expect(limiter.limit).toBeGreaterThan(4);
+    expect(limiter.limit).toBeLessThanOrEqual(32);
+  });
+
+  it('should lower the limit when the extraction cost rises', async () => {
+    const limiter = new ConcurrencyLimiter({ initialLimit: 32, maxLimit: 32 });
+    await runRounds(limiter, 5, 100);
+    const before = limiter.limit;
+
+    await runRounds(limiter, 5, 800);
+
+    expect(limiter.limit).toBeLessThan(before);
+  });
+
+  it('should back off after a timeout', async () => {
+    const limiter = new ConcurrencyLimiter({ initialLimit: 10, maxLimit: 10 });
+
+    (await limiter.acquire(1000)).dropped();
+
+    expect(limiter.limit).toBe(9);
+  });
+
+  it('should not change the limit for failed or underused extractions', async () => {
+    const limiter = new ConcurrencyLimiter({ initialLimit: 8, maxLimit: 32 });
+
+    (await limiter.acquire(1000)).ignore();
+    const permit = await limiter.acquire(1000);
+    now += 100;
+    permit.success(MB);
+
+    expect(limiter.limit).toBe(8);
+  });
+});
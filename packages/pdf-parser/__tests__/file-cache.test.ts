@@ -0,0 +1,56 @@
+import { promises as fs } from 'fs';
+import * as path from 'path';
+import * as os from 'os';
+import { FileResultCache, sameIdentity, statIdentity } from '../src/file-cache';
+
+describe('File cache', () => {
+  let tempDir: string;
+
+  beforeAll(async () => {
+    tempDir = await fs.mkdtemp(path.join(os.tmpdir(), 'file-cache-test-'));
+  });
+
+  afterAll(async () => {
+    await fs.rm(tempDir, { recursive: true, force: true });
+  });
+
+  describe('statIdentity', () => {
+    it('should be stable while a file is unchanged', async () => {
+      const filePath = path.join(tempDir, 'stable.pdf');
+      await fs.writeFile(filePath, '%PDF-1.7\nstable');
+
+      expect(sameIdentity(await statIdentity(filePath), await statIdentity(filePath))).toBe(true);
+    });
+
+    it('should change when a file is touched or replaced', async () => {
+      const filePath = path.join(tempDir, 'changing.pdf');
+      await fs.writeFile(filePath, '%PDF-1.7\nfirst');
+      const original = await statIdentity(filePath);
+
+      const later = new Date(Date.now() + 60000);
+      await fs.utimes(filePath, later, later);
+      expect(sameIdentity(original, await statIdentity(filePath))).toBe(false);
+
+      const replacement = path.join(tempDir, 'replacement.pdf');
+      await fs.writeFile(replacement, '%PDF-1.7\nfirst');
+      await fs.rename(replacement, filePath);
+      expect(sameIdentity(original, await statIdentity(filePath))).toBe(false);
+    });
+  });
+
+  describe('FileResultCache', () => {
+    it('should evict the least recently used path', () => {
+      const identity = { dev: 1n, ino: 1n, size: 1n, mtimeNs: 1n };
+      const cache = new FileResultCache(2);
+      cache.set('/a.pdf', { identity });
+      cache.set('/b.pdf', { identity });
+      cache.get('/a.pdf');
+      cache.set('/c.pdf', { identity });
+
+      expect(cache.size).toBe(2);
+      expect(cache.get('/a.pdf')).toBeDefined();
+      expect(cache.get('/b.pdf')).toBeUndefined();
+      expect(cache.get('/c.pdf')).toBeDefined();
+    });
+  });
+});
@@ -0,0 +1,47 @@
+import { LshIndex, estimateSimilarity } from '../src/lsh-index';
+
+function signature(length: number, seed: number): number[] {
+  return Array.from({ length }, (_, i) => (i + 1) * 7919 + seed);
+}
+
+describe('LshIndex', () => {
+  describe('estimateSimilarity', () => {
+    it('should return the fraction of equal values', () => {
+      expect(estimateSimilarity([1, 2, 3, 4], [1, 2, 0, 0])).toBe(0.5);
+      expect(estimateSimilarity([], [])).toBe(0);
+    });
+  });
+
+  it('should find a near-duplicate sharing a band', () => {
+    const index = new LshIndex({ bands: 4, rowsPerBand: 2 });
+    const original = signature(8, 0);
+    const revised = [...original.slice(0, 6), -1, -2];
+
+    index.add('original', original);
+
+    expect(index.query(revised, 0.7)).toEqual([{ id: 'original', similarity: 0.75 }]);
+    expect(index.query(revised, 0.8)).toEqual([]);
+  });
+
+  it('should not return documents without a matching band', () => {
+    const index = new LshIndex({ bands: 4, rowsPerBand: 2 });
+    index.add('a', signature(8, 0));
+
+    expect(index.query(signature(8, 1), 0)).toEqual([]);
+  });
+
+  it('should drop the oldest documents beyond maxEntries', () => {
+    const index = new LshIndex({ bands: 2, rowsPerBand: 2, maxEntries: 1 });
+    index.add('first', signature(4, 0));
+    index.add('second', signature(4, 1));
+
+    expect(index.size).toBe(1);
+    expect(index.query(signature(4, 0), 0)).toEqual([]);
+    expect(index.query(signature(4, 1), 1)).toEqual([{ id: 'second', similarity: 1 }]);
+  });
+
+  it('should reject signatures shorter than bands * rowsPerBand', () => {
+    const index = new LshIndex({ bands: 4, rowsPerBand: 2 });
+    expect(() => index.add('short', [1, 2, 3])).toThrow('Signature too short');
+  });
+});
@@ -0,0 +1,54 @@
+import { withSectionSpans, findSection } from '../src/outline';
+
+describe('Outline helpers', () => {
+  const entries = withSectionSpans(
+    [
+      { title: 'Introduction', level: 0, pageNumber: 1 },
+      { title: 'Section 4: Termination', level: 0, pageNumber: 37 },
+      { title: '4.1 Notice', level: 1, pageNumber: 38 },
+      { title: '4.2 Effect', level: 1, pageNumber: 40 },
+      { title: 'Broken link', level: 1, pageNumber: null },
+      { title: 'Section 5: Governing Law', level: 0, pageNumber: 42 },
+      { title: 'Signatures', level: 0, pageNumber: 42 },
+    ],
+    50
+  );
+
+  describe('withSectionSpans', () => {
+    it('should end a section before the next entry at the same or a shallower level', () => {
+      expect(entries[1].endPageNumber).toBe(41);
+      expect(entries[2].endPageNumber).toBe(39);
+      expect(entries[3].endPageNumber).toBe(41);
+    });
+
+    it('should keep a shared start page with the earlier section', () => {
+      expect(entries[5].endPageNumber).toBe(42);
+    });
+
+    it('should run the last section to the end of the document', () => {
+      expect(entries[6].endPageNumber).toBe(50);
+    });
+
+    it('should leave unresolved entries without a span', () => {
+      expect(entries[4].endPageNumber).toBeNull();
+    });
+  });
+
+  describe('findSection', () => {
+    it('should prefer an exact title match', () => {
+      expect(findSection(entries, 'signatures')?.pageNumber).toBe(42);
+    });
+
+    it('should match a title prefix', () => {
+      expect(findSection(entries, 'Section  4')?.title).toBe('Section 4: Termination');
+    });
+
+    it('should match a title substring', () => {
+      expect(findSection(entries, 'governing law')?.title).toBe('Section 5: Governing Law');
+    });
+
+    it('should skip entries without a resolvable page', () => {
+      expect(findSection(entries, 'Broken link')).toBeUndefined();
+    });
+  });
+});
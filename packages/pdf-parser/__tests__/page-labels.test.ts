@@ -0,0 +1,61 @@
+import { PageLabelRange, expandPageLabels, resolvePageLabel } from '../src/page-labels';
+
+describe('Page label helpers', () => {
+  // Front matter i-iv, body 1-10, appendix A-1..A-3, a cover and a back page
+  const ranges: PageLabelRange[] = [
+    { startPage: 1, style: null, prefix: 'Cover', firstNumber: 1 },
+    { startPage: 2, style: 'r', prefix: '', firstNumber: 1 },
+    { startPage: 6, style: 'D', prefix: '', firstNumber: 1 },
+    { startPage: 16, style: 'D', prefix: 'A-', firstNumber: 1 },
+    { startPage: 19, style: 'A', prefix: '', firstNumber: 26 },
+  ];
+  const pageCount = 20;
+
+  describe('expandPageLabels', () => {
+    it('should label every page from its range', () => {
+      const labels = expandPageLabels(ranges, pageCount);
+
+      expect(labels).toHaveLength(pageCount);
+      expect(labels.slice(0, 7)).toEqual(['Cover', 'i', 'ii', 'iii', 'iv', '1', '2']);
+      expect(labels.slice(15)).toEqual(['A-1', 'A-2', 'A-3', 'Z', 'AA']);
+    });
+
+    it('should label pages before the first range with page numbers', () => {
+      const lateRanges: PageLabelRange[] = [
+        { startPage: 3, style: 'R', prefix: '', firstNumber: 4 },
+      ];
+
+      expect(expandPageLabels(lateRanges, 4)).toEqual(['1', '2', 'IV', 'V']);
+    });
+  });
+
+  describe('resolvePageLabel', () => {
+    it('should resolve labels to page numbers', () => {
+      expect(resolvePageLabel(ranges, pageCount, 'Cover')).toBe(1);
+      expect(resolvePageLabel(ranges, pageCount, 'iii')).toBe(4);
+      expect(resolvePageLabel(ranges, pageCount, '10')).toBe(15);
+      expect(resolvePageLabel(ranges, pageCount, 'A-2')).toBe(17);
+      expect(resolvePageLabel(ranges, pageCount, 'AA')).toBe(20);
+    });
+
+    it('should agree with expandPageLabels for every page', () => {
+      expandPageLabels(ranges, pageCount).forEach((label, i) => {
+        expect(resolvePageLabel(ranges, pageCount, label)).toBe(i + 1);
+      });
+    });
+
+    it('should reject labels no page carries', () => {
+      expect(resolvePageLabel(ranges, pageCount, '11')).toBeUndefined();
+      expect(resolvePageLabel(ranges, pageCount, 'v')).toBeUndefined();
+      expect(resolvePageLabel(ranges, pageCount, 'IV')).toBeUndefined();
+      expect(resolvePageLabel(ranges, pageCount, '011')).toBeUndefined();
+      expect(resolvePageLabel(ranges, pageCount, 'A-4')).toBeUndefined();
+    });
+
+    it('should treat labels as page numbers when the document has none', () => {
+      expect(resolvePageLabel(null, 5, '3')).toBe(3);
+      expect(resolvePageLabel(null, 5, '6')).toBeUndefined();
+      expect(resolvePageLabel(null, 5, 'iii')).toBeUndefined();
+    });
+  });
+});
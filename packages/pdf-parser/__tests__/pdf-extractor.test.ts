@@ -1,8 +1,143 @@
 import { promises as fs } from 'fs';
 import * as path from 'path';
 import * as os from 'os';
-import { PdfExtractor } from '../src/pdf-extractor';
-import { PdfExtractionError, PdfErrorCode } from '../src/types';
+import { deflateRawSync } from 'zlib';
+import { PdfExtractor, warmup } from '../src/pdf-extractor';
+import { PdfArchiveEntryResult, PdfExtractionError, PdfErrorCode } from '../src/types';
+import { estimateSimilarity } from '../src/lsh-index';
+
+function crc32(data: Buffer): number {
+  let crc = 0xffffffff;
+  for (const byte of data) {
+    crc ^= byte;
+    for (let bit = 0; bit < 8; bit++) {
+      crc = crc & 1 ? (crc >>> 1) ^ 0xedb88320 : crc >>> 1;
+    }
+  }
+  return (crc ^ 0xffffffff) >>> 0;
+}
+
+/**
+ * Build a zip archive of deflated entries
+ */
+function createZip(entries: { name: string; data: Buffer }[]): Buffer {
+  const localParts: Buffer[] = [];
+  const centralParts: Buffer[] = [];
+  let offset = 0;
+
+  for (const { name, data } of entries) {
+    const nameBytes = Buffer.from(name);
+    const compressed = deflateRawSync(data);
+    const fields = Buffer.alloc(16);
+    fields.writeUInt32LE(crc32(data), 0);
+    fields.writeUInt32LE(compressed.length, 4);
+    fields.writeUInt32LE(data.length, 8);
+    fields.writeUInt16LE(nameBytes.length, 12);
+
+    const local = Buffer.alloc(30);
+    local.writeUInt32LE(0x04034b50, 0);
+    local.writeUInt16LE(20, 4);
+    local.writeUInt16LE(8, 8);
+    fields.copy(local, 14);
+    localParts.push(local, nameBytes, compressed);
+
+    const central = Buffer.alloc(46);
+    central.writeUInt32LE(0x02014b50, 0);
+    central.writeUInt16LE(20, 4);
+    central.writeUInt16LE(20, 6);
+    central.writeUInt16LE(8, 10);
+    fields.copy(central, 16);
+    central.writeUInt32LE(offset, 42);
+    centralParts.push(central, nameBytes);
+
+    offset += local.length + nameBytes.length + compressed.length;
+  }
+
+  const centralDirectory = Buffer.concat(centralParts);
+  const end = Buffer.alloc(22);
+  end.writeUInt32LE(0x06054b50, 0);
+  end.writeUInt16LE(entries.length, 8);
+  end.writeUInt16LE(entries.length, 10);
+  end.writeUInt32LE(centralDirectory.length, 12);
+  end.writeUInt32LE(offset, 16);
+  return Buffer.concat([...localParts, centralDirectory, end]);
+}
+
+/**
+ * Wrap data in a PDF stream object body
+ */
+function pdfStream(dictionary: string, data: string): string {
+  const entries = [dictionary, `/Length ${Buffer.byteLength(data, 'latin1')}`].filter(Boolean);
+  return `<< ${entries.join(' ')} >>\nstream\n${data}\nendstream`;
+}
+
+/**
+ * Build a PDF with classic xref tables. Object n is bodies[n - 1], the catalog
+ * being object 1. Each update is appended as an incremental section chained by
+ * /Prev, replacing its objects, or marking them free when the body is null.
+ */
+function buildPdf(bodies: string[], updates: Map<number, string | null>[] = []): Buffer {
+  let pdf = '%PDF-1.4\n';
+  const size = bodies.length + 1;
+  const offsetEntry = (offset: number) => `${String(offset).padStart(10, '0')} 00000 n \n`;
+
+  const writeObjects = (objects: [number, string | null][]) => {
+    const offsets = new Map<number, number>();
+    for (const [id, body] of objects) {
+      if (body !== null) {
+        offsets.set(id, Buffer.byteLength(pdf, 'latin1'));
+        pdf += `${id} 0 obj\n${body}\nendobj\n`;
+      }
+    }
+    return offsets;
+  };
+  const writeTrailer = (xrefOffset: number, prev?: number) => {
+    const prevEntry = prev === undefined ? '' : ` /Prev ${prev}`;
+    pdf += `trailer\n<< /Size ${size} /Root 1 0 R${prevEntry} >>\n`;
+    pdf += `startxref\n${xrefOffset}\n%%EOF\n`;
+  };
+
+  const offsets = writeObjects(bodies.map((body, i) => [i + 1, body]));
+  let xrefOffset = Buffer.byteLength(pdf, 'latin1');
+  pdf += `xref\n0 ${size}\n0000000000 65535 f \n`;
+  for (let id = 1; id < size; id++) {
+    pdf += offsetEntry(offsets.get(id) as number);
+  }
+  writeTrailer(xrefOffset);
+
+  for (const update of updates) {
+    const objects = [...update.entries()].sort(([a], [b]) => a - b);
+    const updateOffsets = writeObjects(objects);
+    const prev = xrefOffset;
+    xrefOffset = Buffer.byteLength(pdf, 'latin1');
+    pdf += 'xref\n';
+    for (const [id, body] of objects) {
+      pdf += `${id} 1\n`;
+      pdf += body === null ? '0000000000 00001 f \n' : offsetEntry(updateOffsets.get(id) as number);
+    }
+    writeTrailer(xrefOffset, prev);
+  }
+
+  return Buffer.from(pdf, 'latin1');
+}
+
+/**
+ * A one-page PDF showing only an image, without any text
+ */
+function imageOnlyPdf(pixels: string): Buffer {
+  return buildPdf([
+    '<< /Type /Catalog /Pages 2 0 R >>',
+    '<< /Type /Pages /Kids [3 0 R] /Count 1 >>',
+    '<< /Type /Page /Parent 2 0 R /MediaBox [0 0 200 200] ' +
+      '/Resources << /XObject << /Im1 5 0 R >> >> /Contents 4 0 R >>',
+    pdfStream('', 'q 100 0 0 100 50 50 cm /Im1 Do Q'),
+    pdfStream(
+      `/Type /XObject /Subtype /Image /Width ${pixels.length} /Height 1 ` +
+        '/ColorSpace /DeviceGray /BitsPerComponent 8',
+      pixels
+    ),
+  ]);
+}
 
 describe('PdfExtractor', () => {
   let tempDir: string;
@@ -98,6 +233,298 @@ describe('PdfExtractor', () => {
     });
   });
 
+  describe('pageWorkers', () => {
+    it('should produce the same text as sequential extraction', async () => {
+      // HebrewRTL.pdf has enough pages to be split across helper threads
+      const hebrewPdfPath = path.join(__dirname, '../../../test-materials/HebrewRTL.pdf');
+      const parallelExtractor = new PdfExtractor({ pageWorkers: 2 });
+
+      const sequential = await extractor.extractText(hebrewPdfPath);
+      const parallel = await parallelExtractor.extractText(hebrewPdfPath);
+
+      expect(parallel.pageCount).toBe(sequential.pageCount);
+      expect(parallel.textDirection).toBe(sequential.textDirection);
+      expect(parallel.text).toBe(sequential.text);
+    });
+
+    it('should fall back to sequential extraction for short documents', async () => {
+      const parallelExtractor = new PdfExtractor({ pageWorkers: 4 });
+
+      const result = await parallelExtractor.extractText(realPdfPath);
+
+      expect(result.text).toContain('Paths');
+      expect(result.pageCount).toBeGreaterThan(0);
+    });
+  });
+
+  describe('revisionCacheSize', () => {
+    it('should match uncached extraction and reuse all pages of a known revision', async () => {
+      const pdfBuffer = await fs.readFile(cvPdfPath);
+      const cachingExtractor = new PdfExtractor({ revisionCacheSize: 4 });
+
+      const plain = await extractor.extractTextFromBuffer(pdfBuffer);
+      const first = await cachingExtractor.extractTextFromBuffer(pdfBuffer);
+      const second = await cachingExtractor.extractTextFromBuffer(pdfBuffer);
+
+      expect(first.text).toBe(plain.text);
+      expect(first.reusedPageCount).toBe(0);
+      expect(second.text).toBe(plain.text);
+      expect(second.reusedPageCount).toBe(second.pageCount);
+    });
+  });
+
+  describe('placementCacheSize', () => {
+    it('should compose page ranges from cached placements like a fresh extraction', async () => {
+      const pdfBuffer = await fs.readFile(cvPdfPath);
+      const cachingExtractor = new PdfExtractor({ placementCacheSize: 2 });
+
+      const plainAll = await extractor.extractTextFromBuffer(pdfBuffer);
+      const plainFirst = await extractor.extractTextFromBuffer(pdfBuffer, { startPage: 1, endPage: 1 });
+
+      const first = await cachingExtractor.extractTextFromBuffer(pdfBuffer, {
+        startPage: 1,
+        endPage: 1,
+      });
+      // Only the whole-document extraction keeps placements; this range is composed from them
+      const all = await cachingExtractor.extractTextFromBuffer(pdfBuffer);
+      const composedFirst = await cachingExtractor.extractTextFromBuffer(pdfBuffer, {
+        startPage: 1,
+        endPage: 1,
+      });
+
+      expect(first.text).toBe(plainFirst.text);
+      expect(all.text).toBe(plainAll.text);
+      expect(all.pageCount).toBe(plainAll.pageCount);
+      expect(composedFirst.text).toBe(plainFirst.text);
+    });
+  });
+
+  describe('pageOffsets', () => {
+    it('should return where each page starts in the UTF-8 text', async () => {
+      const offsetsExtractor = new PdfExtractor({ pageOffsets: true });
+
+      const plain = await extractor.extractText(cvPdfPath);
+      const result = await offsetsExtractor.extractText(cvPdfPath);
+      const firstPage = await extractor.extractText(cvPdfPath, { startPage: 1, endPage: 1 });
+
+      expect(result.text).toBe(plain.text);
+      expect(plain.pageOffsets).toBeUndefined();
+      expect(result.pageOffsets).toHaveLength(result.pageCount);
+      expect(result.pageOffsets?.[0]).toBe(0);
+      if (result.pageCount > 1) {
+        expect(result.pageOffsets?.[1]).toBe(Buffer.byteLength(firstPage.text, 'utf8'));
+      }
+    });
+
+    it('should return page offsets for a single call when asked for', async () => {
+      const pdfBuffer = await fs.readFile(cvPdfPath);
+
+      const requested = await extractor.extractTextFromBuffer(pdfBuffer, undefined, {
+        pageOffsets: true,
+      });
+      const plain = await extractor.extractTextFromBuffer(pdfBuffer);
+
+      expect(requested.text).toBe(plain.text);
+      expect(requested.pageOffsets).toHaveLength(requested.pageCount);
+      expect(plain.pageOffsets).toBeUndefined();
+    });
+
+    it('should serve cached files with or without page offsets', async () => {
+      const cachingExtractor = new PdfExtractor({ fileCacheSize: 4 });
+
+      const plain = await cachingExtractor.extractText(cvPdfPath);
+      const requested = await cachingExtractor.extractText(cvPdfPath, undefined, {
+        pageOffsets: true,
+      });
+
+      expect(plain.pageOffsets).toBeUndefined();
+      expect(requested.pageOffsets).toHaveLength(requested.pageCount);
+    });
+  });
+
+  describe('fileCacheSize', () => {
+    it('should serve unchanged files from cache and notice replaced content', async () => {
+      const filePath = path.join(tempDir, 'cached.pdf');
+      await fs.copyFile(cvPdfPath, filePath);
+      const cachingExtractor = new PdfExtractor({ fileCacheSize: 4 });
+
+      const extractWholeFile = jest.spyOn(cachingExtractor as any, 'extractWholeFile');
+      const first = await cachingExtractor.extractText(filePath);
+      const metadata = await cachingExtractor.getMetadata(filePath);
+      // The bytes read to hash the new entry are the ones extracted
+      expect(extractWholeFile).toHaveBeenCalledWith(
+        filePath,
+        expect.any(Buffer),
+        expect.any(Number),
+        expect.any(Number)
+      );
+
+      // Touching changes the stat identity but not the content, so the entry still holds
+      const later = new Date(Date.now() + 60000);
+      await fs.utimes(filePath, later, later);
+      extractWholeFile.mockClear();
+      const touched = await cachingExtractor.extractText(filePath);
+      expect(extractWholeFile).not.toHaveBeenCalled();
+      extractWholeFile.mockRestore();
+
+      await fs.copyFile(realPdfPath, filePath);
+      const replaced = await cachingExtractor.extractText(filePath);
+      const replacedMetadata = await cachingExtractor.getMetadata(filePath);
+
+      expect(touched.text).toBe(first.text);
+      expect(replaced.text).toBe((await extractor.extractText(realPdfPath)).text);
+      expect(replacedMetadata.pageCount).toBe((await extractor.getMetadata(realPdfPath)).pageCount);
+      expect(metadata.pageCount).toBe(first.pageCount);
+    });
+
+    it('should report missing files like uncached extraction', async () => {
+      const cachingExtractor = new PdfExtractor({ fileCacheSize: 4 });
+
+      await expect(
+        cachingExtractor.extractText(path.join(tempDir, 'missing.pdf'))
+      ).rejects.toMatchObject({ code: PdfErrorCode.INVALID_FILE });
+    });
+  });
+
+  describe('prefetchReads', () => {
+    it('should produce the same text as on-demand reads and count blocks', async () => {
+      const hebrewPdfPath = path.join(__dirname, '../../../test-materials/HebrewRTL.pdf');
+      const prefetchingExtractor = new PdfExtractor({ prefetchReads: true, pageWorkers: 2 });
+
+      const direct = await extractor.extractText(hebrewPdfPath);
+      const prefetched = await prefetchingExtractor.extractText(hebrewPdfPath);
+
+      expect(prefetched.text).toBe(direct.text);
+      expect(prefetched.pageCount).toBe(direct.pageCount);
+      const stats = prefetchingExtractor.readCache;
+      expect(stats).toBeDefined();
+      expect(stats!.hits + stats!.waits + stats!.misses).toBeGreaterThan(0);
+      expect(['io_uring', 'pread']).toContain(stats!.backend);
+    });
+
+    it('should report no stats when disabled', () => {
+      expect(extractor.readCache).toBeUndefined();
+    });
+  });
+
+  describe('minhashPermutations', () => {
+    it('should return signatures that separate different documents', async () => {
+      const signingExtractor = new PdfExtractor({ minhashPermutations: 64 });
+
+      const cv = await signingExtractor.extractText(cvPdfPath);
+      const cvAgain = await signingExtractor.extractText(cvPdfPath);
+      const other = await signingExtractor.extractText(realPdfPath);
+
+      expect(cv.minhash).toHaveLength(64);
+      expect(cvAgain.minhash).toEqual(cv.minhash);
+      expect(
+        estimateSimilarity(cv.minhash as number[], other.minhash as number[])
+      ).toBeLessThan(0.5);
+    });
+
+    it('should return empty signatures for documents without text', async () => {
+      const signingExtractor = new PdfExtractor({ minhashPermutations: 64 });
+
+      const first = await signingExtractor.extractTextFromBuffer(imageOnlyPdf('AB'));
+      const second = await signingExtractor.extractTextFromBuffer(imageOnlyPdf('zyxw'));
+
+      expect(first.minhash).toEqual([]);
+      expect(second.minhash).toEqual([]);
+    });
+
+    it('should not return a signature by default', async () => {
+      const result = await extractor.extractText(cvPdfPath);
+      expect(result.minhash).toBeUndefined();
+    });
+  });
+
+  describe('warmup', () => {
+    it('should run the embedded document once per thread and report timings', async () => {
+      const result = await warmup(2);
+
+      expect(result.threads).toBe(2);
+      expect(result.addonLoadTime).toBeGreaterThan(0);
+      expect(result.extractionTime).toBeGreaterThanOrEqual(0);
+      expect(result.bidiTime).toBeGreaterThanOrEqual(0);
+      expect(result.totalTime).toBeGreaterThanOrEqual(result.extractionTime);
+    });
+  });
+
+  describe('page ranges', () => {
+    it('should extract only the requested pages', async () => {
+      const full = await extractor.extractText(cvPdfPath);
+      const firstPage = await extractor.extractText(cvPdfPath, { startPage: 1, endPage: 1 });
+
+      expect(firstPage.pageCount).toBe(1);
+      expect(firstPage.text.length).toBeGreaterThan(0);
+      expect(firstPage.text.length).toBeLessThanOrEqual(full.text.length);
+    });
+
+    it('should reject invalid page ranges', async () => {
+      await expect(
+        extractor.extractText(cvPdfPath, { startPage: 3, endPage: 2 })
+      ).rejects.toMatchObject({ code: PdfErrorCode.INVALID_PAGE_RANGE });
+    });
+
+    it('should reject page numbers past the last page without reading metadata', async () => {
+      const { pageCount } = await extractor.getMetadata(cvPdfPath);
+      const getMetadataNative = jest.spyOn(extractor as any, 'getMetadataNative');
+
+      await expect(
+        extractor.extractText(cvPdfPath, { startPage: 1, endPage: pageCount + 1 })
+      ).rejects.toMatchObject({ code: PdfErrorCode.INVALID_PAGE_RANGE });
+      await expect(
+        extractor.extractText(cvPdfPath, { startPage: pageCount + 1 })
+      ).rejects.toMatchObject({ code: PdfErrorCode.INVALID_PAGE_RANGE });
+      expect(getMetadataNative).not.toHaveBeenCalled();
+      getMetadataNative.mockRestore();
+    });
+
+    it('should address pages by label', async () => {
+      const metadata = await extractor.getMetadata(cvPdfPath);
+      const firstLabel = metadata.pageLabels ? metadata.pageLabels[0] : '1';
+
+      const byNumber = await extractor.extractText(cvPdfPath, { startPage: 1, endPage: 1 });
+      const getMetadataNative = jest.spyOn(extractor as any, 'getMetadataNative');
+      const byLabel = await extractor.extractText(cvPdfPath, {
+        startPage: firstLabel,
+        endPage: firstLabel,
+      });
+
+      expect(byLabel.text).toBe(byNumber.text);
+      // Labels are resolved through the lazy xref reader
+      expect(getMetadataNative).toHaveBeenCalledWith(cvPdfPath, true);
+      getMetadataNative.mockRestore();
+    });
+
+    it('should reject unknown page labels', async () => {
+      await expect(
+        extractor.extractText(cvPdfPath, { startPage: 'no-such-label' })
+      ).rejects.toMatchObject({ code: PdfErrorCode.INVALID_PAGE_RANGE });
+    });
+  });
+
+  describe('getOutline', () => {
+    it('should return outline entries with section spans', async () => {
+      const outline = await extractor.getOutline(cvPdfPath);
+
+      expect(outline.pageCount).toBeGreaterThan(0);
+      outline.entries.forEach((entry) => {
+        expect(typeof entry.title).toBe('string');
+        if (entry.pageNumber !== null) {
+          expect(entry.endPageNumber).toBeGreaterThanOrEqual(entry.pageNumber);
+          expect(entry.endPageNumber).toBeLessThanOrEqual(outline.pageCount);
+        }
+      });
+    });
+
+    it('should report a missing section', async () => {
+      await expect(
+        extractor.extractSection(cvPdfPath, 'no such section title')
+      ).rejects.toMatchObject({ code: PdfErrorCode.SECTION_NOT_FOUND });
+    });
+  });
+
   describe('extractTextFromBuffer', () => {
     it('should throw error for buffer too large', async () => {
       const smallExtractor = new PdfExtractor({ maxFileSize: 10 });
@@ -128,6 +555,71 @@ describe('PdfExtractor', () => {
     });
   });
 
+  describe('extractTextFromArchive', () => {
+    let archive: Buffer;
+
+    beforeAll(async () => {
+      archive = createZip([
+        { name: 'docs/HighLevelContentContext.pdf', data: await fs.readFile(realPdfPath) },
+        { name: 'notes.txt', data: Buffer.from('not a PDF') },
+        { name: 'cv.PDF', data: await fs.readFile(cvPdfPath) },
+        { name: 'broken.pdf', data: Buffer.from('This is not a PDF file') },
+      ]);
+    });
+
+    it('should report every PDF entry from a buffer', async () => {
+      const entries: PdfArchiveEntryResult[] = [];
+      const summary = await extractor.extractTextFromArchive(archive, (entry) =>
+        entries.push(entry)
+      );
+
+      expect(summary.entryCount).toBe(3);
+      expect(summary.failedCount).toBe(1);
+      entries.sort((a, b) => a.index - b.index);
+      expect(entries.map((entry) => entry.name)).toEqual([
+        'docs/HighLevelContentContext.pdf',
+        'cv.PDF',
+        'broken.pdf',
+      ]);
+
+      const single = await extractor.extractText(realPdfPath);
+      expect(entries[0].result?.text).toBe(single.text);
+      expect(entries[1].result?.pageCount).toBeGreaterThan(0);
+      expect(entries[2].error).toBeInstanceOf(PdfExtractionError);
+    });
+
+    it('should read archives from a file', async () => {
+      const archivePath = path.join(tempDir, 'documents.zip');
+      await fs.writeFile(archivePath, archive);
+
+      const names: string[] = [];
+      const summary = await new PdfExtractor({ archiveWorkers: 1 }).extractTextFromArchive(
+        archivePath,
+        (entry) => names.push(entry.name)
+      );
+
+      expect(summary.entryCount).toBe(3);
+      expect(names).toEqual(['docs/HighLevelContentContext.pdf', 'cv.PDF', 'broken.pdf']);
+    });
+
+    it('should reject entries larger than maxFileSize uncompressed', async () => {
+      const smallExtractor = new PdfExtractor({ maxFileSize: 1024 });
+      const errors: (PdfExtractionError | undefined)[] = [];
+
+      await smallExtractor.extractTextFromArchive(archive, (entry) => errors.push(entry.error));
+
+      expect(errors.filter((error) => error?.code === PdfErrorCode.FILE_TOO_LARGE)).toHaveLength(
+        2
+      );
+    });
+
+    it('should throw error for data that is not a zip archive', async () => {
+      await expect(
+        extractor.extractTextFromArchive(Buffer.from('not a zip'), () => undefined)
+      ).rejects.toThrow(PdfExtractionError);
+    });
+  });
+
   describe('getMetadata', () => {
     it('should throw error for non-existent file', async () => {
       const nonExistentPath = path.join(tempDir, 'does-not-exist.pdf');
@@ -146,6 +638,58 @@ describe('PdfExtractor', () => {
       expect(metadata.pageCount).toBeGreaterThan(0);
       expect(typeof metadata.version).toBe('string');
     });
+
+    it('should read the same metadata lazily, falling back for xref streams', async () => {
+      const lazyExtractor = new PdfExtractor({ lazyMetadata: true });
+      const hebrewPdfPath = path.join(__dirname, '../../../test-materials/HebrewRTL.pdf');
+
+      // Classic xref tables, then an xref stream
+      for (const filePath of [realPdfPath, hebrewPdfPath, cvPdfPath]) {
+        expect(await lazyExtractor.getMetadata(filePath)).toEqual(
+          await extractor.getMetadata(filePath)
+        );
+        const buffer = await fs.readFile(filePath);
+        expect(await lazyExtractor.getMetadataFromBuffer(buffer)).toEqual(
+          await extractor.getMetadataFromBuffer(buffer)
+        );
+      }
+    });
+
+    describe('lazy metadata of incrementally updated files', () => {
+      // The page object is damaged: the full parser walks the page tree and fails on it,
+      // while the lazy reader only reads the root's /Count
+      const bodies = [
+        '<< /Type /Catalog /Pages 2 0 R /PageLabels 4 0 R >>',
+        '<< /Type /Pages /Kids [3 0 R] /Count 1 >>',
+        'damaged',
+        '<< /Nums [0 << /S /D >>] >>',
+      ];
+      const lazyExtractor = new PdfExtractor({ lazyMetadata: true });
+      const fullExtractor = new PdfExtractor({ lazyMetadata: false });
+
+      it('should read objects from the newest section and older ones through /Prev', async () => {
+        const catalog = '<< /Type /Catalog /Pages 2 0 R /PageLabels << /Nums [0 << /S /r >>] >> >>';
+        const buffer = buildPdf(bodies, [new Map([[1, catalog]])]);
+
+        await expect(fullExtractor.getMetadataFromBuffer(buffer)).rejects.toThrow(
+          PdfExtractionError
+        );
+        const metadata = await lazyExtractor.getMetadataFromBuffer(buffer);
+        expect(metadata.pageCount).toBe(1);
+        expect(metadata.pageLabels).toEqual(['i']);
+      });
+
+      it('should treat an object freed by the newest section as missing', async () => {
+        const buffer = buildPdf(bodies, [new Map([[4, null]])]);
+
+        await expect(fullExtractor.getMetadataFromBuffer(buffer)).rejects.toThrow(
+          PdfExtractionError
+        );
+        const metadata = await lazyExtractor.getMetadataFromBuffer(buffer);
+        expect(metadata.pageCount).toBe(1);
+        expect(metadata.pageLabels).toBeUndefined();
+      });
+    });
   });
 
   describe('getMetadataFromBuffer', () => {
@@ -173,6 +717,27 @@ describe('PdfExtractor', () => {
     });
   });
 
+  describe('getPageFingerprints', () => {
+    it('should return one fingerprint per page', async () => {
+      const metadata = await extractor.getMetadata(cvPdfPath);
+      const result = await extractor.getPageFingerprints(cvPdfPath);
+
+      expect(result.pageCount).toBe(metadata.pageCount);
+      expect(result.fingerprints).toHaveLength(metadata.pageCount);
+      result.fingerprints.forEach((fingerprint) => {
+        expect(fingerprint).toMatch(/^[0-9a-f]{16}$/);
+      });
+    });
+
+    it('should match between file and buffer input', async () => {
+      const pdfBuffer = await fs.readFile(cvPdfPath);
+      const fromFile = await extractor.getPageFingerprints(cvPdfPath);
+      const fromBuffer = await extractor.getPageFingerprintsFromBuffer(pdfBuffer);
+
+      expect(fromBuffer.fingerprints).toEqual(fromFile.fingerprints);
+    });
+  });
+
   describe('timeout behavior', () => {
     // Note: Timeout tests are challenging because the native extraction is synchronous
     // and executes on the same event loop tick. For small PDFs (like our test files),
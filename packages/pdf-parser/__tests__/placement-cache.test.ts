@@ -0,0 +1,47 @@
+import { PlacementCache } from '../src/placement-cache';
+
+describe('PlacementCache', () => {
+  it('should evict the least recently used entry', () => {
+    const cache = new PlacementCache(2);
+    cache.set('a', Buffer.alloc(10));
+    cache.set('b', Buffer.alloc(20));
+    cache.get('a');
+    cache.set('c', Buffer.alloc(30));
+
+    expect(cache.size).toBe(2);
+    expect(cache.get('a')).toBeDefined();
+    expect(cache.get('b')).toBeUndefined();
+    expect(cache.get('c')).toBeDefined();
+    expect(cache.bytes).toBe(40);
+  });
+
+  it('should evict by bytes before the entry count is reached', () => {
+    const cache = new PlacementCache(10, 50);
+    cache.set('a', Buffer.alloc(20));
+    cache.set('b', Buffer.alloc(20));
+    cache.set('c', Buffer.alloc(20));
+
+    expect(cache.get('a')).toBeUndefined();
+    expect(cache.size).toBe(2);
+    expect(cache.bytes).toBe(40);
+  });
+
+  it('should not keep a blob larger than the byte bound', () => {
+    const cache = new PlacementCache(10, 50);
+    cache.set('a', Buffer.alloc(20));
+    cache.set('huge', Buffer.alloc(60));
+
+    expect(cache.get('huge')).toBeUndefined();
+    expect(cache.get('a')).toBeDefined();
+    expect(cache.bytes).toBe(20);
+  });
+
+  it('should account for replaced entries', () => {
+    const cache = new PlacementCache(2);
+    cache.set('a', Buffer.alloc(10));
+    cache.set('a', Buffer.alloc(25));
+
+    expect(cache.size).toBe(1);
+    expect(cache.bytes).toBe(25);
+  });
+});
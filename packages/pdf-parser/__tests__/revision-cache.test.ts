@@ -0,0 +1,60 @@
+import { RevisionCache, RevisionEntry, hashRevisions } from '../src/revision-cache';
+
+function entry(pageTexts: string[]): RevisionEntry {
+  return {
+    fingerprints: pageTexts.map((_, i) => `fp${i}`),
+    pageTexts,
+    bidiDirection: 0,
+  };
+}
+
+describe('Revision cache', () => {
+  describe('hashRevisions', () => {
+    it('should return no keys for a buffer without %%EOF', () => {
+      expect(hashRevisions(Buffer.from('%PDF-1.7\nno end marker'))).toEqual([]);
+    });
+
+    it('should return one key per revision, oldest first', () => {
+      const original = Buffer.from('%PDF-1.7\nbody\n%%EOF');
+      const updated = Buffer.concat([original, Buffer.from('\nupdate\n%%EOF\n')]);
+
+      const originalKeys = hashRevisions(original);
+      const updatedKeys = hashRevisions(updated);
+
+      expect(originalKeys).toHaveLength(1);
+      expect(updatedKeys).toHaveLength(2);
+      expect(updatedKeys[0]).toBe(originalKeys[0]);
+      expect(updatedKeys[1]).not.toBe(originalKeys[0]);
+    });
+
+    it('should ignore trailing bytes after the last %%EOF', () => {
+      const withNewline = hashRevisions(Buffer.from('%PDF-1.7\n%%EOF\n'));
+      const withoutNewline = hashRevisions(Buffer.from('%PDF-1.7\n%%EOF'));
+      expect(withNewline).toEqual(withoutNewline);
+    });
+  });
+
+  describe('RevisionCache', () => {
+    it('should evict the least recently used entry', () => {
+      const cache = new RevisionCache(2);
+      cache.set('a', entry(['A']));
+      cache.set('b', entry(['B']));
+      cache.get('a');
+      cache.set('c', entry(['C']));
+
+      expect(cache.size).toBe(2);
+      expect(cache.get('a')).toBeDefined();
+      expect(cache.get('b')).toBeUndefined();
+      expect(cache.get('c')).toBeDefined();
+    });
+
+    it('should find the newest cached prior revision', () => {
+      const cache = new RevisionCache(4);
+      cache.set('v1', entry(['one']));
+      cache.set('v2', entry(['two']));
+
+      expect(cache.findPriorRevision(['v1', 'v2', 'v3'])?.pageTexts).toEqual(['two']);
+      expect(cache.findPriorRevision(['v3'])).toBeUndefined();
+    });
+  });
+});
@@ -10,6 +10,17 @@ import {
   createDefaultOptions,
   DEFAULT_MAX_FILE_SIZE,
   DEFAULT_TIMEOUT,
+  DEFAULT_PAGE_WORKERS,
+  DEFAULT_REVISION_CACHE_SIZE,
+  DEFAULT_MINHASH_PERMUTATIONS,
+  DEFAULT_FILE_CACHE_SIZE,
+  DEFAULT_MAX_CONCURRENCY,
+  DEFAULT_PREFETCH_READS,
+  DEFAULT_ARCHIVE_WORKERS,
+  DEFAULT_PLACEMENT_CACHE_SIZE,
+  DEFAULT_PLACEMENT_CACHE_BYTES,
+  DEFAULT_PAGE_OFFSETS,
+  DEFAULT_LAZY_METADATA,
 } from '../src/utils';
 import { PdfExtractionError, PdfErrorCode } from '../src/types';
 
@@ -33,6 +44,17 @@ describe('Utils', () => {
       expect(options).toEqual({
         maxFileSize: DEFAULT_MAX_FILE_SIZE,
         timeout: DEFAULT_TIMEOUT,
+        pageWorkers: DEFAULT_PAGE_WORKERS,
+        revisionCacheSize: DEFAULT_REVISION_CACHE_SIZE,
+        minhashPermutations: DEFAULT_MINHASH_PERMUTATIONS,
+        fileCacheSize: DEFAULT_FILE_CACHE_SIZE,
+        maxConcurrency: DEFAULT_MAX_CONCURRENCY,
+        prefetchReads: DEFAULT_PREFETCH_READS,
+        archiveWorkers: DEFAULT_ARCHIVE_WORKERS,
+        placementCacheSize: DEFAULT_PLACEMENT_CACHE_SIZE,
+        placementCacheBytes: DEFAULT_PLACEMENT_CACHE_BYTES,
+        pageOffsets: DEFAULT_PAGE_OFFSETS,
+        lazyMetadata: DEFAULT_LAZY_METADATA,
       });
     });
 
@@ -43,8 +65,24 @@ describe('Utils', () => {
       expect(options).toEqual({
         maxFileSize: 50 * 1024 * 1024,
         timeout: DEFAULT_TIMEOUT,
+        pageWorkers: DEFAULT_PAGE_WORKERS,
+        revisionCacheSize: DEFAULT_REVISION_CACHE_SIZE,
+        minhashPermutations: DEFAULT_MINHASH_PERMUTATIONS,
+        fileCacheSize: DEFAULT_FILE_CACHE_SIZE,
+        maxConcurrency: DEFAULT_MAX_CONCURRENCY,
+        prefetchReads: DEFAULT_PREFETCH_READS,
+        archiveWorkers: DEFAULT_ARCHIVE_WORKERS,
+        placementCacheSize: DEFAULT_PLACEMENT_CACHE_SIZE,
+        placementCacheBytes: DEFAULT_PLACEMENT_CACHE_BYTES,
+        pageOffsets: DEFAULT_PAGE_OFFSETS,
+        lazyMetadata: DEFAULT_LAZY_METADATA,
       });
     });
+
+    it('should accept pageWorkers override', () => {
+      const options = createDefaultOptions({ pageWorkers: 4 });
+      expect(options.pageWorkers).toBe(4);
+    });
   });
 
   describe('validateFile', () => {
@@ -138,5 +176,17 @@ describe('Utils', () => {
       const promise = Promise.reject(new Error('Original error'));
       await expect(withTimeout(promise, 1000)).rejects.toThrow('Original error');
     });
+
+    it('should cancel the jobs behind a composed promise on timeout', async () => {
+      const cancel = jest.fn();
+      const promise = Object.assign(
+        new Promise((resolve) => setTimeout(() => resolve('late'), 200)),
+        { _cancel: cancel }
+      );
+      await expect(withTimeout(promise, 50)).rejects.toMatchObject({
+        code: PdfErrorCode.TIMEOUT,
+      });
+      expect(cancel).toHaveBeenCalledTimes(1);
+    });
   });
 });
@@ -0,0 +1,72 @@
+#!/usr/bin/env node
+
+/**
+ * Extraction benchmark
+ *
+ * Times repeated text extraction of the test corpus so native changes can be
+ * compared build-to-build (run once on the old build, once on the new one).
+ * HebrewRTL.pdf exercises the ICU bidi path, the LTR documents exercise the
+ * pure-LTR fast path that skips ICU.
+ *
+ * Usage:
+ *   node manual-tests/benchmark-extraction.js [iterations]
+ */
+
+const { PdfExtractor } = require('../dist/index');
+const fs = require('fs');
+const path = require('path');
+
+const ITERATIONS = parseInt(process.argv[2] || '20', 10);
+
+const CORPUS = [
+  { name: 'HebrewRTL.pdf', kind: 'rtl' },
+  { name: 'GalKahanaCV2025.pdf', kind: 'ltr' },
+  { name: 'HighLevelContentContext.pdf', kind: 'ltr' },
+];
+
+function percentile(sorted, p) {
+  const index = Math.min(sorted.length - 1, Math.floor((p / 100) * sorted.length));
+  return sorted[index];
+}
+
+async function benchmarkFile(extractor, entry) {
+  const filePath = path.join(__dirname, '../../../test-materials', entry.name);
+  const buffer = fs.readFileSync(filePath);
+
+  // Warm up once so the first-call costs don't skew the numbers
+  await extractor.extractTextFromBuffer(buffer);
+
+  const timings = [];
+  for (let i = 0; i < ITERATIONS; i++) {
+    const start = process.hrtime.bigint();
+    await extractor.extractTextFromBuffer(buffer);
+    timings.push(Number(process.hrtime.bigint() - start) / 1e6);
+  }
+
+  timings.sort((a, b) => a - b);
+  const mean = timings.reduce((sum, t) => sum + t, 0) / timings.length;
+
+  console.log(
+    `${entry.name.padEnd(30)} ${entry.kind.padEnd(4)} ` +
+      `mean ${mean.toFixed(1).padStart(8)}ms  ` +
+      `p50 ${percentile(timings, 50).toFixed(1).padStart(8)}ms  ` +
+      `p95 ${percentile(timings, 95).toFixed(1).padStart(8)}ms`
+  );
+}
+
+async function main() {
+  const extractor = new PdfExtractor({ timeout: 120000 });
+
+  console.log('='.repeat(80));
+  console.log(`EXTRACTION BENCHMARK (${ITERATIONS} iterations per file)`);
+  console.log('='.repeat(80));
+
+  for (const entry of CORPUS) {
+    await benchmarkFile(extractor, entry);
+  }
+}
+
+main().catch((error) => {
+  console.error('Fatal error:', error);
+  process.exit(1);
+});
@@ -0,0 +1,73 @@
+/**
+ * Hashing Utilities Implementation
+ */
+
+#include "hash_utils.h"
+#include <cstring>
+
+namespace PdfParser {
+
+static const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+Fnv1a64::Fnv1a64() : state_(FNV_OFFSET_BASIS) {
+}
+
+void Fnv1a64::Update(const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t state = state_;
+    for (size_t i = 0; i < size; ++i) {
+        state ^= bytes[i];
+        state *= FNV_PRIME;
+    }
+    state_ = state;
+}
+
+void Fnv1a64::Update(const std::string& value) {
+    // Length prefix keeps ("ab","c") and ("a","bc") apart
+    UpdateUInt64(value.size());
+    Update(value.data(), value.size());
+}
+
+void Fnv1a64::UpdateUInt64(uint64_t value) {
+    unsigned char bytes[8];
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<unsigned char>(value >> (i * 8));
+    }
+    Update(bytes, sizeof(bytes));
+}
+
+void Fnv1a64::UpdateDouble(double value) {
+    // Normalize -0.0 so equal values hash equally
+    if (value == 0.0) {
+        value = 0.0;
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    UpdateUInt64(bits);
+}
+
+uint64_t Fnv1a64::Digest() const {
+    return state_;
+}
+
+uint64_t Mix64(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+std::string ToHex(uint64_t digest) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    std::string hex(16, '0');
+    for (int i = 15; i >= 0; --i) {
+        hex[i] = HEX_DIGITS[digest & 0xF];
+        digest >>= 4;
+    }
+    return hex;
+}
+
+} // namespace PdfParser
@@ -0,0 +1,51 @@
+/**
+ * Hashing Utilities
+ *
+ * Small, dependency-free streaming hash used for page fingerprints and
+ * other content identities computed inside the native workers.
+ */
+
+#ifndef HASH_UTILS_H
+#define HASH_UTILS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace PdfParser {
+
+/**
+ * Streaming 64-bit FNV-1a hash
+ *
+ * Not cryptographic. Used to detect identical content, not to resist
+ * deliberately crafted collisions.
+ */
+class Fnv1a64 {
+public:
+    Fnv1a64();
+
+    void Update(const void* data, size_t size);
+    void Update(const std::string& value);
+    void UpdateUInt64(uint64_t value);
+    void UpdateDouble(double value);
+
+    uint64_t Digest() const;
+
+private:
+    uint64_t state_;
+};
+
+/**
+ * SplitMix64 finalizer: a fast bijective scrambling of a 64-bit value
+ * Used to derive independent hash functions from one base hash.
+ */
+uint64_t Mix64(uint64_t value);
+
+/**
+ * Format a 64-bit digest as 16 lowercase hex characters
+ */
+std::string ToHex(uint64_t digest);
+
+} // namespace PdfParser
+
+#endif // HASH_UTILS_H
@@ -0,0 +1,399 @@
+/**
+ * Lazy Xref Reader Implementation
+ */
+
+#include "lazy_xref_reader.h"
+#include "PDFIndirectObjectReference.h"
+#include "PDFInteger.h"
+#include "PDFSymbol.h"
+#include "RefCountPtr.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace PdfParser {
+
+// The header may follow up to a kilobyte of junk; startxref is within the last kilobyte
+static const size_t HEADER_SEARCH_SIZE = 1024;
+static const size_t TAIL_SEARCH_SIZE = 1024;
+
+// "nnnnnnnnnn ggggg n" and a two-byte end of line
+static const size_t XREF_ENTRY_SIZE = 20;
+
+// Longest subsection header or keyword line read at once
+static const size_t LINE_BUFFER_SIZE = 64;
+
+// Guards against /Prev chains that loop or never end
+static const size_t MAX_XREF_SECTIONS = 1024;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\0';
+}
+
+static bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static void SkipWhitespace(const char* text, size_t length, size_t& pos) {
+    while (pos < length && IsWhitespace(text[pos])) {
+        ++pos;
+    }
+}
+
+/**
+ * Parse an unsigned decimal at text[pos], advancing pos past it
+ * @return False if there is no number at pos or it does not fit
+ */
+static bool ParseUnsigned(const char* text, size_t length, size_t& pos, unsigned long long& outValue) {
+    size_t start = pos;
+    outValue = 0;
+    while (pos < length && IsDigit(text[pos])) {
+        if (pos - start >= 18) {
+            return false;
+        }
+        outValue = outValue * 10 + static_cast<unsigned long long>(text[pos] - '0');
+        ++pos;
+    }
+    return pos > start;
+}
+
+static bool StartsWith(const char* text, size_t length, size_t pos, const char* keyword) {
+    size_t keywordLength = std::strlen(keyword);
+    return length - pos >= keywordLength && std::memcmp(text + pos, keyword, keywordLength) == 0;
+}
+
+/**
+ * Whether 20 bytes are one well-formed xref entry, end of line included
+ */
+static bool IsXrefEntry(const char* entry) {
+    for (size_t i = 0; i < 10; ++i) {
+        if (!IsDigit(entry[i])) {
+            return false;
+        }
+    }
+    for (size_t i = 11; i < 16; ++i) {
+        if (!IsDigit(entry[i])) {
+            return false;
+        }
+    }
+    return entry[10] == ' ' && entry[16] == ' ' && (entry[17] == 'n' || entry[17] == 'f') &&
+           IsWhitespace(entry[18]) && IsWhitespace(entry[19]);
+}
+
+static IOBasicTypes::LongFilePositionType PreviousSectionOffset(PDFDictionary* trailer) {
+    PDFObjectCastPtr<PDFInteger> prev(trailer->QueryDirectObject("Prev"));
+    return prev.GetPtr() && prev->GetValue() >= 0 ? prev->GetValue() : -1;
+}
+
+// ============================================================================
+// LAZY XREF READER
+// ============================================================================
+
+LazyXrefReader::LazyXrefReader()
+    : stream_(nullptr),
+      streamSize_(0),
+      pdfLevel_(0),
+      previousSection_(-1),
+      pagesCount_(-1) {
+}
+
+size_t LazyXrefReader::ReadAt(IOBasicTypes::LongFilePositionType offset, char* buffer, size_t size) {
+    stream_->SetPosition(offset);
+    size_t total = 0;
+    while (total < size) {
+        IOBasicTypes::LongBufferSizeType read = stream_->Read(
+            reinterpret_cast<IOBasicTypes::Byte*>(buffer + total), size - total
+        );
+        if (read == 0) {
+            break;
+        }
+        total += static_cast<size_t>(read);
+    }
+    return total;
+}
+
+bool LazyXrefReader::Open(IByteReaderWithPosition* stream) {
+    stream_ = stream;
+    positionProvider_.SetStream(stream);
+    objectParser_.SetReadStream(stream, &positionProvider_);
+
+    stream->SetPositionFromEnd(0);
+    streamSize_ = stream->GetCurrentPosition();
+
+    // Header: %PDF-major.minor
+    char head[HEADER_SEARCH_SIZE];
+    size_t headSize = ReadAt(0, head, sizeof(head));
+    size_t pos = std::string(head, headSize).find("%PDF-");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos += 5;
+    unsigned long long major = 0;
+    unsigned long long minor = 0;
+    if (!ParseUnsigned(head, headSize, pos, major) || pos >= headSize || head[pos] != '.') {
+        return false;
+    }
+    size_t minorStart = ++pos;
+    if (!ParseUnsigned(head, headSize, pos, minor)) {
+        return false;
+    }
+    double scale = 1;
+    for (size_t i = minorStart; i < pos; ++i) {
+        scale *= 10;
+    }
+    pdfLevel_ = static_cast<double>(major) + static_cast<double>(minor) / scale;
+
+    // Last startxref offset
+    size_t tailSize = static_cast<size_t>(
+        std::min<IOBasicTypes::LongFilePositionType>(TAIL_SEARCH_SIZE, streamSize_)
+    );
+    char tail[TAIL_SEARCH_SIZE];
+    tailSize = ReadAt(streamSize_ - tailSize, tail, tailSize);
+    pos = std::string(tail, tailSize).rfind("startxref");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos += 9;
+    SkipWhitespace(tail, tailSize, pos);
+    unsigned long long xrefOffset = 0;
+    if (!ParseUnsigned(tail, tailSize, pos, xrefOffset) ||
+        xrefOffset >= static_cast<unsigned long long>(streamSize_)) {
+        return false;
+    }
+
+    std::vector<XrefSubsection> subsections;
+    PDFObjectCastPtr<PDFDictionary> trailer(
+        ReadSection(static_cast<IOBasicTypes::LongFilePositionType>(xrefOffset), subsections)
+    );
+    if (!trailer.GetPtr()) {
+        return false;
+    }
+
+    // Hybrid files list some objects only in the xref stream, and encrypted
+    // strings need the security handler PDFParser sets up
+    RefCountPtr<PDFObject> xrefStream(trailer->QueryDirectObject("XRefStm"));
+    RefCountPtr<PDFObject> encrypt(trailer->QueryDirectObject("Encrypt"));
+    if (xrefStream.GetPtr() || encrypt.GetPtr()) {
+        return false;
+    }
+
+    sections_.push_back(subsections);
+    openedOffsets_.push_back(static_cast<IOBasicTypes::LongFilePositionType>(xrefOffset));
+    previousSection_ = PreviousSectionOffset(trailer.GetPtr());
+    trailer_ = trailer;
+    return true;
+}
+
+PDFDictionary* LazyXrefReader::ReadSection(
+    IOBasicTypes::LongFilePositionType offset,
+    std::vector<XrefSubsection>& outSubsections
+) {
+    char line[LINE_BUFFER_SIZE];
+    size_t length = ReadAt(offset, line, sizeof(line));
+    size_t pos = 0;
+    SkipWhitespace(line, length, pos);
+    if (!StartsWith(line, length, pos, "xref")) {
+        return nullptr;
+    }
+    offset += pos + 4;
+
+    // Subsection headers, skipping over their entries, up to the trailer keyword
+    while (true) {
+        length = ReadAt(offset, line, sizeof(line));
+        pos = 0;
+        SkipWhitespace(line, length, pos);
+        if (StartsWith(line, length, pos, "trailer")) {
+            offset += pos + 7;
+            break;
+        }
+
+        unsigned long long first = 0;
+        unsigned long long count = 0;
+        if (!ParseUnsigned(line, length, pos, first)) {
+            return nullptr;
+        }
+        while (pos < length && (line[pos] == ' ' || line[pos] == '\t')) {
+            ++pos;
+        }
+        if (!ParseUnsigned(line, length, pos, count)) {
+            return nullptr;
+        }
+
+        // Entries start on the next line
+        while (pos < length && (line[pos] == ' ' || line[pos] == '\t')) {
+            ++pos;
+        }
+        size_t lineEnd = pos;
+        if (pos < length && line[pos] == '\r') {
+            ++pos;
+        }
+        if (pos < length && line[pos] == '\n') {
+            ++pos;
+        }
+        if (pos == lineEnd) {
+            return nullptr;
+        }
+
+        XrefSubsection subsection = {
+            static_cast<ObjectIDType>(first),
+            static_cast<ObjectIDType>(count),
+            offset + static_cast<IOBasicTypes::LongFilePositionType>(pos)
+        };
+        if (count > static_cast<unsigned long long>(streamSize_ - subsection.entriesOffset) / XREF_ENTRY_SIZE) {
+            return nullptr;
+        }
+
+        // Entries are located by arithmetic, so they must all be 20 bytes;
+        // tables written with 19-byte entries are left to PDFParser
+        char entry[XREF_ENTRY_SIZE];
+        if (count > 0 &&
+            (ReadAt(subsection.entriesOffset, entry, XREF_ENTRY_SIZE) != XREF_ENTRY_SIZE || !IsXrefEntry(entry))) {
+            return nullptr;
+        }
+
+        outSubsections.push_back(subsection);
+        offset = subsection.entriesOffset + static_cast<IOBasicTypes::LongFilePositionType>(count * XREF_ENTRY_SIZE);
+    }
+
+    stream_->SetPosition(offset);
+    objectParser_.ResetReadState();
+    PDFObject* trailer = objectParser_.ParseNewObject();
+    if (!trailer || trailer->GetType() != PDFObject::ePDFObjectDictionary) {
+        if (trailer) {
+            trailer->Release();
+        }
+        return nullptr;
+    }
+    return static_cast<PDFDictionary*>(trailer);
+}
+
+bool LazyXrefReader::OpenPreviousSection() {
+    if (previousSection_ < 0) {
+        return false;
+    }
+    if (openedOffsets_.size() >= MAX_XREF_SECTIONS ||
+        std::find(openedOffsets_.begin(), openedOffsets_.end(), previousSection_) != openedOffsets_.end()) {
+        throw std::runtime_error("Cyclic xref sections");
+    }
+
+    std::vector<XrefSubsection> subsections;
+    PDFObjectCastPtr<PDFDictionary> trailer(ReadSection(previousSection_, subsections));
+    if (!trailer.GetPtr()) {
+        throw std::runtime_error("Previous xref section is not a table");
+    }
+    RefCountPtr<PDFObject> xrefStream(trailer->QueryDirectObject("XRefStm"));
+    if (xrefStream.GetPtr()) {
+        throw std::runtime_error("Previous xref section is hybrid");
+    }
+
+    openedOffsets_.push_back(previousSection_);
+    sections_.push_back(subsections);
+    previousSection_ = PreviousSectionOffset(trailer.GetPtr());
+    return true;
+}
+
+bool LazyXrefReader::FindObjectOffset(ObjectIDType objectId, IOBasicTypes::LongFilePositionType& outOffset) {
+    for (size_t i = 0;; ++i) {
+        if (i == sections_.size() && !OpenPreviousSection()) {
+            return false;
+        }
+        for (const XrefSubsection& subsection : sections_[i]) {
+            if (objectId < subsection.firstObject || objectId - subsection.firstObject >= subsection.count) {
+                continue;
+            }
+
+            char entry[XREF_ENTRY_SIZE];
+            IOBasicTypes::LongFilePositionType entryOffset = subsection.entriesOffset +
+                static_cast<IOBasicTypes::LongFilePositionType>((objectId - subsection.firstObject) * XREF_ENTRY_SIZE);
+            if (ReadAt(entryOffset, entry, XREF_ENTRY_SIZE) != XREF_ENTRY_SIZE || !IsXrefEntry(entry)) {
+                throw std::runtime_error("Malformed xref entry");
+            }
+            if (entry[17] == 'f') {
+                return false;
+            }
+
+            size_t pos = 0;
+            unsigned long long offset = 0;
+            ParseUnsigned(entry, 10, pos, offset);
+            outOffset = static_cast<IOBasicTypes::LongFilePositionType>(offset);
+            return true;
+        }
+    }
+}
+
+PDFObject* LazyXrefReader::ParseNewObject(ObjectIDType objectId) {
+    IOBasicTypes::LongFilePositionType offset = 0;
+    if (!FindObjectOffset(objectId, offset)) {
+        return nullptr;
+    }
+    if (offset >= streamSize_) {
+        throw std::runtime_error("Xref entry points past the end of the file");
+    }
+
+    // "id generation obj" then the object itself
+    stream_->SetPosition(offset);
+    objectParser_.ResetReadState();
+    PDFObjectCastPtr<PDFInteger> number(objectParser_.ParseNewObject());
+    PDFObjectCastPtr<PDFInteger> generation(objectParser_.ParseNewObject());
+    PDFObjectCastPtr<PDFSymbol> keyword(objectParser_.ParseNewObject());
+    if (!number.GetPtr() || number->GetValue() != static_cast<long long>(objectId) ||
+        !generation.GetPtr() || !keyword.GetPtr() || keyword->GetValue() != "obj") {
+        throw std::runtime_error("Xref entry does not point to its object");
+    }
+    return objectParser_.ParseNewObject();
+}
+
+PDFObject* LazyXrefReader::QueryDictionaryObject(PDFDictionary* dictionary, const std::string& key) {
+    RefCountPtr<PDFObject> object(dictionary->QueryDirectObject(key));
+    if (!object.GetPtr()) {
+        return nullptr;
+    }
+    if (object->GetType() == PDFObject::ePDFObjectIndirectObjectReference) {
+        return ParseNewObject(static_cast<PDFIndirectObjectReference*>(object.GetPtr())->mObjectID);
+    }
+    object->AddRef();
+    return object.GetPtr();
+}
+
+PDFObject* LazyXrefReader::QueryArrayObject(PDFArray* array, unsigned long index) {
+    RefCountPtr<PDFObject> object(array->QueryObject(index));
+    if (!object.GetPtr()) {
+        return nullptr;
+    }
+    if (object->GetType() == PDFObject::ePDFObjectIndirectObjectReference) {
+        return ParseNewObject(static_cast<PDFIndirectObjectReference*>(object.GetPtr())->mObjectID);
+    }
+    object->AddRef();
+    return object.GetPtr();
+}
+
+double LazyXrefReader::GetPDFLevel() const {
+    return pdfLevel_;
+}
+
+PDFDictionary* LazyXrefReader::GetTrailer() const {
+    return trailer_.GetPtr();
+}
+
+unsigned long LazyXrefReader::GetPagesCount() {
+    if (pagesCount_ < 0) {
+        PDFObjectCastPtr<PDFDictionary> catalog(QueryDictionaryObject(trailer_.GetPtr(), "Root"));
+        PDFObjectCastPtr<PDFDictionary> pages(
+            catalog.GetPtr() ? QueryDictionaryObject(catalog.GetPtr(), "Pages") : nullptr
+        );
+        PDFObjectCastPtr<PDFInteger> count(
+            pages.GetPtr() ? QueryDictionaryObject(pages.GetPtr(), "Count") : nullptr
+        );
+        if (!count.GetPtr() || count->GetValue() < 0) {
+            throw std::runtime_error("Page tree root has no valid /Count");
+        }
+        pagesCount_ = count->GetValue();
+    }
+    return static_cast<unsigned long>(pagesCount_);
+}
+
+} // namespace PdfParser
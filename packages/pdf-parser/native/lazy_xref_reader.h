@@ -0,0 +1,139 @@
+/**
+ * Lazy Xref Reader
+ *
+ * Reads single objects of a document with a classic cross-reference table
+ * without loading the table. PDFParser::StartPDFParsing reads every xref
+ * entry (and the whole page tree) before the first object can be queried,
+ * which makes metadata of a million-object file cost as much as its xref.
+ *
+ * Opening reads only the header, the startxref offset, the subsection
+ * headers of the last xref section and its trailer. Xref entries are fixed
+ * 20-byte records, so an object's entry is read directly from its
+ * subsection; older sections (/Prev) are opened only when an object is not
+ * found in the newer ones. The cost of a query is then a few small reads,
+ * whatever the object count.
+ *
+ * Documents this reader cannot serve correctly (xref streams, hybrid files,
+ * encryption, malformed tables) are declined, and callers fall back to
+ * PDFParser. Objects are returned with the same ownership rules as
+ * PDFParser's, so code written against one works with the other.
+ */
+
+#ifndef LAZY_XREF_READER_H
+#define LAZY_XREF_READER_H
+
+#include "IByteReaderWithPosition.h"
+#include "IOBasicTypes.h"
+#include "IReadPositionProvider.h"
+#include "ObjectsBasicTypes.h"
+#include "PDFArray.h"
+#include "PDFDictionary.h"
+#include "PDFObjectCast.h"
+#include "PDFObjectParser.h"
+#include <string>
+#include <vector>
+
+namespace PdfParser {
+
+class LazyXrefReader {
+public:
+    LazyXrefReader();
+
+    LazyXrefReader(const LazyXrefReader&) = delete;
+    LazyXrefReader& operator=(const LazyXrefReader&) = delete;
+
+    /**
+     * Read the header, the last xref section's subsection headers and its trailer
+     *
+     * @param stream Stream over the whole document; must outlive the reader
+     * @return False if the document is not one this reader can serve
+     *         (no classic xref table at startxref, /XRefStm, /Encrypt, malformed table)
+     */
+    bool Open(IByteReaderWithPosition* stream);
+
+    // Version from the %PDF- header
+    double GetPDFLevel() const;
+
+    // Trailer of the last xref section (not owned by the caller)
+    PDFDictionary* GetTrailer() const;
+
+    /**
+     * /Count of the page tree root, the only page tree node read
+     * @throws std::runtime_error if the catalog or page tree root has no valid /Count
+     */
+    unsigned long GetPagesCount();
+
+    /**
+     * Parse an indirect object, resolving its offset from the xref on demand
+     * @return New reference owned by the caller, or null for free and unknown objects
+     * @throws std::runtime_error if the xref entry or the object is malformed
+     */
+    PDFObject* ParseNewObject(ObjectIDType objectId);
+
+    // Dictionary value or array element, resolved if indirect. Owned by the caller.
+    PDFObject* QueryDictionaryObject(PDFDictionary* dictionary, const std::string& key);
+    PDFObject* QueryArrayObject(PDFArray* array, unsigned long index);
+
+private:
+    // Consecutive entries of one xref section, starting at entriesOffset
+    struct XrefSubsection {
+        ObjectIDType firstObject;
+        ObjectIDType count;
+        IOBasicTypes::LongFilePositionType entriesOffset;
+    };
+
+    // IReadPositionProvider over the document stream, for PDFObjectParser
+    class StreamPositionProvider : public IReadPositionProvider {
+    public:
+        StreamPositionProvider() : stream_(nullptr) {}
+        void SetStream(IByteReaderWithPosition* stream) { stream_ = stream; }
+        IOBasicTypes::LongFilePositionType GetCurrentPosition() override {
+            return stream_->GetCurrentPosition();
+        }
+
+    private:
+        IByteReaderWithPosition* stream_;
+    };
+
+    /**
+     * Read the subsection headers and the trailer of the section at offset
+     * @return Trailer (owned by the caller), or null if the section is not a well-formed table
+     */
+    PDFDictionary* ReadSection(
+        IOBasicTypes::LongFilePositionType offset,
+        std::vector<XrefSubsection>& outSubsections
+    );
+
+    /**
+     * Open the section named by the last opened trailer's /Prev
+     * @return False when there is none
+     */
+    bool OpenPreviousSection();
+
+    /**
+     * Find an object's entry, newest section first
+     * @return False for free and unknown objects
+     */
+    bool FindObjectOffset(ObjectIDType objectId, IOBasicTypes::LongFilePositionType& outOffset);
+
+    // Read up to size bytes at offset; returns the count read
+    size_t ReadAt(IOBasicTypes::LongFilePositionType offset, char* buffer, size_t size);
+
+    IByteReaderWithPosition* stream_;
+    StreamPositionProvider positionProvider_;
+    PDFObjectParser objectParser_;
+    IOBasicTypes::LongFilePositionType streamSize_;
+    double pdfLevel_;
+    PDFObjectCastPtr<PDFDictionary> trailer_;
+
+    // Opened sections, newest first, and the /Prev of the oldest one (-1: none)
+    std::vector<std::vector<XrefSubsection>> sections_;
+    std::vector<IOBasicTypes::LongFilePositionType> openedOffsets_;
+    IOBasicTypes::LongFilePositionType previousSection_;
+
+    long long pagesCount_;      // -1 until read
+};
+
+} // namespace PdfParser
+
+#endif // LAZY_XREF_READER_H
@@ -0,0 +1,101 @@
+/**
+ * MinHash Signatures Implementation
+ */
+
+#include "minhash.h"
+#include "hash_utils.h"
+#include <limits>
+
+namespace PdfParser {
+
+static const uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+static bool IsWordSeparator(unsigned char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+/**
+ * Fold one shingle hash into the signature minimums
+ */
+static void AddShingle(
+    uint64_t shingleHash,
+    const std::vector<uint64_t>& seeds,
+    std::vector<uint64_t>& minimums
+) {
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        uint64_t value = Mix64(shingleHash ^ seeds[i]);
+        if (value < minimums[i]) {
+            minimums[i] = value;
+        }
+    }
+}
+
+/**
+ * Hash the last MINHASH_SHINGLE_SIZE words (or fewer, for short texts)
+ * held in the ring buffer, oldest first
+ */
+static uint64_t HashShingle(const uint64_t* ring, size_t wordCount) {
+    size_t size = wordCount < MINHASH_SHINGLE_SIZE ? wordCount : MINHASH_SHINGLE_SIZE;
+    Fnv1a64 hasher;
+    for (size_t j = wordCount - size; j < wordCount; ++j) {
+        hasher.UpdateUInt64(ring[j % MINHASH_SHINGLE_SIZE]);
+    }
+    return hasher.Digest();
+}
+
+std::vector<uint32_t> ComputeMinHash(const std::string& text, int permutations) {
+    std::vector<uint64_t> seeds(permutations);
+    for (int i = 0; i < permutations; ++i) {
+        seeds[i] = Mix64(GOLDEN_GAMMA * static_cast<uint64_t>(i + 1));
+    }
+    std::vector<uint64_t> minimums(permutations, std::numeric_limits<uint64_t>::max());
+
+    uint64_t ring[MINHASH_SHINGLE_SIZE];
+    size_t wordCount = 0;
+    size_t pos = 0;
+    size_t length = text.size();
+
+    while (pos < length) {
+        while (pos < length && IsWordSeparator(static_cast<unsigned char>(text[pos]))) {
+            ++pos;
+        }
+        if (pos >= length) {
+            break;
+        }
+
+        Fnv1a64 wordHasher;
+        while (pos < length && !IsWordSeparator(static_cast<unsigned char>(text[pos]))) {
+            unsigned char c = static_cast<unsigned char>(text[pos]);
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<unsigned char>(c - 'A' + 'a');
+            }
+            wordHasher.Update(&c, 1);
+            ++pos;
+        }
+
+        ring[wordCount % MINHASH_SHINGLE_SIZE] = wordHasher.Digest();
+        ++wordCount;
+        if (wordCount >= MINHASH_SHINGLE_SIZE) {
+            AddShingle(HashShingle(ring, wordCount), seeds, minimums);
+        }
+    }
+
+    // No words, no shingles: an all-maximum signature would equal that of
+    // every other empty text (scanned or image-only documents)
+    if (wordCount == 0) {
+        return {};
+    }
+
+    // Texts shorter than one shingle count as a single shingle
+    if (wordCount < MINHASH_SHINGLE_SIZE) {
+        AddShingle(HashShingle(ring, wordCount), seeds, minimums);
+    }
+
+    std::vector<uint32_t> signature(permutations);
+    for (int i = 0; i < permutations; ++i) {
+        signature[i] = static_cast<uint32_t>(minimums[i] >> 32);
+    }
+    return signature;
+}
+
+} // namespace PdfParser
@@ -0,0 +1,39 @@
+/**
+ * MinHash Signatures
+ *
+ * Near-duplicate detection for composed document text. Text is split into
+ * whitespace-separated words (ASCII case-folded) and overlapping word
+ * shingles are hashed; each signature slot keeps the minimum of one
+ * derived hash function over all shingles. The fraction of equal slots
+ * between two signatures estimates the Jaccard similarity of their
+ * shingle sets.
+ */
+
+#ifndef MINHASH_H
+#define MINHASH_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PdfParser {
+
+// Words per shingle
+const int MINHASH_SHINGLE_SIZE = 5;
+
+// Upper bound on signature length accepted from callers
+const int MAX_MINHASH_PERMUTATIONS = 1024;
+
+/**
+ * Compute a MinHash signature of the text in a single pass
+ *
+ * @param text UTF-8 text
+ * @param permutations Signature length (number of hash functions)
+ * @return Signature with one 32-bit value per permutation, or an empty
+ *         signature for text without any words (nothing to compare)
+ */
+std::vector<uint32_t> ComputeMinHash(const std::string& text, int permutations);
+
+} // namespace PdfParser
+
+#endif // MINHASH_H
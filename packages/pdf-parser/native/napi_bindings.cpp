@@ -6,8 +6,128 @@
 #include "workers/cancellable_async_worker.h"
 #include "workers/text_extraction_worker.h"
 #include "workers/text_extraction_buffer_worker.h"
+#include "workers/text_composition_worker.h"
+#include "workers/warmup_worker.h"
+#include "workers/minhash_worker.h"
+#include "workers/archive_extraction_worker.h"
+#include "workers/archive_extraction_buffer_worker.h"
 #include "workers/metadata_extraction_worker.h"
 #include "workers/metadata_extraction_buffer_worker.h"
+#include "workers/page_fingerprint_worker.h"
+#include "workers/page_fingerprint_buffer_worker.h"
+#include "workers/outline_worker.h"
+#include "workers/outline_buffer_worker.h"
+#include "minhash.h"
+#include "prefetching_file_reader.h"
+#include <algorithm>
+
+// ============================================================================
+// ARGUMENT HELPERS
+// ============================================================================
+
+/**
+ * Read the optional text extraction options object at info[index]
+ * Unknown or mistyped fields are ignored and keep their defaults.
+ */
+static TextExtractionOptions ParseTextExtractionOptions(const Napi::CallbackInfo& info, size_t index) {
+    TextExtractionOptions options;
+
+    if (info.Length() <= index || !info[index].IsObject()) {
+        return options;
+    }
+
+    Napi::Object optionsObj = info[index].As<Napi::Object>();
+
+    Napi::Value pageWorkers = optionsObj.Get("pageWorkers");
+    if (pageWorkers.IsNumber()) {
+        options.pageWorkers = std::max(1, pageWorkers.As<Napi::Number>().Int32Value());
+    }
+
+    Napi::Value startPage = optionsObj.Get("startPage");
+    if (startPage.IsNumber()) {
+        options.startPage = std::max<long>(0, startPage.As<Napi::Number>().Int64Value());
+    }
+
+    Napi::Value endPage = optionsObj.Get("endPage");
+    if (endPage.IsNumber()) {
+        options.endPage = std::max<long>(-1, endPage.As<Napi::Number>().Int64Value());
+    }
+
+    Napi::Value perPage = optionsObj.Get("perPage");
+    if (perPage.IsBoolean()) {
+        options.perPage = perPage.As<Napi::Boolean>().Value();
+    }
+
+    Napi::Value minhashPermutations = optionsObj.Get("minhashPermutations");
+    if (minhashPermutations.IsNumber()) {
+        options.minhashPermutations = std::min(
+            PdfParser::MAX_MINHASH_PERMUTATIONS,
+            std::max(0, minhashPermutations.As<Napi::Number>().Int32Value())
+        );
+    }
+
+    Napi::Value prefetchReads = optionsObj.Get("prefetchReads");
+    if (prefetchReads.IsBoolean()) {
+        options.prefetchReads = prefetchReads.As<Napi::Boolean>().Value();
+    }
+
+    Napi::Value keepPlacements = optionsObj.Get("keepPlacements");
+    if (keepPlacements.IsBoolean()) {
+        options.keepPlacements = keepPlacements.As<Napi::Boolean>().Value();
+    }
+
+    Napi::Value pageOffsets = optionsObj.Get("pageOffsets");
+    if (pageOffsets.IsBoolean()) {
+        options.pageOffsets = pageOffsets.As<Napi::Boolean>().Value();
+    }
+
+    return options;
+}
+
+/**
+ * Read the archive fields of the optional options object at info[index]
+ */
+static ArchiveExtractionOptions ParseArchiveExtractionOptions(const Napi::CallbackInfo& info, size_t index) {
+    ArchiveExtractionOptions options;
+
+    if (info.Length() <= index || !info[index].IsObject()) {
+        return options;
+    }
+
+    Napi::Object optionsObj = info[index].As<Napi::Object>();
+
+    Napi::Value entryWorkers = optionsObj.Get("entryWorkers");
+    if (entryWorkers.IsNumber()) {
+        options.entryWorkers = std::max(1, entryWorkers.As<Napi::Number>().Int32Value());
+    }
+
+    Napi::Value maxEntrySize = optionsObj.Get("maxEntrySize");
+    if (maxEntrySize.IsNumber()) {
+        options.maxEntrySize = static_cast<uint64_t>(std::max<int64_t>(0, maxEntrySize.As<Napi::Number>().Int64Value()));
+    }
+
+    return options;
+}
+
+/**
+ * Read the optional metadata options object at info[index]
+ */
+static MetadataExtractionOptions ParseMetadataExtractionOptions(const Napi::CallbackInfo& info, size_t index) {
+    MetadataExtractionOptions options;
+
+    if (info.Length() <= index || !info[index].IsObject()) {
+        return options;
+    }
+
+    Napi::Object optionsObj = info[index].As<Napi::Object>();
+
+    Napi::Value lazyXref = optionsObj.Get("lazyXref");
+    if (lazyXref.IsBoolean()) {
+        options.lazyXref = lazyXref.As<Napi::Boolean>().Value();
+    }
+
+    return options;
+}
 
 // ============================================================================
 // TEXT EXTRACTION BINDINGS
@@ -28,8 +148,10 @@ Napi::Value ExtractTextFromFile(const Napi::CallbackInfo& info) {
         bidiDirection = info[1].As<Napi::Number>().Int32Value();
     }
 
+    TextExtractionOptions options = ParseTextExtractionOptions(info, 2);
+
     // Create async worker
-    TextExtractionWorker* worker = new TextExtractionWorker(env, filePath, bidiDirection);
+    TextExtractionWorker* worker = new TextExtractionWorker(env, filePath, bidiDirection, options);
 
     // Store worker reference on the promise for cancellation (as ICancellable interface)
     Napi::Promise promise = worker->GetPromise();
@@ -57,9 +179,118 @@ Napi::Value ExtractTextFromBuffer(const Napi::CallbackInfo& info) {
         bidiDirection = info[1].As<Napi::Number>().Int32Value();
     }
 
+    TextExtractionOptions options = ParseTextExtractionOptions(info, 2);
+
     // Create async worker
     TextExtractionFromBufferWorker* worker = new TextExtractionFromBufferWorker(
-        env, buffer.Data(), buffer.Length(), bidiDirection
+        env, buffer.Data(), buffer.Length(), bidiDirection, options
+    );
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+/**
+ * Compose text from the placement IR of an earlier extraction (keepPlacements),
+ * for another page range or direction, without parsing the PDF
+ */
+Napi::Value ComposeTextFromPlacements(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        Napi::TypeError::New(env, "Expected placement buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    int bidiDirection = 0;  // Default: LTR
+
+    if (info.Length() > 1 && info[1].IsNumber()) {
+        bidiDirection = info[1].As<Napi::Number>().Int32Value();
+    }
+
+    TextExtractionOptions options = ParseTextExtractionOptions(info, 2);
+
+    // Create async worker
+    TextCompositionWorker* worker = new TextCompositionWorker(
+        env, buffer.Data(), buffer.Length(), bidiDirection, options
+    );
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+// ============================================================================
+// ZIP ARCHIVE TEXT EXTRACTION BINDINGS
+// ============================================================================
+
+/**
+ * Extract the text of every PDF in a zip archive file. onEntry is called
+ * with each entry's result as it completes; the promise resolves with
+ * { entryCount, failedCount } once all entries are done.
+ */
+Napi::Value ExtractTextFromArchiveFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 4 || !info[0].IsString() || !info[3].IsFunction()) {
+        Napi::TypeError::New(env, "Expected file path, direction, options and entry callback").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string filePath = info[0].As<Napi::String>().Utf8Value();
+    int bidiDirection = info[1].IsNumber() ? info[1].As<Napi::Number>().Int32Value() : 0;
+
+    TextExtractionOptions options = ParseTextExtractionOptions(info, 2);
+    ArchiveExtractionOptions archiveOptions = ParseArchiveExtractionOptions(info, 2);
+
+    // Create async worker
+    ArchiveExtractionWorker* worker = new ArchiveExtractionWorker(
+        env, filePath, bidiDirection, options, archiveOptions, info[3].As<Napi::Function>()
+    );
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+Napi::Value ExtractTextFromArchiveBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 4 || !info[0].IsBuffer() || !info[3].IsFunction()) {
+        Napi::TypeError::New(env, "Expected buffer, direction, options and entry callback").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    int bidiDirection = info[1].IsNumber() ? info[1].As<Napi::Number>().Int32Value() : 0;
+
+    TextExtractionOptions options = ParseTextExtractionOptions(info, 2);
+    ArchiveExtractionOptions archiveOptions = ParseArchiveExtractionOptions(info, 2);
+
+    // Create async worker
+    ArchiveExtractionFromBufferWorker* worker = new ArchiveExtractionFromBufferWorker(
+        env, buffer.Data(), buffer.Length(), bidiDirection, options, archiveOptions,
+        info[3].As<Napi::Function>()
     );
 
     // Store worker reference on the promise for cancellation (as ICancellable interface)
@@ -86,9 +317,10 @@ Napi::Value GetMetadataFromFile(const Napi::CallbackInfo& info) {
     }
 
     std::string filePath = info[0].As<Napi::String>().Utf8Value();
+    MetadataExtractionOptions options = ParseMetadataExtractionOptions(info, 1);
 
     // Create async worker
-    MetadataExtractionWorker* worker = new MetadataExtractionWorker(env, filePath);
+    MetadataExtractionWorker* worker = new MetadataExtractionWorker(env, filePath, options);
 
     // Store worker reference on the promise for cancellation (as ICancellable interface)
     Napi::Promise promise = worker->GetPromise();
@@ -110,9 +342,64 @@ Napi::Value GetMetadataFromBuffer(const Napi::CallbackInfo& info) {
     }
 
     Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+    MetadataExtractionOptions options = ParseMetadataExtractionOptions(info, 1);
 
     // Create async worker
     MetadataExtractionFromBufferWorker* worker = new MetadataExtractionFromBufferWorker(
+        env, buffer.Data(), buffer.Length(), options
+    );
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+// ============================================================================
+// PAGE FINGERPRINT BINDINGS
+// ============================================================================
+
+Napi::Value GetPageFingerprintsFromFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Expected file path as string").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string filePath = info[0].As<Napi::String>().Utf8Value();
+
+    // Create async worker
+    PageFingerprintWorker* worker = new PageFingerprintWorker(env, filePath);
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+Napi::Value GetPageFingerprintsFromBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        Napi::TypeError::New(env, "Expected buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+
+    // Create async worker
+    PageFingerprintFromBufferWorker* worker = new PageFingerprintFromBufferWorker(
         env, buffer.Data(), buffer.Length()
     );
 
@@ -126,3 +413,133 @@ Napi::Value GetMetadataFromBuffer(const Napi::CallbackInfo& info) {
 
     return promise;
 }
+
+// ============================================================================
+// OUTLINE EXTRACTION BINDINGS
+// ============================================================================
+
+Napi::Value GetOutlineFromFile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Expected file path as string").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string filePath = info[0].As<Napi::String>().Utf8Value();
+
+    // Create async worker
+    OutlineWorker* worker = new OutlineWorker(env, filePath);
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+Napi::Value GetOutlineFromBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        Napi::TypeError::New(env, "Expected buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Buffer<uint8_t> buffer = info[0].As<Napi::Buffer<uint8_t>>();
+
+    // Create async worker
+    OutlineFromBufferWorker* worker = new OutlineFromBufferWorker(
+        env, buffer.Data(), buffer.Length()
+    );
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+// ============================================================================
+// MINHASH BINDING
+// ============================================================================
+
+/**
+ * Compute a MinHash signature of already-composed text on a worker thread,
+ * for text assembled outside the extraction workers (e.g. cached pages).
+ * Resolves to { minhash }; the signature is empty for text without words.
+ */
+Napi::Value ComputeMinHash(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 2 || !info[0].IsString() || !info[1].IsNumber()) {
+        Napi::TypeError::New(env, "Expected text and permutation count").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string text = info[0].As<Napi::String>().Utf8Value();
+    int permutations = std::min(
+        PdfParser::MAX_MINHASH_PERMUTATIONS,
+        std::max(0, info[1].As<Napi::Number>().Int32Value())
+    );
+
+    // Create async worker
+    MinHashWorker* worker = new MinHashWorker(env, std::move(text), permutations);
+
+    // Store worker reference on the promise for cancellation (as ICancellable interface)
+    Napi::Promise promise = worker->GetPromise();
+    Napi::Object promiseObj = promise.As<Napi::Object>();
+    promiseObj.Set("_worker", Napi::External<ICancellable>::New(env, static_cast<ICancellable*>(worker)));
+
+    // Queue the work
+    worker->Queue();
+
+    return promise;
+}
+
+// ============================================================================
+// READ CACHE BINDINGS
+// ============================================================================
+
+/**
+ * Block cache counters of the prefetching file readers closed so far
+ * (process-wide). Synchronous.
+ */
+Napi::Value GetReadCacheStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    ReadCacheStats stats = PrefetchingFileReader::GetTotalStats();
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("hits", Napi::Number::New(env, static_cast<double>(stats.hits)));
+    result.Set("waits", Napi::Number::New(env, static_cast<double>(stats.waits)));
+    result.Set("misses", Napi::Number::New(env, static_cast<double>(stats.misses)));
+    result.Set("prefetches", Napi::Number::New(env, static_cast<double>(stats.prefetches)));
+    result.Set("backend", Napi::String::New(env, stats.ioUring ? "io_uring" : "pread"));
+    return result;
+}
+
+// ============================================================================
+// WARM-UP BINDING
+// ============================================================================
+
+/**
+ * Extract an embedded one-page document on a pool thread, so that the first
+ * real extraction does not pay for lazy initialization. Resolves with timings.
+ */
+Napi::Value Warmup(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    WarmupWorker* worker = new WarmupWorker(env);
+    Napi::Promise promise = worker->GetPromise();
+    worker->Queue();
+
+    return promise;
+}
@@ -12,9 +12,31 @@
 // Text extraction bindings
 Napi::Value ExtractTextFromFile(const Napi::CallbackInfo& info);
 Napi::Value ExtractTextFromBuffer(const Napi::CallbackInfo& info);
+Napi::Value ComposeTextFromPlacements(const Napi::CallbackInfo& info);
+
+// Zip archive text extraction bindings
+Napi::Value ExtractTextFromArchiveFile(const Napi::CallbackInfo& info);
+Napi::Value ExtractTextFromArchiveBuffer(const Napi::CallbackInfo& info);
 
 // Metadata extraction bindings
 Napi::Value GetMetadataFromFile(const Napi::CallbackInfo& info);
 Napi::Value GetMetadataFromBuffer(const Napi::CallbackInfo& info);
 
+// Page fingerprint bindings
+Napi::Value GetPageFingerprintsFromFile(const Napi::CallbackInfo& info);
+Napi::Value GetPageFingerprintsFromBuffer(const Napi::CallbackInfo& info);
+
+// Outline extraction bindings
+Napi::Value GetOutlineFromFile(const Napi::CallbackInfo& info);
+Napi::Value GetOutlineFromBuffer(const Napi::CallbackInfo& info);
+
+// MinHash binding
+Napi::Value ComputeMinHash(const Napi::CallbackInfo& info);
+
+// Prefetching file reader counters (synchronous)
+Napi::Value GetReadCacheStats(const Napi::CallbackInfo& info);
+
+// Cold-start warm-up
+Napi::Value Warmup(const Napi::CallbackInfo& info);
+
 #endif // NAPI_BINDINGS_H
@@ -0,0 +1,122 @@
+/**
+ * Page Labels Implementation
+ */
+
+#include "page_labels.h"
+#include "pdf_text_string.h"
+#include "PDFArray.h"
+#include "PDFDictionary.h"
+#include "PDFInteger.h"
+#include "PDFName.h"
+#include "PDFObjectCast.h"
+#include "RefCountPtr.h"
+#include <algorithm>
+
+namespace PdfParser {
+
+// Guards against malformed (cyclic or absurdly deep) number trees
+static const int MAX_NUMBER_TREE_DEPTH = 32;
+
+template <typename Document>
+static void WalkNumberTree(
+    Document& parser,
+    PDFDictionary* node,
+    int depth,
+    std::vector<PageLabelRange>& outRanges
+) {
+    if (depth > MAX_NUMBER_TREE_DEPTH) {
+        return;
+    }
+
+    // Leaf: /Nums [pageIndex labelDict pageIndex labelDict ...]
+    PDFObjectCastPtr<PDFArray> nums(parser.QueryDictionaryObject(node, "Nums"));
+    if (nums.GetPtr()) {
+        for (unsigned long i = 0; i + 1 < nums->GetLength(); i += 2) {
+            PDFObjectCastPtr<PDFInteger> key(parser.QueryArrayObject(nums.GetPtr(), i));
+            PDFObjectCastPtr<PDFDictionary> label(parser.QueryArrayObject(nums.GetPtr(), i + 1));
+            if (!key.GetPtr() || !label.GetPtr() || key->GetValue() < 0) {
+                continue;
+            }
+
+            PageLabelRange range = {static_cast<unsigned long>(key->GetValue()), "", "", 1};
+
+            PDFObjectCastPtr<PDFName> style(parser.QueryDictionaryObject(label.GetPtr(), "S"));
+            if (style.GetPtr()) {
+                const std::string& value = style->GetValue();
+                if (value == "D" || value == "R" || value == "r" || value == "A" || value == "a") {
+                    range.style = value;
+                }
+            }
+
+            RefCountPtr<PDFObject> prefix(parser.QueryDictionaryObject(label.GetPtr(), "P"));
+            range.prefix = GetTextString(prefix.GetPtr());
+
+            PDFObjectCastPtr<PDFInteger> start(parser.QueryDictionaryObject(label.GetPtr(), "St"));
+            if (start.GetPtr() && start->GetValue() >= 1) {
+                range.firstNumber = static_cast<long>(start->GetValue());
+            }
+
+            outRanges.push_back(range);
+        }
+    }
+
+    // Intermediate node: /Kids [node node ...]
+    PDFObjectCastPtr<PDFArray> kids(parser.QueryDictionaryObject(node, "Kids"));
+    if (kids.GetPtr()) {
+        for (unsigned long i = 0; i < kids->GetLength(); ++i) {
+            PDFObjectCastPtr<PDFDictionary> kid(parser.QueryArrayObject(kids.GetPtr(), i));
+            if (kid.GetPtr()) {
+                WalkNumberTree(parser, kid.GetPtr(), depth + 1, outRanges);
+            }
+        }
+    }
+}
+
+template <typename Document>
+static bool ReadRanges(Document& parser, std::vector<PageLabelRange>& outRanges) {
+    outRanges.clear();
+
+    PDFObjectCastPtr<PDFDictionary> catalog(parser.QueryDictionaryObject(parser.GetTrailer(), "Root"));
+    if (!catalog.GetPtr()) {
+        return false;
+    }
+    PDFObjectCastPtr<PDFDictionary> pageLabels(parser.QueryDictionaryObject(catalog.GetPtr(), "PageLabels"));
+    if (!pageLabels.GetPtr()) {
+        return false;
+    }
+
+    WalkNumberTree(parser, pageLabels.GetPtr(), 0, outRanges);
+
+    // Number tree keys are sorted by the spec, but producers get this wrong
+    std::stable_sort(outRanges.begin(), outRanges.end(),
+        [](const PageLabelRange& a, const PageLabelRange& b) { return a.pageIndex < b.pageIndex; });
+
+    unsigned long pageCount = parser.GetPagesCount();
+    outRanges.erase(
+        std::remove_if(outRanges.begin(), outRanges.end(),
+            [pageCount](const PageLabelRange& range) { return range.pageIndex >= pageCount; }),
+        outRanges.end());
+
+    // Keep the last of any duplicate keys
+    std::vector<PageLabelRange> unique;
+    for (const PageLabelRange& range : outRanges) {
+        if (!unique.empty() && unique.back().pageIndex == range.pageIndex) {
+            unique.back() = range;
+        } else {
+            unique.push_back(range);
+        }
+    }
+    outRanges.swap(unique);
+
+    return true;
+}
+
+bool ReadPageLabelRanges(PDFParser& parser, std::vector<PageLabelRange>& outRanges) {
+    return ReadRanges(parser, outRanges);
+}
+
+bool ReadPageLabelRanges(LazyXrefReader& reader, std::vector<PageLabelRange>& outRanges) {
+    return ReadRanges(reader, outRanges);
+}
+
+} // namespace PdfParser
@@ -0,0 +1,46 @@
+/**
+ * Page Labels
+ *
+ * Reads the catalog's /PageLabels number tree. Each entry starts a label
+ * range at a 0-based page index; pages in the range are labelled with a
+ * prefix followed by a number in the range's numbering style, counting up
+ * from the range's first number. Only the tree is read, never the pages.
+ */
+
+#ifndef PAGE_LABELS_H
+#define PAGE_LABELS_H
+
+#include "PDFParser.h"
+#include "lazy_xref_reader.h"
+#include <string>
+#include <vector>
+
+namespace PdfParser {
+
+/**
+ * One label range of the /PageLabels number tree
+ */
+struct PageLabelRange {
+    unsigned long pageIndex;    // First page of the range (0-based)
+    std::string style;          // "D", "R", "r", "A", "a", or empty for prefix-only labels
+    std::string prefix;         // UTF-8 label prefix
+    long firstNumber;           // Numeric part of the first page's label (/St, default 1)
+};
+
+/**
+ * Read the document's label ranges, ordered by page index
+ *
+ * @param parser Parser that has already started parsing the document
+ * @param outRanges Receives the ranges. Ranges starting past the last page are dropped.
+ * @return False when the document has no /PageLabels tree
+ */
+bool ReadPageLabelRanges(PDFParser& parser, std::vector<PageLabelRange>& outRanges);
+
+/**
+ * Same, reading only the objects of the tree through a lazy xref reader
+ */
+bool ReadPageLabelRanges(LazyXrefReader& reader, std::vector<PageLabelRange>& outRanges);
+
+} // namespace PdfParser
+
+#endif // PAGE_LABELS_H
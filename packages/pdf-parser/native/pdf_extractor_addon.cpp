@@ -42,11 +42,33 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     // Text extraction
     exports.Set("extractTextFromFile", Napi::Function::New(env, ExtractTextFromFile));
     exports.Set("extractTextFromBuffer", Napi::Function::New(env, ExtractTextFromBuffer));
+    exports.Set("composeTextFromPlacements", Napi::Function::New(env, ComposeTextFromPlacements));
+
+    // Zip archive text extraction
+    exports.Set("extractTextFromArchiveFile", Napi::Function::New(env, ExtractTextFromArchiveFile));
+    exports.Set("extractTextFromArchiveBuffer", Napi::Function::New(env, ExtractTextFromArchiveBuffer));
 
     // Metadata extraction
     exports.Set("getMetadataFromFile", Napi::Function::New(env, GetMetadataFromFile));
     exports.Set("getMetadataFromBuffer", Napi::Function::New(env, GetMetadataFromBuffer));
 
+    // Page fingerprints
+    exports.Set("getPageFingerprintsFromFile", Napi::Function::New(env, GetPageFingerprintsFromFile));
+    exports.Set("getPageFingerprintsFromBuffer", Napi::Function::New(env, GetPageFingerprintsFromBuffer));
+
+    // Outline (bookmarks)
+    exports.Set("getOutlineFromFile", Napi::Function::New(env, GetOutlineFromFile));
+    exports.Set("getOutlineFromBuffer", Napi::Function::New(env, GetOutlineFromBuffer));
+
+    // Near-duplicate signatures
+    exports.Set("computeMinHash", Napi::Function::New(env, ComputeMinHash));
+
+    // Prefetching file reader counters
+    exports.Set("getReadCacheStats", Napi::Function::New(env, GetReadCacheStats));
+
+    // Cold-start warm-up
+    exports.Set("warmup", Napi::Function::New(env, Warmup));
+
     // Worker cancellation
     exports.Set("cancelOperation", Napi::Function::New(env, CancelOperation));
 
@@ -0,0 +1,214 @@
+/**
+ * PDF Object Hasher Implementation
+ */
+
+#include "pdf_object_hasher.h"
+#include "PDFObject.h"
+#include "PDFArray.h"
+#include "PDFBoolean.h"
+#include "PDFDictionary.h"
+#include "PDFHexString.h"
+#include "PDFIndirectObjectReference.h"
+#include "PDFInteger.h"
+#include "PDFLiteralString.h"
+#include "PDFName.h"
+#include "PDFReal.h"
+#include "PDFStreamInput.h"
+#include "PDFObjectCast.h"
+#include "RefCountPtr.h"
+#include "IByteReader.h"
+#include <memory>
+
+namespace PdfParser {
+
+// Nesting deeper than this, counted across indirect references, is treated
+// as opaque (protects the stack against deep or cyclic object graphs)
+static const int MAX_HASH_DEPTH = 64;
+
+// Page tree depth limit when walking /Parent for inherited attributes
+static const int MAX_PAGE_TREE_DEPTH = 32;
+
+// Hashes inside reference cycles are not memoized, so a cyclic graph can be
+// re-walked from every entry point; this caps the objects resolved per call
+static const size_t MAX_RESOLVES_PER_HASH = 100000;
+
+static const size_t READ_CHUNK_SIZE = 64 * 1024;
+
+PdfObjectHasher::PdfObjectHasher(PDFParser& parser)
+    : parser_(parser), orderDependent_(false), resolveBudget_(MAX_RESOLVES_PER_HASH) {
+}
+
+uint64_t PdfObjectHasher::HashObject(PDFObject* obj) {
+    resolveBudget_ = MAX_RESOLVES_PER_HASH;
+    return HashObjectAt(obj, 0);
+}
+
+uint64_t PdfObjectHasher::HashObjectAt(PDFObject* obj, int depth) {
+    Fnv1a64 hasher;
+    WriteObject(hasher, obj, depth);
+    return hasher.Digest();
+}
+
+bool PdfObjectHasher::HashDecodedStream(PDFStreamInput* stream, Fnv1a64& hasher) {
+    std::unique_ptr<IByteReader> reader(parser_.StartReadingFromStream(stream));
+    if (!reader) {
+        // Undecodable or unsupported filter: the stored bytes still tell
+        // different contents apart
+        hasher.UpdateUInt64(PDFObject::ePDFObjectStream);
+        WriteRawStream(hasher, stream, 0);
+        return false;
+    }
+
+    std::unique_ptr<IOBasicTypes::Byte[]> buffer(new IOBasicTypes::Byte[READ_CHUNK_SIZE]);
+    while (reader->NotEnded()) {
+        IOBasicTypes::LongBufferSizeType readBytes = reader->Read(buffer.get(), READ_CHUNK_SIZE);
+        if (readBytes == 0) {
+            break;
+        }
+        hasher.Update(buffer.get(), static_cast<size_t>(readBytes));
+    }
+    return true;
+}
+
+PDFObject* PdfObjectHasher::QueryInheritedPageValue(PDFDictionary* page, const std::string& key) {
+    RefCountPtr<PDFDictionary> current(page);
+    page->AddRef();
+
+    for (int depth = 0; current.GetPtr() && depth < MAX_PAGE_TREE_DEPTH; ++depth) {
+        PDFObject* value = parser_.QueryDictionaryObject(current.GetPtr(), key);
+        if (value) {
+            return value;
+        }
+        PDFObjectCastPtr<PDFDictionary> parent(parser_.QueryDictionaryObject(current.GetPtr(), "Parent"));
+        if (!parent.GetPtr()) {
+            break;
+        }
+        // RefCountPtr assignment adopts the pointer, so take our own reference
+        parent->AddRef();
+        current = parent.GetPtr();
+    }
+    return nullptr;
+}
+
+void PdfObjectHasher::WriteObject(Fnv1a64& hasher, PDFObject* obj, int depth) {
+    if (!obj) {
+        hasher.UpdateUInt64(PDFObject::ePDFObjectNull);
+        return;
+    }
+
+    PDFObject::EPDFObjectType type = obj->GetType();
+    hasher.UpdateUInt64(type);
+
+    if (depth > MAX_HASH_DEPTH) {
+        orderDependent_ = true;
+        return;
+    }
+
+    switch (type) {
+        case PDFObject::ePDFObjectBoolean:
+            hasher.UpdateUInt64(static_cast<PDFBoolean*>(obj)->GetValue() ? 1 : 0);
+            break;
+        case PDFObject::ePDFObjectLiteralString:
+            hasher.Update(static_cast<PDFLiteralString*>(obj)->GetValue());
+            break;
+        case PDFObject::ePDFObjectHexString:
+            hasher.Update(static_cast<PDFHexString*>(obj)->GetValue());
+            break;
+        case PDFObject::ePDFObjectName:
+            hasher.Update(static_cast<PDFName*>(obj)->GetValue());
+            break;
+        case PDFObject::ePDFObjectInteger:
+            hasher.UpdateUInt64(static_cast<uint64_t>(static_cast<PDFInteger*>(obj)->GetValue()));
+            break;
+        case PDFObject::ePDFObjectReal:
+            hasher.UpdateDouble(static_cast<PDFReal*>(obj)->GetValue());
+            break;
+        case PDFObject::ePDFObjectArray: {
+            PDFArray* array = static_cast<PDFArray*>(obj);
+            unsigned long length = array->GetLength();
+            hasher.UpdateUInt64(length);
+            for (unsigned long i = 0; i < length; ++i) {
+                RefCountPtr<PDFObject> item(array->QueryObject(i));
+                WriteObject(hasher, item.GetPtr(), depth + 1);
+            }
+            break;
+        }
+        case PDFObject::ePDFObjectDictionary: {
+            // Keys iterate in name order, so equal dictionaries hash equally
+            MapIterator<PDFNameToPDFObjectMap> it = static_cast<PDFDictionary*>(obj)->GetIterator();
+            while (it.MoveNext()) {
+                const std::string& key = it.GetKey()->GetValue();
+                // Back-pointers into the page tree would pull in the whole document
+                if (key == "Parent") {
+                    continue;
+                }
+                hasher.Update(key);
+                WriteObject(hasher, it.GetValue(), depth + 1);
+            }
+            break;
+        }
+        case PDFObject::ePDFObjectIndirectObjectReference:
+            hasher.UpdateUInt64(HashIndirectObject(
+                static_cast<PDFIndirectObjectReference*>(obj)->mObjectID, depth + 1
+            ));
+            break;
+        case PDFObject::ePDFObjectStream:
+            WriteRawStream(hasher, static_cast<PDFStreamInput*>(obj), depth);
+            break;
+        default:
+            break;
+    }
+}
+
+void PdfObjectHasher::WriteRawStream(Fnv1a64& hasher, PDFStreamInput* stream, int depth) {
+    RefCountPtr<PDFDictionary> streamDict(stream->QueryStreamDictionary());
+    WriteObject(hasher, streamDict.GetPtr(), depth + 1);
+
+    // Resource streams (fonts, images) are hashed as stored, no decoding
+    std::unique_ptr<IByteReader> reader(parser_.StartReadingFromStreamForPlainCopying(stream));
+    if (!reader) {
+        return;
+    }
+
+    std::unique_ptr<IOBasicTypes::Byte[]> buffer(new IOBasicTypes::Byte[READ_CHUNK_SIZE]);
+    while (reader->NotEnded()) {
+        IOBasicTypes::LongBufferSizeType readBytes = reader->Read(buffer.get(), READ_CHUNK_SIZE);
+        if (readBytes == 0) {
+            break;
+        }
+        hasher.Update(buffer.get(), static_cast<size_t>(readBytes));
+    }
+}
+
+uint64_t PdfObjectHasher::HashIndirectObject(ObjectIDType objectId, int depth) {
+    auto cached = indirectHashes_.find(objectId);
+    if (cached != indirectHashes_.end()) {
+        return cached->second;
+    }
+
+    // Reference cycle (e.g. annotation <-> page), or too many objects
+    // re-hashed for one top-level object: hash as a fixed marker
+    if (inProgress_[objectId] || resolveBudget_ == 0) {
+        orderDependent_ = true;
+        return 0;
+    }
+    --resolveBudget_;
+
+    // Track whether this object's hash met a cycle marker or the depth limit;
+    // such a hash depends on where the traversal entered and is not memoized
+    bool outerOrderDependent = orderDependent_;
+    orderDependent_ = false;
+
+    inProgress_[objectId] = true;
+    RefCountPtr<PDFObject> resolved(parser_.ParseNewObject(objectId));
+    uint64_t digest = HashObjectAt(resolved.GetPtr(), depth);
+    inProgress_.erase(objectId);
+
+    if (!orderDependent_) {
+        indirectHashes_[objectId] = digest;
+    }
+    orderDependent_ = outerOrderDependent || orderDependent_;
+    return digest;
+}
+
+} // namespace PdfParser
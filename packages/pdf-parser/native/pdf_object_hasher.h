@@ -0,0 +1,68 @@
+/**
+ * PDF Object Hasher
+ *
+ * Structural hashing of PDF objects resolved through a PDFParser.
+ * Indirect references are followed and hashed by content (not by object
+ * number), so identical pages in two different files hash the same.
+ * Each indirect object is hashed once per parser and memoized, which keeps
+ * shared resources (fonts, images) from being re-read for every page.
+ * Hashes that met a reference cycle or the depth limit depend on traversal
+ * order, so they are not memoized.
+ */
+
+#ifndef PDF_OBJECT_HASHER_H
+#define PDF_OBJECT_HASHER_H
+
+#include "hash_utils.h"
+#include "PDFParser.h"
+#include "ObjectsBasicTypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+class PDFObject;
+class PDFDictionary;
+class PDFStreamInput;
+
+namespace PdfParser {
+
+class PdfObjectHasher {
+public:
+    explicit PdfObjectHasher(PDFParser& parser);
+
+    /**
+     * Hash a direct or indirect object, following references
+     */
+    uint64_t HashObject(PDFObject* obj);
+
+    /**
+     * Feed the decoded bytes of a stream into a hasher. When the filters
+     * cannot be decoded, the stream dictionary and stored bytes are hashed
+     * instead, so distinct undecodable streams still hash differently.
+     * @return false if the raw bytes were hashed instead of decoded ones
+     */
+    bool HashDecodedStream(PDFStreamInput* stream, Fnv1a64& hasher);
+
+    /**
+     * Query a page attribute, walking up the page tree for inheritable
+     * keys (Resources, MediaBox, CropBox, Rotate)
+     * @return Resolved object (caller owns the reference) or nullptr
+     */
+    PDFObject* QueryInheritedPageValue(PDFDictionary* page, const std::string& key);
+
+private:
+    uint64_t HashObjectAt(PDFObject* obj, int depth);
+    void WriteObject(Fnv1a64& hasher, PDFObject* obj, int depth);
+    void WriteRawStream(Fnv1a64& hasher, PDFStreamInput* stream, int depth);
+    uint64_t HashIndirectObject(ObjectIDType objectId, int depth);
+
+    PDFParser& parser_;
+    std::unordered_map<ObjectIDType, uint64_t> indirectHashes_;
+    std::unordered_map<ObjectIDType, bool> inProgress_;
+    bool orderDependent_;   // Current indirect hash met a cycle marker or the depth limit
+    size_t resolveBudget_;  // Indirect objects HashObject may still resolve
+};
+
+} // namespace PdfParser
+
+#endif // PDF_OBJECT_HASHER_H
@@ -0,0 +1,25 @@
+/**
+ * PDF Text Strings Implementation
+ */
+
+#include "pdf_text_string.h"
+#include "PDFHexString.h"
+#include "PDFLiteralString.h"
+#include "PDFTextString.h"
+
+namespace PdfParser {
+
+std::string GetTextString(PDFObject* obj) {
+    if (!obj) {
+        return "";
+    }
+    if (obj->GetType() == PDFObject::ePDFObjectLiteralString) {
+        return PDFTextString(static_cast<PDFLiteralString*>(obj)->GetValue()).ToUTF8String();
+    }
+    if (obj->GetType() == PDFObject::ePDFObjectHexString) {
+        return PDFTextString(static_cast<PDFHexString*>(obj)->GetValue()).ToUTF8String();
+    }
+    return "";
+}
+
+} // namespace PdfParser
@@ -0,0 +1,26 @@
+/**
+ * PDF Text Strings
+ *
+ * Decoding of PDF text strings (outline titles, page label prefixes and
+ * other human-readable values) shared by the readers that report them.
+ */
+
+#ifndef PDF_TEXT_STRING_H
+#define PDF_TEXT_STRING_H
+
+#include "PDFObject.h"
+#include <string>
+
+namespace PdfParser {
+
+/**
+ * Decode a PDF text string (PDFDocEncoding or UTF-16BE) to UTF-8
+ *
+ * @param obj Literal or hex string object, may be null
+ * @return The decoded string, or empty for null and non-string objects
+ */
+std::string GetTextString(PDFObject* obj);
+
+} // namespace PdfParser
+
+#endif // PDF_TEXT_STRING_H
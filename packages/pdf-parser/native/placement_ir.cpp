@@ -0,0 +1,187 @@
+/**
+ * Placement IR Implementation
+ */
+
+#include "placement_ir.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace PdfParser {
+
+static const char MAGIC[4] = {'P', 'T', 'I', 'R'};
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const uint32_t VERSION = 1;
+
+struct IRHeader {
+    char magic[4];
+    uint32_t byteOrderMark;
+    uint32_t version;
+    uint32_t pageCount;
+    uint32_t placementCount;
+    uint32_t reserved;
+    uint64_t stringPoolSize;
+};
+
+struct IRPage {
+    uint32_t firstPlacement;
+    uint32_t placementCount;
+};
+
+struct IRPlacement {
+    double matrix[6];
+    double localBbox[4];
+    double globalBbox[4];
+    double spaceWidth;
+    double globalSpaceWidth[2];
+    uint32_t textOffset;
+    uint32_t textLength;
+};
+
+static_assert(sizeof(IRHeader) == 32, "IR header must be 32 bytes");
+static_assert(sizeof(IRPage) == 8, "IR page record must be 8 bytes");
+static_assert(sizeof(IRPlacement) == 144, "IR placement record must be 144 bytes");
+
+// ============================================================================
+// SERIALIZATION
+// ============================================================================
+
+void SerializePlacements(const ParsedTextPlacementListList& textsForPages, std::vector<uint8_t>& outData) {
+    std::vector<IRPage> pages;
+    std::vector<IRPlacement> placements;
+    std::string stringPool;
+    std::unordered_map<std::string, uint32_t> pooledTexts;
+
+    pages.reserve(textsForPages.size());
+    for (const auto& pagePlacements : textsForPages) {
+        IRPage page = {static_cast<uint32_t>(placements.size()), static_cast<uint32_t>(pagePlacements.size())};
+        pages.push_back(page);
+
+        for (const auto& placement : pagePlacements) {
+            // Runs repeat a lot (single glyphs, spaces, running headers), so pool them
+            auto pooled = pooledTexts.find(placement.text);
+            uint32_t textOffset;
+            if (pooled != pooledTexts.end()) {
+                textOffset = pooled->second;
+            } else {
+                if (stringPool.size() + placement.text.size() > UINT32_MAX) {
+                    throw std::runtime_error("Placement text exceeds the IR string pool limit");
+                }
+                textOffset = static_cast<uint32_t>(stringPool.size());
+                stringPool += placement.text;
+                pooledTexts.emplace(placement.text, textOffset);
+            }
+
+            IRPlacement record;
+            std::memcpy(record.matrix, placement.matrix, sizeof(record.matrix));
+            std::memcpy(record.localBbox, placement.localBbox, sizeof(record.localBbox));
+            std::memcpy(record.globalBbox, placement.globalBbox, sizeof(record.globalBbox));
+            record.spaceWidth = placement.spaceWidth;
+            std::memcpy(record.globalSpaceWidth, placement.globalSpaceWidth, sizeof(record.globalSpaceWidth));
+            record.textOffset = textOffset;
+            record.textLength = static_cast<uint32_t>(placement.text.size());
+            placements.push_back(record);
+        }
+    }
+
+    IRHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.version = VERSION;
+    header.pageCount = static_cast<uint32_t>(pages.size());
+    header.placementCount = static_cast<uint32_t>(placements.size());
+    header.reserved = 0;
+    header.stringPoolSize = stringPool.size();
+
+    size_t pagesSize = pages.size() * sizeof(IRPage);
+    size_t placementsSize = placements.size() * sizeof(IRPlacement);
+    outData.resize(sizeof(IRHeader) + pagesSize + placementsSize + stringPool.size());
+
+    uint8_t* out = outData.data();
+    std::memcpy(out, &header, sizeof(IRHeader));
+    out += sizeof(IRHeader);
+    if (pagesSize > 0) {
+        std::memcpy(out, pages.data(), pagesSize);
+        out += pagesSize;
+    }
+    if (placementsSize > 0) {
+        std::memcpy(out, placements.data(), placementsSize);
+        out += placementsSize;
+    }
+    std::memcpy(out, stringPool.data(), stringPool.size());
+}
+
+// ============================================================================
+// DESERIALIZATION
+// ============================================================================
+
+void DeserializePlacements(
+    const uint8_t* data,
+    size_t size,
+    long startPage,
+    long endPage,
+    ParsedTextPlacementListList& outTextsForPages
+) {
+    IRHeader header;
+    if (size < sizeof(IRHeader)) {
+        throw std::runtime_error("Invalid placement IR: truncated header");
+    }
+    std::memcpy(&header, data, sizeof(IRHeader));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.byteOrderMark != BYTE_ORDER_MARK) {
+        throw std::runtime_error("Invalid placement IR: bad magic or byte order");
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error("Invalid placement IR: unsupported version " + std::to_string(header.version));
+    }
+
+    // Sections must fit in the blob before anything is read from them
+    uint64_t pagesSize = static_cast<uint64_t>(header.pageCount) * sizeof(IRPage);
+    uint64_t placementsSize = static_cast<uint64_t>(header.placementCount) * sizeof(IRPlacement);
+    if (sizeof(IRHeader) + pagesSize + placementsSize + header.stringPoolSize != size) {
+        throw std::runtime_error("Invalid placement IR: size mismatch");
+    }
+    const uint8_t* pageTable = data + sizeof(IRHeader);
+    const uint8_t* placementTable = pageTable + pagesSize;
+    const char* stringPool = reinterpret_cast<const char*>(placementTable + placementsSize);
+
+    // A document without pages still composes from page 0, to empty text
+    long lastPage = static_cast<long>(header.pageCount) - 1;
+    if (startPage < 0 || (startPage > lastPage && startPage > 0)) {
+        throw std::runtime_error("Start page is past the last page");
+    }
+    if (endPage < 0 || endPage > lastPage) {
+        endPage = lastPage;
+    }
+
+    outTextsForPages.clear();
+    for (long pageIndex = startPage; pageIndex <= endPage; ++pageIndex) {
+        IRPage page;
+        std::memcpy(&page, pageTable + pageIndex * sizeof(IRPage), sizeof(IRPage));
+        if (static_cast<uint64_t>(page.firstPlacement) + page.placementCount > header.placementCount) {
+            throw std::runtime_error("Invalid placement IR: page out of bounds");
+        }
+
+        outTextsForPages.emplace_back();
+        ParsedTextPlacementList& pagePlacements = outTextsForPages.back();
+        for (uint32_t i = 0; i < page.placementCount; ++i) {
+            IRPlacement record;
+            std::memcpy(&record, placementTable + (page.firstPlacement + static_cast<uint64_t>(i)) * sizeof(IRPlacement),
+                        sizeof(IRPlacement));
+            if (static_cast<uint64_t>(record.textOffset) + record.textLength > header.stringPoolSize) {
+                throw std::runtime_error("Invalid placement IR: text out of bounds");
+            }
+
+            pagePlacements.push_back(ParsedTextPlacement(
+                std::string(stringPool + record.textOffset, record.textLength),
+                record.matrix,
+                record.localBbox,
+                record.globalBbox,
+                record.spaceWidth,
+                record.globalSpaceWidth
+            ));
+        }
+    }
+}
+
+} // namespace PdfParser
@@ -0,0 +1,62 @@
+/**
+ * Placement IR
+ *
+ * Compact binary form of the text placements extracted from a document
+ * (TextExtraction::textsForPages), for composing text again without parsing
+ * or interpreting the PDF. Composition takes only the placements, so a
+ * different direction or page range can be served from this form alone.
+ *
+ * Layout (host byte order, all offsets relative to the start of the blob,
+ * so a blob can be stored, copied or memory-mapped as-is):
+ *
+ *   header      32 bytes: magic "PTIR", byte-order mark, version, page count,
+ *               placement count, string pool size
+ *   page table  8 bytes per page: first placement, placement count
+ *   placements  144 bytes each: matrix[6], localBbox[4], globalBbox[4],
+ *               spaceWidth, globalSpaceWidth[2] as doubles, then the offset
+ *               and length of the text in the string pool
+ *   string pool UTF-8 texts, each distinct text stored once
+ *
+ * Coordinates are kept as doubles so that composing from the IR gives the
+ * same text as composing right after extraction.
+ */
+
+#ifndef PLACEMENT_IR_H
+#define PLACEMENT_IR_H
+
+#include "TextExtraction.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace PdfParser {
+
+/**
+ * Serialize the placements of all pages
+ *
+ * @param textsForPages Placements per page, in page order
+ * @param outData Receives the blob
+ */
+void SerializePlacements(const ParsedTextPlacementListList& textsForPages, std::vector<uint8_t>& outData);
+
+/**
+ * Rebuild the placements of a page range
+ *
+ * @param data Blob written by SerializePlacements (any alignment)
+ * @param size Blob size in bytes
+ * @param startPage First page to rebuild (0-based)
+ * @param endPage Last page to rebuild, inclusive (-1 or past the end = last page)
+ * @param outTextsForPages Receives one placement list per page
+ * @throws std::runtime_error if the blob is malformed or startPage is past the last page
+ */
+void DeserializePlacements(
+    const uint8_t* data,
+    size_t size,
+    long startPage,
+    long endPage,
+    ParsedTextPlacementListList& outTextsForPages
+);
+
+} // namespace PdfParser
+
+#endif // PLACEMENT_IR_H
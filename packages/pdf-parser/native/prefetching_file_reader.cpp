@@ -0,0 +1,488 @@
+/**
+ * PrefetchingFileReader Implementation
+ */
+
+#include "prefetching_file_reader.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef PDF_PARSER_IO_URING
+#include <liburing.h>
+#endif
+
+namespace {
+
+const uint64_t BLOCK_SIZE = 256 * 1024;
+
+// Cache size per reader: 16MB
+const size_t MAX_CACHED_BLOCKS = 64;
+
+// Blocks read ahead of each block accessed
+const uint64_t READ_AHEAD_BLOCKS = 4;
+
+// Blocks at the end of the file read on open: the trailer and, for most
+// files, the cross-reference table the parser reads next
+const uint64_t TAIL_BLOCKS = 2;
+
+#ifdef PDF_PARSER_IO_URING
+const unsigned URING_QUEUE_DEPTH = 16;
+#endif
+
+std::atomic<uint64_t> totalHits(0);
+std::atomic<uint64_t> totalWaits(0);
+std::atomic<uint64_t> totalMisses(0);
+std::atomic<uint64_t> totalPrefetches(0);
+std::atomic<bool> lastReaderUsedIoUring(false);
+
+#ifndef _WIN32
+/**
+ * pread() until length bytes are read or the file ends
+ * @return Bytes read, or -1 on error
+ */
+ssize_t ReadFully(int fd, uint8_t* buffer, size_t length, uint64_t offset) {
+    size_t total = 0;
+    while (total < length) {
+        ssize_t count = pread(fd, buffer + total, length - total, static_cast<off_t>(offset + total));
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (count == 0) {
+            break;  // EOF
+        }
+        total += static_cast<size_t>(count);
+    }
+    return static_cast<ssize_t>(total);
+}
+#endif
+
+}  // namespace
+
+ReadCacheStats PrefetchingFileReader::GetTotalStats() {
+    return ReadCacheStats{
+        totalHits.load(),
+        totalWaits.load(),
+        totalMisses.load(),
+        totalPrefetches.load(),
+        lastReaderUsedIoUring.load()
+    };
+}
+
+#ifndef _WIN32
+
+// ============================================================================
+// BLOCKS AND LOADERS
+// ============================================================================
+
+struct PrefetchingFileReader::Block {
+    uint64_t offset = 0;
+    size_t length = 0;                  // Bytes of the file in this block
+    std::unique_ptr<uint8_t[]> data;
+    // Set when the read finished; guarded by the loader for blocks read ahead
+    bool done = false;
+    bool failed = false;
+    std::list<uint64_t>::iterator recency;
+};
+
+/**
+ * Reads blocks in the background
+ */
+class PrefetchingFileReader::Loader {
+public:
+    virtual ~Loader() = default;
+
+    /** Start reading a block */
+    virtual void Start(Block* block) = 0;
+
+    /** Whether a started block's read finished */
+    virtual bool Done(Block* block) = 0;
+
+    /** Wait until a started block's read finished */
+    virtual void Wait(Block* block) = 0;
+};
+
+/**
+ * Reads blocks with pread() on a helper thread, in request order
+ */
+class PrefetchingFileReader::PreadLoader : public PrefetchingFileReader::Loader {
+public:
+    explicit PreadLoader(int fd) : fd_(fd), stopping_(false), thread_(&PreadLoader::Run, this) {
+    }
+
+    ~PreadLoader() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            queue_.clear();
+        }
+        cv_.notify_all();
+        thread_.join();
+    }
+
+    void Start(Block* block) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(block);
+        }
+        cv_.notify_all();
+    }
+
+    bool Done(Block* block) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return block->done;
+    }
+
+    void Wait(Block* block) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        // The parser is blocked on this one, so it goes next
+        auto queued = std::find(queue_.begin(), queue_.end(), block);
+        if (queued != queue_.end()) {
+            queue_.erase(queued);
+            queue_.push_front(block);
+        }
+        cv_.wait(lock, [block]() { return block->done; });
+    }
+
+private:
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            Block* block = queue_.front();
+            queue_.pop_front();
+
+            lock.unlock();
+            ssize_t count = ReadFully(fd_, block->data.get(), block->length, block->offset);
+            lock.lock();
+
+            block->done = true;
+            block->failed = count != static_cast<ssize_t>(block->length);
+            cv_.notify_all();
+        }
+    }
+
+    int fd_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Block*> queue_;
+    bool stopping_;
+    // Started last, once the members it uses exist
+    std::thread thread_;
+};
+
+#ifdef PDF_PARSER_IO_URING
+/**
+ * Reads blocks through an io_uring submission queue, without extra threads.
+ * Completions are collected whenever the reader checks on a block.
+ */
+class PrefetchingFileReader::IoUringLoader : public PrefetchingFileReader::Loader {
+public:
+    explicit IoUringLoader(int fd) : fd_(fd), inFlight_(0) {
+        int status = io_uring_queue_init(URING_QUEUE_DEPTH, &ring_, 0);
+        if (status < 0) {
+            throw std::runtime_error(std::string("io_uring unavailable: ") + std::strerror(-status));
+        }
+    }
+
+    ~IoUringLoader() override {
+        // The kernel writes into the blocks until their reads complete
+        while (inFlight_ > 0 && ReapOne()) {
+        }
+        io_uring_queue_exit(&ring_);
+    }
+
+    void Start(Block* block) override {
+        if (inFlight_ >= URING_QUEUE_DEPTH) {
+            ReapOne();
+        }
+        io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+        if (!sqe) {
+            // Left for the reader to read on demand
+            block->done = true;
+            block->failed = true;
+            return;
+        }
+        io_uring_prep_read(sqe, fd_, block->data.get(), static_cast<unsigned>(block->length), block->offset);
+        io_uring_sqe_set_data(sqe, block);
+        io_uring_submit(&ring_);
+        ++inFlight_;
+    }
+
+    bool Done(Block* block) override {
+        io_uring_cqe* cqe;
+        while (!block->done && io_uring_peek_cqe(&ring_, &cqe) == 0) {
+            Complete(cqe);
+        }
+        return block->done;
+    }
+
+    void Wait(Block* block) override {
+        while (!block->done) {
+            if (!ReapOne()) {
+                block->done = true;
+                block->failed = true;
+            }
+        }
+    }
+
+private:
+    bool ReapOne() {
+        io_uring_cqe* cqe;
+        int status;
+        do {
+            status = io_uring_wait_cqe(&ring_, &cqe);
+        } while (status == -EINTR);
+        if (status < 0) {
+            return false;
+        }
+        Complete(cqe);
+        return true;
+    }
+
+    void Complete(io_uring_cqe* cqe) {
+        Block* block = static_cast<Block*>(io_uring_cqe_get_data(cqe));
+        int result = cqe->res;
+        io_uring_cqe_seen(&ring_, cqe);
+        --inFlight_;
+
+        block->done = true;
+        block->failed = result < 0;
+        size_t count = result > 0 ? static_cast<size_t>(result) : 0;
+        if (!block->failed && count < block->length) {
+            // Short read: finish it synchronously
+            ssize_t rest = ReadFully(fd_, block->data.get() + count, block->length - count, block->offset + count);
+            block->failed = rest < 0 || count + static_cast<size_t>(rest) != block->length;
+        }
+    }
+
+    int fd_;
+    io_uring ring_;
+    unsigned inFlight_;
+};
+#endif
+
+std::unique_ptr<PrefetchingFileReader::Loader> PrefetchingFileReader::CreateLoader(int fd) {
+#ifdef PDF_PARSER_IO_URING
+    try {
+        std::unique_ptr<Loader> loader(new IoUringLoader(fd));
+        lastReaderUsedIoUring = true;
+        return loader;
+    } catch (const std::runtime_error&) {
+        // Old kernel, or io_uring filtered out (common in containers)
+    }
+#endif
+    lastReaderUsedIoUring = false;
+    return std::unique_ptr<Loader>(new PreadLoader(fd));
+}
+
+// ============================================================================
+// READER
+// ============================================================================
+
+PrefetchingFileReader::PrefetchingFileReader(const std::string& filePath)
+    : fd_(-1), size_(0), blockCount_(0), position_(0), current_(nullptr), currentIndex_(0),
+      hits_(0), waits_(0), misses_(0), prefetches_(0) {
+    fd_ = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+        throw std::runtime_error("Failed to open PDF file");
+    }
+
+    struct stat stats;
+    if (fstat(fd_, &stats) != 0) {
+        close(fd_);
+        throw std::runtime_error("Failed to open PDF file");
+    }
+    size_ = static_cast<uint64_t>(stats.st_size);
+    blockCount_ = (size_ + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+    try {
+        loader_ = CreateLoader(fd_);
+
+        // The parser starts from the trailer at the end, then reads the
+        // cross-reference data and the header
+        for (uint64_t i = 0; i < TAIL_BLOCKS && i < blockCount_; ++i) {
+            Prefetch(blockCount_ - 1 - i);
+        }
+        Prefetch(0);
+    } catch (...) {
+        loader_.reset();
+        close(fd_);
+        throw;
+    }
+}
+
+PrefetchingFileReader::~PrefetchingFileReader() {
+    loader_.reset();
+    close(fd_);
+
+    totalHits += hits_;
+    totalWaits += waits_;
+    totalMisses += misses_;
+    totalPrefetches += prefetches_;
+}
+
+IOBasicTypes::LongBufferSizeType PrefetchingFileReader::Read(
+    IOBasicTypes::Byte* inBuffer,
+    IOBasicTypes::LongBufferSizeType inBufferSize) {
+
+    IOBasicTypes::LongBufferSizeType copied = 0;
+    while (copied < inBufferSize && position_ < size_) {
+        uint64_t index = position_ / BLOCK_SIZE;
+        if (!current_ || currentIndex_ != index) {
+            LoadBlock(index);
+        }
+
+        size_t offsetInBlock = static_cast<size_t>(position_ - current_->offset);
+        if (offsetInBlock >= current_->length) {
+            break;  // The file shrank since it was opened
+        }
+        size_t count = std::min(
+            static_cast<size_t>(inBufferSize - copied),
+            current_->length - offsetInBlock
+        );
+        std::memcpy(inBuffer + copied, current_->data.get() + offsetInBlock, count);
+        copied += count;
+        position_ += count;
+    }
+    return copied;
+}
+
+bool PrefetchingFileReader::NotEnded() {
+    return position_ < size_;
+}
+
+void PrefetchingFileReader::SetPosition(IOBasicTypes::LongFilePositionType inOffsetFromStart) {
+    if (inOffsetFromStart < 0) {
+        position_ = 0;
+    } else if (static_cast<uint64_t>(inOffsetFromStart) > size_) {
+        position_ = size_;
+    } else {
+        position_ = static_cast<uint64_t>(inOffsetFromStart);
+    }
+}
+
+void PrefetchingFileReader::SetPositionFromEnd(IOBasicTypes::LongFilePositionType inOffsetFromEnd) {
+    if (inOffsetFromEnd < 0 || static_cast<uint64_t>(inOffsetFromEnd) > size_) {
+        position_ = 0;
+    } else {
+        position_ = size_ - static_cast<uint64_t>(inOffsetFromEnd);
+    }
+}
+
+IOBasicTypes::LongFilePositionType PrefetchingFileReader::GetCurrentPosition() {
+    return static_cast<IOBasicTypes::LongFilePositionType>(position_);
+}
+
+void PrefetchingFileReader::Skip(IOBasicTypes::LongBufferSizeType inSkipSize) {
+    position_ = std::min(size_, position_ + static_cast<uint64_t>(inSkipSize));
+}
+
+void PrefetchingFileReader::LoadBlock(uint64_t index) {
+    Block* block;
+    auto found = blocks_.find(index);
+    if (found != blocks_.end()) {
+        block = found->second.get();
+        if (loader_->Done(block)) {
+            ++hits_;
+        } else {
+            ++waits_;
+            loader_->Wait(block);
+        }
+        if (block->failed) {
+            ReadNow(block);
+        }
+        Touch(block);
+    } else {
+        ++misses_;
+        if (blocks_.size() >= MAX_CACHED_BLOCKS) {
+            EvictOne();
+        }
+        block = InsertBlock(index);
+        ReadNow(block);
+    }
+
+    // Pin the block being read before prefetching, so eviction never frees it
+    current_ = block;
+    currentIndex_ = index;
+
+    for (uint64_t ahead = 1; ahead <= READ_AHEAD_BLOCKS; ++ahead) {
+        if (!Prefetch(index + ahead)) {
+            break;
+        }
+    }
+}
+
+PrefetchingFileReader::Block* PrefetchingFileReader::InsertBlock(uint64_t index) {
+    std::unique_ptr<Block> block(new Block());
+    block->offset = index * BLOCK_SIZE;
+    block->length = static_cast<size_t>(std::min(BLOCK_SIZE, size_ - block->offset));
+    block->data.reset(new uint8_t[block->length]);
+    recency_.push_front(index);
+    block->recency = recency_.begin();
+
+    Block* inserted = block.get();
+    blocks_[index] = std::move(block);
+    return inserted;
+}
+
+bool PrefetchingFileReader::Prefetch(uint64_t index) {
+    if (index >= blockCount_ || blocks_.count(index) > 0) {
+        return true;
+    }
+    // Reading ahead never grows the cache past its limit
+    if (blocks_.size() >= MAX_CACHED_BLOCKS && !EvictOne()) {
+        return false;
+    }
+    Block* block = InsertBlock(index);
+    loader_->Start(block);
+    ++prefetches_;
+    return true;
+}
+
+void PrefetchingFileReader::ReadNow(Block* block) {
+    ssize_t count = ReadFully(fd_, block->data.get(), block->length, block->offset);
+    // A short block ends the stream early rather than failing the parse here
+    block->length = count > 0 ? static_cast<size_t>(count) : 0;
+    block->done = true;
+    block->failed = false;
+}
+
+void PrefetchingFileReader::Touch(Block* block) {
+    recency_.splice(recency_.begin(), recency_, block->recency);
+}
+
+bool PrefetchingFileReader::EvictOne() {
+    // Least recently used first; the block being read and blocks still being
+    // read ahead stay
+    for (auto it = recency_.rbegin(); it != recency_.rend(); ++it) {
+        uint64_t index = *it;
+        Block* block = blocks_[index].get();
+        if (block == current_ || !loader_->Done(block)) {
+            continue;
+        }
+        recency_.erase(block->recency);
+        blocks_.erase(index);
+        return true;
+    }
+    return false;
+}
+
+#endif // _WIN32
@@ -0,0 +1,111 @@
+/**
+ * PrefetchingFileReader - File Stream Reader with Read-Ahead
+ *
+ * Implements IByteReaderWithPosition over an in-memory block cache of a file.
+ * Blocks are read ahead of the parser in the background: the file's head and
+ * tail (header, xref and trailer) as soon as it is opened, then the blocks
+ * following each block accessed. On network-backed volumes, where each read
+ * waits on storage latency, the parser then mostly finds its data in memory
+ * instead of stalling on every miss.
+ *
+ * Background reads go through io_uring when built with PDF_PARSER_IO_URING and
+ * the kernel allows it, and through pread() on a helper thread otherwise.
+ * POSIX only.
+ */
+
+#ifndef PREFETCHING_FILE_READER_H
+#define PREFETCHING_FILE_READER_H
+
+#include "IByteReaderWithPosition.h"
+#include "IOBasicTypes.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Block cache counters, summed over all readers closed so far
+ */
+struct ReadCacheStats {
+    uint64_t hits;          // Blocks already in memory when needed
+    uint64_t waits;         // Blocks still being read ahead when needed
+    uint64_t misses;        // Blocks read on demand
+    uint64_t prefetches;    // Blocks read ahead
+    bool ioUring;           // Whether the last reader opened reads ahead through io_uring
+};
+
+/**
+ * PrefetchingFileReader: Implements IByteReaderWithPosition for local files
+ *
+ * Each reader owns its file handle and cache; helper threads open their own.
+ * Not safe for concurrent use.
+ */
+class PrefetchingFileReader : public IByteReaderWithPosition {
+public:
+    /**
+     * Open a file and start reading its head and tail
+     * @param filePath Path of the file
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    explicit PrefetchingFileReader(const std::string& filePath);
+
+    virtual ~PrefetchingFileReader();
+
+    PrefetchingFileReader(const PrefetchingFileReader&) = delete;
+    PrefetchingFileReader& operator=(const PrefetchingFileReader&) = delete;
+
+    // IByteReader interface
+    virtual IOBasicTypes::LongBufferSizeType Read(
+        IOBasicTypes::Byte* inBuffer,
+        IOBasicTypes::LongBufferSizeType inBufferSize) override;
+
+    virtual bool NotEnded() override;
+
+    // IByteReaderWithPosition interface
+    virtual void SetPosition(IOBasicTypes::LongFilePositionType inOffsetFromStart) override;
+    virtual void SetPositionFromEnd(IOBasicTypes::LongFilePositionType inOffsetFromEnd) override;
+    virtual IOBasicTypes::LongFilePositionType GetCurrentPosition() override;
+    virtual void Skip(IOBasicTypes::LongBufferSizeType inSkipSize) override;
+
+    /**
+     * Counters of all readers destroyed so far (process-wide)
+     */
+    static ReadCacheStats GetTotalStats();
+
+private:
+    struct Block;
+    class Loader;
+    class PreadLoader;
+    class IoUringLoader;
+
+    static std::unique_ptr<Loader> CreateLoader(int fd);
+
+    void LoadBlock(uint64_t index);     // Makes the block current
+    Block* InsertBlock(uint64_t index);
+    bool Prefetch(uint64_t index);      // false when the cache is full of unevictable blocks
+    void ReadNow(Block* block);
+    void Touch(Block* block);
+    bool EvictOne();
+
+    int fd_;
+    uint64_t size_;                 // File size in bytes
+    uint64_t blockCount_;
+    uint64_t position_;             // Current read position
+    const Block* current_;          // Block holding the last byte read, if any
+    uint64_t currentIndex_;
+
+    // Blocks by index, and their indexes from most to least recently used
+    std::unordered_map<uint64_t, std::unique_ptr<Block>> blocks_;
+    std::list<uint64_t> recency_;
+
+    // Declared after the blocks it writes into, so it is destroyed first
+    std::unique_ptr<Loader> loader_;
+
+    uint64_t hits_;
+    uint64_t waits_;
+    uint64_t misses_;
+    uint64_t prefetches_;
+};
+
+#endif // PREFETCHING_FILE_READER_H
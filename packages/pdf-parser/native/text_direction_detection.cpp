@@ -126,32 +126,40 @@ static bool AreSameLine(const ParsedTextPlacement& a, const ParsedTextPlacement&
     }
 }
 
+/**
+ * Decode the UTF-8 sequence starting at text[i]
+ * @return Number of bytes consumed, or 0 for an invalid/truncated sequence
+ */
+static int DecodeUtf8(const std::string& text, size_t i, unsigned int& codepoint) {
+    unsigned char c = static_cast<unsigned char>(text[i]);
+    if (c < 0x80) {
+        codepoint = c;
+        return 1;
+    } else if ((c & 0xE0) == 0xC0 && i + 1 < text.length()) {
+        codepoint = (c & 0x1F) << 6;
+        codepoint |= (static_cast<unsigned char>(text[i+1]) & 0x3F);
+        return 2;
+    } else if ((c & 0xF0) == 0xE0 && i + 2 < text.length()) {
+        codepoint = (c & 0x0F) << 12;
+        codepoint |= (static_cast<unsigned char>(text[i+1]) & 0x3F) << 6;
+        codepoint |= (static_cast<unsigned char>(text[i+2]) & 0x3F);
+        return 3;
+    } else if ((c & 0xF8) == 0xF0 && i + 3 < text.length()) {
+        codepoint = (c & 0x07) << 18;
+        codepoint |= (static_cast<unsigned char>(text[i+1]) & 0x3F) << 12;
+        codepoint |= (static_cast<unsigned char>(text[i+2]) & 0x3F) << 6;
+        codepoint |= (static_cast<unsigned char>(text[i+3]) & 0x3F);
+        return 4;
+    }
+    return 0;
+}
+
 void CountScriptCharacters(const std::string& text, int& rtlCount, int& ltrCount) {
     for (size_t i = 0; i < text.length(); ) {
         unsigned int codepoint = 0;
-        int bytes = 0;
-
-        // Decode UTF-8 to codepoint
-        unsigned char c = static_cast<unsigned char>(text[i]);
-        if (c < 0x80) {
-            codepoint = c;
-            bytes = 1;
-        } else if ((c & 0xE0) == 0xC0 && i + 1 < text.length()) {
-            codepoint = (c & 0x1F) << 6;
-            codepoint |= (static_cast<unsigned char>(text[i+1]) & 0x3F);
-            bytes = 2;
-        } else if ((c & 0xF0) == 0xE0 && i + 2 < text.length()) {
-            codepoint = (c & 0x0F) << 12;
-            codepoint |= (static_cast<unsigned char>(text[i+1]) & 0x3F) << 6;
-            codepoint |= (static_cast<unsigned char>(text[i+2]) & 0x3F);
-            bytes = 3;
-        } else if ((c & 0xF8) == 0xF0 && i + 3 < text.length()) {
-            codepoint = (c & 0x07) << 18;
-            codepoint |= (static_cast<unsigned char>(text[i+1]) & 0x3F) << 12;
-            codepoint |= (static_cast<unsigned char>(text[i+2]) & 0x3F) << 6;
-            codepoint |= (static_cast<unsigned char>(text[i+3]) & 0x3F);
-            bytes = 4;
-        } else {
+        int bytes = DecodeUtf8(text, i, codepoint);
+
+        if (bytes == 0) {
             // Invalid UTF-8, skip this byte
             i++;
             continue;
@@ -175,6 +183,23 @@ void CountScriptCharacters(const std::string& text, int& rtlCount, int& ltrCount
     }
 }
 
+/**
+ * Characters that can make the bidi algorithm reorder an LTR paragraph.
+ * Broader than the RTL script ranges above: it also covers Arabic-Indic
+ * digits (AN), presentation forms, historic RTL scripts and the explicit
+ * RLM/ALM/RLE/RLO/RLI marks.
+ */
+static bool RequiresBidiReordering(unsigned int codepoint) {
+    return (codepoint >= 0x0590 && codepoint <= 0x08FF) ||    // Hebrew .. Arabic Extended-A
+           (codepoint >= 0xFB1D && codepoint <= 0xFDFF) ||    // Hebrew/Arabic presentation forms A
+           (codepoint >= 0xFE70 && codepoint <= 0xFEFF) ||    // Arabic presentation forms B
+           (codepoint >= 0x10800 && codepoint <= 0x10FFF) ||  // Historic RTL scripts, Rumi numerals
+           (codepoint >= 0x1E800 && codepoint <= 0x1EFFF) ||  // Adlam, Arabic math symbols
+           codepoint == 0x200F ||                             // RLM
+           codepoint == 0x202B || codepoint == 0x202E ||      // RLE, RLO
+           codepoint == 0x2067;                               // RLI
+}
+
 /**
  * Analyze a single line to extract metrics
  */
@@ -352,4 +377,32 @@ int DetectTextDirection(const ParsedTextPlacementListList& textsForPages) {
     return alignmentVote;
 }
 
+bool ContainsRtlContent(const ParsedTextPlacementListList& textsForPages) {
+    for (const auto& pagePlacements : textsForPages) {
+        for (const auto& placement : pagePlacements) {
+            const std::string& text = placement.text;
+            for (size_t i = 0; i < text.length(); ) {
+                // ASCII is never RTL, skip it without decoding
+                if (static_cast<unsigned char>(text[i]) < 0x80) {
+                    i++;
+                    continue;
+                }
+
+                unsigned int codepoint = 0;
+                int bytes = DecodeUtf8(text, i, codepoint);
+                if (bytes == 0) {
+                    i++;
+                    continue;
+                }
+
+                if (RequiresBidiReordering(codepoint)) {
+                    return true;
+                }
+                i += bytes;
+            }
+        }
+    }
+    return false;
+}
+
 } // namespace PdfParser
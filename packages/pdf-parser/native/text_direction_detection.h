@@ -6,7 +6,7 @@
  * 1. Alignment analysis (primary signal - 70% weight)
  * 2. Unicode script analysis (secondary signal - 30% weight)
  *
- * Public API: Only DetectTextDirection() is exposed.
+ * Public API: DetectTextDirection() and ContainsRtlContent() are exposed.
  * All other functions and structures are internal implementation details.
  *
  * @see docs/phase-9-text-direction-detection.md for detailed algorithm description
@@ -32,6 +32,18 @@ namespace PdfParser {
  */
 int DetectTextDirection(const ParsedTextPlacementListList& textsForPages);
 
+/**
+ * Check whether any placement needs the bidi algorithm at all
+ *
+ * Scans for characters that can cause reordering inside an LTR paragraph:
+ * RTL scripts (Hebrew, Arabic, Syriac, Thaana, ...), Arabic-Indic digits
+ * and explicit bidi control marks. Stops at the first match.
+ *
+ * @param textsForPages Text placements for all pages from TextExtraction
+ * @return true if bidi reordering may change the text, false for pure LTR content
+ */
+bool ContainsRtlContent(const ParsedTextPlacementListList& textsForPages);
+
 } // namespace PdfParser
 
 #endif // TEXT_DIRECTION_DETECTION_H
@@ -0,0 +1,206 @@
+/**
+ * Archive Extraction Base Worker Implementation
+ */
+
+#include "archive_extraction_base_worker.h"
+#include "../buffer_byte_reader.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace PdfParser;
+
+ArchiveExtractionBaseWorker::ArchiveExtractionBaseWorker(
+    Napi::Env env,
+    int bidiDirection,
+    const TextExtractionOptions& options,
+    const ArchiveExtractionOptions& archiveOptions,
+    const Napi::Function& onEntry
+) : Napi::AsyncProgressQueueWorker<ArchiveEntryResult>(env),
+    bidiDirection_(bidiDirection),
+    options_(options),
+    archiveOptions_(archiveOptions),
+    cancelled_(false),
+    entryCount_(0),
+    failedCount_(0),
+    onEntry_(Napi::Persistent(onEntry)),
+    deferred_(Napi::Promise::Deferred::New(env)) {
+}
+
+Napi::Promise ArchiveExtractionBaseWorker::GetPromise() {
+    return deferred_.Promise();
+}
+
+void ArchiveExtractionBaseWorker::Cancel() {
+    cancelled_.store(true);
+}
+
+// ============================================================================
+// EXTRACTION (worker threads)
+// ============================================================================
+
+ArchiveEntryResult ArchiveExtractionBaseWorker::ExtractEntry(
+    IByteReaderWithPosition* archive,
+    const ZipEntry& entry,
+    uint32_t index,
+    std::vector<uint8_t>& entryData
+) {
+    auto startTime = std::chrono::steady_clock::now();
+    ArchiveEntryResult entryResult;
+    entryResult.name = entry.name;
+    entryResult.index = index;
+    entryResult.fileSize = entry.uncompressedSize;
+    entryResult.result = {"", 0, bidiDirection_, false};
+
+    try {
+        uint64_t maxSize = archiveOptions_.maxEntrySize > 0
+            ? archiveOptions_.maxEntrySize
+            : std::numeric_limits<uint64_t>::max();
+        ReadZipEntry(archive, entry, maxSize, entryData);
+
+        // Same path as buffer extraction; page helpers share the inflated bytes
+        BufferByteReader entryReader(entryData.data(), entryData.size());
+        StreamFactory openHelperStream = [&entryData]() -> std::unique_ptr<IByteReaderWithPosition> {
+            return std::unique_ptr<IByteReaderWithPosition>(
+                new BufferByteReader(entryData.data(), entryData.size())
+            );
+        };
+        entryResult.result = TextExtractionBaseWorker::ExtractTextCore(
+            &entryReader, bidiDirection_, options_, openHelperStream, &cancelled_
+        );
+    } catch (const std::exception& e) {
+        entryResult.error = std::string("Extraction failed: ") + e.what();
+    }
+
+    entryResult.processingTime = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime
+    ).count();
+    return entryResult;
+}
+
+void ArchiveExtractionBaseWorker::Execute(const ExecutionProgress& progress) {
+    try {
+        // Check cancellation
+        if (cancelled_.load()) {
+            SetError("Operation cancelled");
+            return;
+        }
+
+        std::unique_ptr<IByteReaderWithPosition> stream;
+        try {
+            stream = OpenArchiveStream();
+        } catch (const std::runtime_error&) {
+            SetError("Failed to open archive");
+            return;
+        }
+
+        std::vector<ZipEntry> entries;
+        ReadZipEntries(stream.get(), entries);
+        entries.erase(
+            std::remove_if(entries.begin(), entries.end(),
+                           [](const ZipEntry& entry) { return !IsPdfZipEntry(entry); }),
+            entries.end()
+        );
+        entryCount_ = static_cast<uint32_t>(entries.size());
+
+        // Threads take the next entry until none are left
+        std::atomic<uint32_t> nextEntry(0);
+        auto extractEntries = [this, &entries, &nextEntry, &progress](IByteReaderWithPosition* archive) {
+            std::vector<uint8_t> entryData;
+            uint32_t index;
+            while (!cancelled_.load() && (index = nextEntry.fetch_add(1)) < entryCount_) {
+                ArchiveEntryResult entryResult = ExtractEntry(archive, entries[index], index, entryData);
+                if (entryResult.result.cancelled) {
+                    return;
+                }
+                if (!entryResult.error.empty()) {
+                    failedCount_.fetch_add(1);
+                }
+                progress.Send(&entryResult, 1);
+            }
+        };
+
+        uint32_t threadCount = std::min<uint32_t>(
+            static_cast<uint32_t>(std::max(1, archiveOptions_.entryWorkers)),
+            entryCount_
+        );
+        std::vector<std::thread> helpers;
+        for (uint32_t i = 1; i < threadCount; ++i) {
+            helpers.emplace_back([this, &extractEntries]() {
+                // A helper that cannot open its stream leaves its share to the others
+                try {
+                    std::unique_ptr<IByteReaderWithPosition> helperStream = OpenArchiveStream();
+                    extractEntries(helperStream.get());
+                } catch (const std::exception&) {
+                }
+            });
+        }
+
+        // Helpers must always be joined; entry errors are already caught per entry
+        try {
+            extractEntries(stream.get());
+        } catch (const std::exception&) {
+        }
+
+        for (auto& helper : helpers) {
+            helper.join();
+        }
+
+        if (cancelled_.load()) {
+            SetError("Operation cancelled");
+        }
+
+    } catch (const std::exception& e) {
+        SetError(std::string("Archive extraction failed: ") + e.what());
+    }
+}
+
+// ============================================================================
+// RESULTS (JS thread)
+// ============================================================================
+
+void ArchiveExtractionBaseWorker::OnProgress(const ArchiveEntryResult* entries, size_t count) {
+    Napi::Env env = Env();
+    Napi::HandleScope scope(env);
+
+    for (size_t i = 0; i < count; ++i) {
+        const ArchiveEntryResult& entry = entries[i];
+        Napi::Object napiEntry = Napi::Object::New(env);
+        napiEntry.Set("name", Napi::String::New(env, entry.name));
+        napiEntry.Set("index", Napi::Number::New(env, entry.index));
+        napiEntry.Set("fileSize", Napi::Number::New(env, static_cast<double>(entry.fileSize)));
+        napiEntry.Set("processingTime", Napi::Number::New(env, entry.processingTime));
+
+        if (!entry.error.empty()) {
+            napiEntry.Set("error", Napi::String::New(env, entry.error));
+        } else {
+            napiEntry.Set("text", Napi::String::New(env, entry.result.text));
+            napiEntry.Set("pageCount", Napi::Number::New(env, entry.result.pageCount));
+            napiEntry.Set("bidiDirection", Napi::Number::New(env, entry.result.bidiDirection));
+            if (options_.minhashPermutations > 0) {
+                Napi::Array minhash = Napi::Array::New(env, entry.result.minhash.size());
+                for (size_t j = 0; j < entry.result.minhash.size(); ++j) {
+                    minhash.Set(static_cast<uint32_t>(j), Napi::Number::New(env, entry.result.minhash[j]));
+                }
+                napiEntry.Set("minhash", minhash);
+            }
+        }
+
+        onEntry_.Call({napiEntry});
+    }
+}
+
+void ArchiveExtractionBaseWorker::OnOK() {
+    Napi::Env env = Env();
+    Napi::Object summary = Napi::Object::New(env);
+    summary.Set("entryCount", Napi::Number::New(env, entryCount_));
+    summary.Set("failedCount", Napi::Number::New(env, failedCount_.load()));
+    deferred_.Resolve(summary);
+}
+
+void ArchiveExtractionBaseWorker::OnError(const Napi::Error& e) {
+    deferred_.Reject(e.Value());
+}
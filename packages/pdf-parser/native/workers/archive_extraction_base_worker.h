@@ -0,0 +1,101 @@
+/**
+ * Archive Extraction Base Worker
+ *
+ * Base class for zip archive text extraction workers (file and buffer).
+ * Extracts the text of every PDF entry of an archive, reporting each entry
+ * to JavaScript as soon as it is done, then resolves with a summary.
+ */
+
+#ifndef ARCHIVE_EXTRACTION_BASE_WORKER_H
+#define ARCHIVE_EXTRACTION_BASE_WORKER_H
+
+#include "cancellable_async_worker.h"
+#include "text_extraction_base_worker.h"
+#include "../zip_archive.h"
+#include <atomic>
+#include <memory>
+#include <string>
+
+/**
+ * Per-call options for archive operations, next to the per-entry TextExtractionOptions
+ */
+struct ArchiveExtractionOptions {
+    int entryWorkers = 1;           // Threads extracting entries concurrently
+    uint64_t maxEntrySize = 0;      // Largest uncompressed entry accepted (0 = no limit)
+};
+
+/**
+ * Result of one PDF entry of an archive
+ */
+struct ArchiveEntryResult {
+    std::string name;               // Path inside the archive
+    uint32_t index;                 // Position among the archive's PDF entries
+    uint64_t fileSize;              // Uncompressed size in bytes
+    double processingTime;          // Milliseconds spent inflating and extracting
+    std::string error;              // Empty on success
+    TextExtractionResult result;    // Extracted text (on success)
+};
+
+/**
+ * Base class for archive extraction workers
+ *
+ * Entries are handed out one at a time to options.entryWorkers threads, each
+ * reading through its own stream over the archive. An entry is inflated into
+ * a per-thread buffer that is reused for the next entry, so memory stays at
+ * about one entry per thread however large the archive. Failed entries are
+ * reported with their error and do not stop the others.
+ *
+ * Subclasses only implement OpenArchiveStream().
+ */
+class ArchiveExtractionBaseWorker
+    : public Napi::AsyncProgressQueueWorker<ArchiveEntryResult>, public ICancellable {
+public:
+    ArchiveExtractionBaseWorker(
+        Napi::Env env,
+        int bidiDirection,
+        const TextExtractionOptions& options,
+        const ArchiveExtractionOptions& archiveOptions,
+        const Napi::Function& onEntry
+    );
+
+    // Get the promise that will resolve/reject when all entries are done
+    Napi::Promise GetPromise();
+
+    // Called from JS thread to cancel the operation (implements ICancellable)
+    void Cancel() override;
+
+protected:
+    /**
+     * Open a stream over the whole archive; called once per extracting thread
+     * @throws std::runtime_error if the archive cannot be opened
+     */
+    virtual std::unique_ptr<IByteReaderWithPosition> OpenArchiveStream() const = 0;
+
+    void Execute(const ExecutionProgress& progress) override;
+    void OnProgress(const ArchiveEntryResult* entries, size_t count) override;
+    void OnOK() override;
+    void OnError(const Napi::Error& e) override;
+
+    int bidiDirection_;
+    TextExtractionOptions options_;
+    ArchiveExtractionOptions archiveOptions_;
+
+private:
+    /**
+     * Inflate and extract one entry. Errors are returned in the result.
+     */
+    ArchiveEntryResult ExtractEntry(
+        IByteReaderWithPosition* archive,
+        const PdfParser::ZipEntry& entry,
+        uint32_t index,
+        std::vector<uint8_t>& entryData
+    );
+
+    std::atomic<bool> cancelled_;
+    uint32_t entryCount_;
+    std::atomic<uint32_t> failedCount_;
+    Napi::FunctionReference onEntry_;
+    Napi::Promise::Deferred deferred_;
+};
+
+#endif // ARCHIVE_EXTRACTION_BASE_WORKER_H
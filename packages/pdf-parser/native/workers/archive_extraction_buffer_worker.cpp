@@ -0,0 +1,29 @@
+/**
+ * Archive Extraction Buffer Worker Implementation
+ */
+
+#include "archive_extraction_buffer_worker.h"
+#include "../buffer_byte_reader.h"
+#include <cstring>
+
+ArchiveExtractionFromBufferWorker::ArchiveExtractionFromBufferWorker(
+    Napi::Env env,
+    const uint8_t* data,
+    size_t size,
+    int bidiDirection,
+    const TextExtractionOptions& options,
+    const ArchiveExtractionOptions& archiveOptions,
+    const Napi::Function& onEntry
+) : ArchiveExtractionBaseWorker(env, bidiDirection, options, archiveOptions, onEntry),
+    bufferData_(new uint8_t[size]),
+    bufferSize_(size) {
+    // Copy buffer data for use in worker threads
+    std::memcpy(bufferData_.get(), data, size);
+}
+
+std::unique_ptr<IByteReaderWithPosition> ArchiveExtractionFromBufferWorker::OpenArchiveStream() const {
+    // Every thread gets its own reader over the same (read-only) copy
+    return std::unique_ptr<IByteReaderWithPosition>(
+        new BufferByteReader(bufferData_.get(), bufferSize_)
+    );
+}
@@ -0,0 +1,36 @@
+/**
+ * Archive Extraction Worker - Buffer-based
+ *
+ * Async worker for extracting text from the PDFs of a zip archive in memory.
+ */
+
+#ifndef ARCHIVE_EXTRACTION_BUFFER_WORKER_H
+#define ARCHIVE_EXTRACTION_BUFFER_WORKER_H
+
+#include "archive_extraction_base_worker.h"
+#include <memory>
+
+/**
+ * AsyncWorker for text extraction from a zip archive buffer
+ */
+class ArchiveExtractionFromBufferWorker : public ArchiveExtractionBaseWorker {
+public:
+    ArchiveExtractionFromBufferWorker(
+        Napi::Env env,
+        const uint8_t* data,
+        size_t size,
+        int bidiDirection,
+        const TextExtractionOptions& options,
+        const ArchiveExtractionOptions& archiveOptions,
+        const Napi::Function& onEntry
+    );
+
+protected:
+    std::unique_ptr<IByteReaderWithPosition> OpenArchiveStream() const override;
+
+private:
+    std::unique_ptr<uint8_t[]> bufferData_;
+    size_t bufferSize_;
+};
+
+#endif // ARCHIVE_EXTRACTION_BUFFER_WORKER_H
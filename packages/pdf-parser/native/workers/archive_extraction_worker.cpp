@@ -0,0 +1,32 @@
+/**
+ * Archive Extraction Worker Implementation
+ */
+
+#include "archive_extraction_worker.h"
+#include "../prefetching_file_reader.h"
+#include "InputFileStream.h"
+#include <stdexcept>
+
+ArchiveExtractionWorker::ArchiveExtractionWorker(
+    Napi::Env env,
+    const std::string& filePath,
+    int bidiDirection,
+    const TextExtractionOptions& options,
+    const ArchiveExtractionOptions& archiveOptions,
+    const Napi::Function& onEntry
+) : ArchiveExtractionBaseWorker(env, bidiDirection, options, archiveOptions, onEntry),
+    filePath_(filePath) {
+}
+
+std::unique_ptr<IByteReaderWithPosition> ArchiveExtractionWorker::OpenArchiveStream() const {
+#ifndef _WIN32
+    if (options_.prefetchReads) {
+        return std::unique_ptr<IByteReaderWithPosition>(new PrefetchingFileReader(filePath_));
+    }
+#endif
+    std::unique_ptr<InputFileStream> fileStream(new InputFileStream());
+    if (fileStream->Open(filePath_) != PDFHummus::eSuccess) {
+        throw std::runtime_error("Failed to open archive");
+    }
+    return fileStream;
+}
@@ -0,0 +1,37 @@
+/**
+ * Archive Extraction Worker - File-based
+ *
+ * Async worker for extracting text from the PDFs of a zip archive file.
+ */
+
+#ifndef ARCHIVE_EXTRACTION_WORKER_H
+#define ARCHIVE_EXTRACTION_WORKER_H
+
+#include "archive_extraction_base_worker.h"
+
+/**
+ * AsyncWorker for text extraction from a zip archive file
+ */
+class ArchiveExtractionWorker : public ArchiveExtractionBaseWorker {
+public:
+    ArchiveExtractionWorker(
+        Napi::Env env,
+        const std::string& filePath,
+        int bidiDirection,
+        const TextExtractionOptions& options,
+        const ArchiveExtractionOptions& archiveOptions,
+        const Napi::Function& onEntry
+    );
+
+protected:
+    /**
+     * Open a stream over the file, reading ahead when options_.prefetchReads is set
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    std::unique_ptr<IByteReaderWithPosition> OpenArchiveStream() const override;
+
+private:
+    std::string filePath_;
+};
+
+#endif // ARCHIVE_EXTRACTION_WORKER_H
@@ -3,12 +3,11 @@
  */
 
 #include "metadata_extraction_base_worker.h"
+#include "../lazy_xref_reader.h"
+#include "../pdf_text_string.h"
 #include "PDFParser.h"
 #include "PDFDictionary.h"
 #include "PDFObjectCast.h"
-#include "PDFLiteralString.h"
-#include "PDFHexString.h"
-#include "PDFTextString.h"
 #include "EStatusCode.h"
 #include <stdexcept>
 #include <cstdio>
@@ -17,28 +16,6 @@
 // HELPER FUNCTIONS
 // ============================================================================
 
-/**
- * Helper function to extract string value from PDF object
- * Properly decodes PDF strings (PDFDocEncoding or UTF-16BE) to UTF-8
- */
-static std::string GetStringFromPDFObject(PDFObject* obj) {
-    if (!obj) {
-        return "";
-    }
-
-    if (obj->GetType() == PDFObject::ePDFObjectLiteralString) {
-        PDFLiteralString* litStr = (PDFLiteralString*)obj;
-        PDFTextString textStr(litStr->GetValue());
-        return textStr.ToUTF8String();
-    } else if (obj->GetType() == PDFObject::ePDFObjectHexString) {
-        PDFHexString* hexStr = (PDFHexString*)obj;
-        PDFTextString textStr(hexStr->GetValue());
-        return textStr.ToUTF8String();
-    }
-
-    return "";
-}
-
 /**
  * Helper to set metadata field on Napi::Object (sets null if empty)
  */
@@ -54,85 +31,112 @@ static void SetMetadataField(Napi::Object& obj, const std::string& key, const st
 // CORE METADATA EXTRACTION LOGIC
 // ============================================================================
 
-MetadataExtractionResult MetadataExtractionBaseWorker::ExtractMetadataCore(
-    IByteReaderWithPosition* stream,
-    std::atomic<bool>* cancelFlag
-) {
-    // Check for cancellation before starting
-    if (cancelFlag && cancelFlag->load()) {
-        return {0, "", "", "", "", "", "", "", "", true};
-    }
-
-    // Create parser and parse from stream
-    PDFParser parser;
-    PDFHummus::EStatusCode status = parser.StartPDFParsing(stream);
-
-    if (status != PDFHummus::eSuccess) {
-        throw std::runtime_error("Failed to parse PDF from stream");
-    }
-
-    // Check for cancellation after parsing
-    if (cancelFlag && cancelFlag->load()) {
-        return {0, "", "", "", "", "", "", "", "", true};
-    }
-
-    MetadataExtractionResult result = {};
-    result.cancelled = false;
-
+/**
+ * Read the metadata fields of an opened document
+ * (PDFParser, or LazyXrefReader which offers the same queries)
+ */
+template <typename Document>
+static void ReadDocumentMetadata(Document& document, MetadataExtractionResult& result) {
     // Get page count
-    result.pageCount = parser.GetPagesCount();
+    result.pageCount = document.GetPagesCount();
 
     // Get PDF version
-    double pdfVersion = parser.GetPDFLevel();
+    double pdfVersion = document.GetPDFLevel();
     char versionStr[10];
     snprintf(versionStr, sizeof(versionStr), "%.1f", pdfVersion);
     result.version = versionStr;
 
     // Get trailer dictionary
-    PDFDictionary* trailer = parser.GetTrailer();
+    PDFDictionary* trailer = document.GetTrailer();
     if (trailer) {
         // Query Info dictionary
-        PDFObjectCastPtr<PDFDictionary> infoDict(parser.QueryDictionaryObject(trailer, "Info"));
+        PDFObjectCastPtr<PDFDictionary> infoDict(document.QueryDictionaryObject(trailer, "Info"));
 
         if (infoDict.GetPtr()) {
             // Extract metadata fields
             PDFObject* titleObj = infoDict->QueryDirectObject("Title");
             if (titleObj) {
-                result.title = GetStringFromPDFObject(titleObj);
+                result.title = PdfParser::GetTextString(titleObj);
             }
 
             PDFObject* authorObj = infoDict->QueryDirectObject("Author");
             if (authorObj) {
-                result.author = GetStringFromPDFObject(authorObj);
+                result.author = PdfParser::GetTextString(authorObj);
             }
 
             PDFObject* subjectObj = infoDict->QueryDirectObject("Subject");
             if (subjectObj) {
-                result.subject = GetStringFromPDFObject(subjectObj);
+                result.subject = PdfParser::GetTextString(subjectObj);
             }
 
             PDFObject* creatorObj = infoDict->QueryDirectObject("Creator");
             if (creatorObj) {
-                result.creator = GetStringFromPDFObject(creatorObj);
+                result.creator = PdfParser::GetTextString(creatorObj);
             }
 
             PDFObject* producerObj = infoDict->QueryDirectObject("Producer");
             if (producerObj) {
-                result.producer = GetStringFromPDFObject(producerObj);
+                result.producer = PdfParser::GetTextString(producerObj);
             }
 
             PDFObject* creationDateObj = infoDict->QueryDirectObject("CreationDate");
             if (creationDateObj) {
-                result.creationDate = GetStringFromPDFObject(creationDateObj);
+                result.creationDate = PdfParser::GetTextString(creationDateObj);
             }
 
             PDFObject* modDateObj = infoDict->QueryDirectObject("ModDate");
             if (modDateObj) {
-                result.modificationDate = GetStringFromPDFObject(modDateObj);
+                result.modificationDate = PdfParser::GetTextString(modDateObj);
             }
         }
     }
 
+    // Page label ranges (the number tree only, pages are not visited)
+    result.hasPageLabels = PdfParser::ReadPageLabelRanges(document, result.pageLabelRanges);
+}
+
+MetadataExtractionResult MetadataExtractionBaseWorker::ExtractMetadataCore(
+    IByteReaderWithPosition* stream,
+    const MetadataExtractionOptions& options,
+    std::atomic<bool>* cancelFlag
+) {
+    // Check for cancellation before starting
+    if (cancelFlag && cancelFlag->load()) {
+        return {0, "", "", "", "", "", "", "", "", false, {}, true};
+    }
+
+    MetadataExtractionResult result = {};
+    result.cancelled = false;
+
+    // Lazy mode: a handful of small reads, whatever the object count
+    if (options.lazyXref) {
+        try {
+            PdfParser::LazyXrefReader reader;
+            if (reader.Open(stream)) {
+                ReadDocumentMetadata(reader, result);
+                return result;
+            }
+        } catch (const std::runtime_error&) {
+            // Damaged or unusual xref: PDFParser knows how to recover
+        }
+        result = {};
+        result.cancelled = false;
+    }
+
+    // Create parser and parse from stream
+    PDFParser parser;
+    PDFHummus::EStatusCode status = parser.StartPDFParsing(stream);
+
+    if (status != PDFHummus::eSuccess) {
+        throw std::runtime_error("Failed to parse PDF from stream");
+    }
+
+    // Check for cancellation after parsing
+    if (cancelFlag && cancelFlag->load()) {
+        return {0, "", "", "", "", "", "", "", "", false, {}, true};
+    }
+
+    ReadDocumentMetadata(parser, result);
     return result;
 }
 
@@ -141,9 +145,11 @@ MetadataExtractionResult MetadataExtractionBaseWorker::ExtractMetadataCore(
 // ============================================================================
 
 MetadataExtractionBaseWorker::MetadataExtractionBaseWorker(
-    Napi::Env env
-) : CancellableAsyncWorker<MetadataExtractionResult>(env) {
-    result_ = {0, "", "", "", "", "", "", "", "", false};
+    Napi::Env env,
+    const MetadataExtractionOptions& options
+) : CancellableAsyncWorker<MetadataExtractionResult>(env),
+    options_(options) {
+    result_ = {0, "", "", "", "", "", "", "", "", false, {}, false};
 }
 
 Napi::Object MetadataExtractionBaseWorker::ResultToNapiObject(
@@ -160,5 +166,21 @@ Napi::Object MetadataExtractionBaseWorker::ResultToNapiObject(
     SetMetadataField(napiResult, "producer", result.producer, env);
     SetMetadataField(napiResult, "creationDate", result.creationDate, env);
     SetMetadataField(napiResult, "modificationDate", result.modificationDate, env);
+
+    if (result.hasPageLabels) {
+        Napi::Array ranges = Napi::Array::New(env, result.pageLabelRanges.size());
+        for (size_t i = 0; i < result.pageLabelRanges.size(); ++i) {
+            const PdfParser::PageLabelRange& range = result.pageLabelRanges[i];
+            Napi::Object napiRange = Napi::Object::New(env);
+            napiRange.Set("startPage", Napi::Number::New(env, range.pageIndex + 1));
+            SetMetadataField(napiRange, "style", range.style, env);
+            napiRange.Set("prefix", Napi::String::New(env, range.prefix));
+            napiRange.Set("firstNumber", Napi::Number::New(env, range.firstNumber));
+            ranges.Set(static_cast<uint32_t>(i), napiRange);
+        }
+        napiResult.Set("pageLabelRanges", ranges);
+    } else {
+        napiResult.Set("pageLabelRanges", env.Null());
+    }
     return napiResult;
 }
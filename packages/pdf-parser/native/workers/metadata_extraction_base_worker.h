@@ -10,7 +10,16 @@
 
 #include "cancellable_async_worker.h"
 #include "IByteReaderWithPosition.h"
+#include "../page_labels.h"
 #include <string>
+#include <vector>
+
+/**
+ * Options for metadata extraction operations
+ */
+struct MetadataExtractionOptions {
+    bool lazyXref = false;          // Read objects on demand from a classic xref table instead of loading it
+};
 
 /**
  * Result structure for metadata extraction operations
@@ -25,6 +34,8 @@ struct MetadataExtractionResult {
     std::string producer;
     std::string creationDate;
     std::string modificationDate;
+    bool hasPageLabels;
+    std::vector<PdfParser::PageLabelRange> pageLabelRanges;
     bool cancelled;
 };
 
@@ -34,22 +45,31 @@ struct MetadataExtractionResult {
  */
 class MetadataExtractionBaseWorker : public CancellableAsyncWorker<MetadataExtractionResult> {
 public:
-    MetadataExtractionBaseWorker(Napi::Env env);
+    MetadataExtractionBaseWorker(Napi::Env env, const MetadataExtractionOptions& options);
 
 protected:
     /**
      * Core metadata extraction logic (shared by file and buffer operations)
      *
+     * With options.lazyXref, documents with a classic xref table are read
+     * through LazyXrefReader: only the trailer, Info, the page tree root and
+     * the page labels tree. Anything it declines or fails on is parsed again
+     * with PDFParser.
+     *
      * @param stream Byte stream to read PDF from
+     * @param options Metadata extraction options
      * @param cancelFlag Optional atomic flag for cancellation
      * @return Metadata extraction result
      */
     static MetadataExtractionResult ExtractMetadataCore(
         IByteReaderWithPosition* stream,
+        const MetadataExtractionOptions& options,
         std::atomic<bool>* cancelFlag = nullptr
     );
 
     Napi::Object ResultToNapiObject(Napi::Env env, const MetadataExtractionResult& result) override;
+
+    MetadataExtractionOptions options_;
 };
 
 #endif // METADATA_EXTRACTION_BASE_WORKER_H
@@ -10,8 +10,9 @@
 MetadataExtractionFromBufferWorker::MetadataExtractionFromBufferWorker(
     Napi::Env env,
     const uint8_t* data,
-    size_t size
-) : MetadataExtractionBaseWorker(env),
+    size_t size,
+    const MetadataExtractionOptions& options
+) : MetadataExtractionBaseWorker(env, options),
     bufferData_(new uint8_t[size]),
     bufferSize_(size) {
     // Copy buffer data for use in worker thread
@@ -30,7 +31,7 @@ void MetadataExtractionFromBufferWorker::Execute() {
         BufferByteReader bufferReader(bufferData_.get(), bufferSize_);
 
         // Delegate to core function
-        result_ = MetadataExtractionBaseWorker::ExtractMetadataCore(&bufferReader, &cancelled_);
+        result_ = MetadataExtractionBaseWorker::ExtractMetadataCore(&bufferReader, options_, &cancelled_);
 
         if (result_.cancelled) {
             SetError("Operation cancelled");
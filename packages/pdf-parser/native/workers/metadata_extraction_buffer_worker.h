@@ -18,7 +18,8 @@ public:
     MetadataExtractionFromBufferWorker(
         Napi::Env env,
         const uint8_t* data,
-        size_t size
+        size_t size,
+        const MetadataExtractionOptions& options
     );
 
 protected:
@@ -8,8 +8,9 @@
 
 MetadataExtractionWorker::MetadataExtractionWorker(
     Napi::Env env,
-    const std::string& filePath
-) : MetadataExtractionBaseWorker(env),
+    const std::string& filePath,
+    const MetadataExtractionOptions& options
+) : MetadataExtractionBaseWorker(env, options),
     filePath_(filePath) {
 }
 
@@ -32,7 +33,7 @@ void MetadataExtractionWorker::Execute() {
 
         // Get the file stream and delegate to core function
         IByteReaderWithPosition* stream = pdfFile.GetInputStream();
-        result_ = MetadataExtractionBaseWorker::ExtractMetadataCore(stream, &cancelled_);
+        result_ = MetadataExtractionBaseWorker::ExtractMetadataCore(stream, options_, &cancelled_);
 
         if (result_.cancelled) {
             SetError("Operation cancelled");
@@ -14,7 +14,11 @@
  */
 class MetadataExtractionWorker : public MetadataExtractionBaseWorker {
 public:
-    MetadataExtractionWorker(Napi::Env env, const std::string& filePath);
+    MetadataExtractionWorker(
+        Napi::Env env,
+        const std::string& filePath,
+        const MetadataExtractionOptions& options
+    );
 
 protected:
     void Execute() override;
@@ -0,0 +1,31 @@
+/**
+ * MinHash Worker Implementation
+ */
+
+#include "minhash_worker.h"
+#include "../minhash.h"
+#include <utility>
+
+MinHashWorker::MinHashWorker(Napi::Env env, std::string text, int permutations)
+    : CancellableAsyncWorker<std::vector<uint32_t>>(env),
+      text_(std::move(text)),
+      permutations_(permutations) {}
+
+void MinHashWorker::Execute() {
+    if (cancelled_.load()) {
+        SetError("Operation cancelled");
+        return;
+    }
+
+    result_ = PdfParser::ComputeMinHash(text_, permutations_);
+}
+
+Napi::Object MinHashWorker::ResultToNapiObject(Napi::Env env, const std::vector<uint32_t>& result) {
+    Napi::Object napiResult = Napi::Object::New(env);
+    Napi::Array minhash = Napi::Array::New(env, result.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        minhash.Set(static_cast<uint32_t>(i), Napi::Number::New(env, result[i]));
+    }
+    napiResult.Set("minhash", minhash);
+    return napiResult;
+}
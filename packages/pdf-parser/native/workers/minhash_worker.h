@@ -0,0 +1,33 @@
+/**
+ * MinHash Worker
+ *
+ * Async worker signing text composed outside the extraction workers (pages
+ * assembled from the revision cache), so hashing a whole document's shingles
+ * does not block the JS thread.
+ */
+
+#ifndef MINHASH_WORKER_H
+#define MINHASH_WORKER_H
+
+#include "cancellable_async_worker.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * AsyncWorker computing a MinHash signature of a text
+ */
+class MinHashWorker : public CancellableAsyncWorker<std::vector<uint32_t>> {
+public:
+    MinHashWorker(Napi::Env env, std::string text, int permutations);
+
+protected:
+    void Execute() override;
+    Napi::Object ResultToNapiObject(Napi::Env env, const std::vector<uint32_t>& result) override;
+
+private:
+    std::string text_;
+    int permutations_;
+};
+
+#endif // MINHASH_WORKER_H
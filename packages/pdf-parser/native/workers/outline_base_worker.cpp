@@ -0,0 +1,320 @@
+/**
+ * Outline Extraction Base Worker Implementation
+ */
+
+#include "outline_base_worker.h"
+#include "../pdf_text_string.h"
+#include "PDFParser.h"
+#include "PDFArray.h"
+#include "PDFDictionary.h"
+#include "PDFHexString.h"
+#include "PDFIndirectObjectReference.h"
+#include "PDFInteger.h"
+#include "PDFLiteralString.h"
+#include "PDFName.h"
+#include "PDFObjectCast.h"
+#include "RefCountPtr.h"
+#include "EStatusCode.h"
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+// Guards against malformed (cyclic or absurdly large) outline and name trees
+static const size_t MAX_OUTLINE_ENTRIES = 100000;
+static const int MAX_NAME_TREE_DEPTH = 32;
+static const int MAX_DESTINATION_DEPTH = 4;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Raw bytes of a name or string object (the key form used by named destinations)
+ */
+static bool GetDestinationName(PDFObject* obj, std::string& outName) {
+    switch (obj->GetType()) {
+        case PDFObject::ePDFObjectName:
+            outName = static_cast<PDFName*>(obj)->GetValue();
+            return true;
+        case PDFObject::ePDFObjectLiteralString:
+            outName = static_cast<PDFLiteralString*>(obj)->GetValue();
+            return true;
+        case PDFObject::ePDFObjectHexString:
+            outName = static_cast<PDFHexString*>(obj)->GetValue();
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Resolves outline destinations to 0-based page indexes
+ */
+class DestinationResolver {
+public:
+    explicit DestinationResolver(PDFParser& parser) : parser_(parser), namedLoaded_(false) {
+        for (unsigned long i = 0; i < parser_.GetPagesCount(); ++i) {
+            pageIndexes_[parser_.GetPageObjectID(i)] = static_cast<long>(i);
+        }
+    }
+
+    /**
+     * Resolve an outline item's /Dest, or its /A GoTo action's /D
+     */
+    long ResolveItem(PDFDictionary* item) {
+        RefCountPtr<PDFObject> dest(parser_.QueryDictionaryObject(item, "Dest"));
+        if (dest.GetPtr()) {
+            return Resolve(dest.GetPtr(), 0);
+        }
+
+        PDFObjectCastPtr<PDFDictionary> action(parser_.QueryDictionaryObject(item, "A"));
+        if (!action.GetPtr()) {
+            return -1;
+        }
+        PDFObjectCastPtr<PDFName> actionType(parser_.QueryDictionaryObject(action.GetPtr(), "S"));
+        if (!actionType.GetPtr() || actionType->GetValue() != "GoTo") {
+            return -1;
+        }
+        RefCountPtr<PDFObject> actionDest(parser_.QueryDictionaryObject(action.GetPtr(), "D"));
+        return Resolve(actionDest.GetPtr(), 0);
+    }
+
+private:
+    long Resolve(PDFObject* dest, int depth) {
+        if (!dest || depth > MAX_DESTINATION_DEPTH) {
+            return -1;
+        }
+
+        // Explicit destination: [page /XYZ left top zoom] etc.
+        if (dest->GetType() == PDFObject::ePDFObjectArray) {
+            PDFArray* destArray = static_cast<PDFArray*>(dest);
+            if (destArray->GetLength() == 0) {
+                return -1;
+            }
+            RefCountPtr<PDFObject> target(destArray->QueryObject(0));
+            if (!target.GetPtr()) {
+                return -1;
+            }
+            if (target->GetType() == PDFObject::ePDFObjectIndirectObjectReference) {
+                auto it = pageIndexes_.find(static_cast<PDFIndirectObjectReference*>(target.GetPtr())->mObjectID);
+                return it == pageIndexes_.end() ? -1 : it->second;
+            }
+            // Some producers write a page number where a page reference belongs
+            if (target->GetType() == PDFObject::ePDFObjectInteger) {
+                long long pageIndex = static_cast<PDFInteger*>(target.GetPtr())->GetValue();
+                return pageIndex >= 0 && pageIndex < static_cast<long long>(pageIndexes_.size())
+                    ? static_cast<long>(pageIndex) : -1;
+            }
+            return -1;
+        }
+
+        // Destination dictionary (from /Dests or the name tree): << /D [...] >>
+        if (dest->GetType() == PDFObject::ePDFObjectDictionary) {
+            RefCountPtr<PDFObject> inner(parser_.QueryDictionaryObject(static_cast<PDFDictionary*>(dest), "D"));
+            return Resolve(inner.GetPtr(), depth + 1);
+        }
+
+        // Named destination
+        std::string name;
+        if (depth == 0 && GetDestinationName(dest, name)) {
+            LoadNamedDestinations();
+            auto it = namedPages_.find(name);
+            return it == namedPages_.end() ? -1 : it->second;
+        }
+
+        return -1;
+    }
+
+    /**
+     * Resolve every named destination once, on first use
+     */
+    void LoadNamedDestinations() {
+        if (namedLoaded_) {
+            return;
+        }
+        namedLoaded_ = true;
+
+        PDFObjectCastPtr<PDFDictionary> catalog(parser_.QueryDictionaryObject(parser_.GetTrailer(), "Root"));
+        if (!catalog.GetPtr()) {
+            return;
+        }
+
+        // PDF 1.1: /Dests dictionary keyed by name
+        PDFObjectCastPtr<PDFDictionary> dests(parser_.QueryDictionaryObject(catalog.GetPtr(), "Dests"));
+        if (dests.GetPtr()) {
+            MapIterator<PDFNameToPDFObjectMap> it = dests->GetIterator();
+            while (it.MoveNext()) {
+                RefCountPtr<PDFObject> value(parser_.QueryDictionaryObject(dests.GetPtr(), it.GetKey()->GetValue()));
+                namedPages_[it.GetKey()->GetValue()] = Resolve(value.GetPtr(), 1);
+            }
+        }
+
+        // PDF 1.2+: /Names /Dests name tree keyed by string
+        PDFObjectCastPtr<PDFDictionary> names(parser_.QueryDictionaryObject(catalog.GetPtr(), "Names"));
+        if (names.GetPtr()) {
+            PDFObjectCastPtr<PDFDictionary> destsTree(parser_.QueryDictionaryObject(names.GetPtr(), "Dests"));
+            if (destsTree.GetPtr()) {
+                WalkNameTree(destsTree.GetPtr(), 0);
+            }
+        }
+    }
+
+    void WalkNameTree(PDFDictionary* node, int depth) {
+        if (depth > MAX_NAME_TREE_DEPTH) {
+            return;
+        }
+
+        PDFObjectCastPtr<PDFArray> namesArray(parser_.QueryDictionaryObject(node, "Names"));
+        if (namesArray.GetPtr()) {
+            for (unsigned long i = 0; i + 1 < namesArray->GetLength(); i += 2) {
+                RefCountPtr<PDFObject> key(parser_.QueryArrayObject(namesArray.GetPtr(), i));
+                std::string name;
+                if (key.GetPtr() && GetDestinationName(key.GetPtr(), name)) {
+                    RefCountPtr<PDFObject> value(parser_.QueryArrayObject(namesArray.GetPtr(), i + 1));
+                    namedPages_[name] = Resolve(value.GetPtr(), 1);
+                }
+            }
+        }
+
+        PDFObjectCastPtr<PDFArray> kids(parser_.QueryDictionaryObject(node, "Kids"));
+        if (kids.GetPtr()) {
+            for (unsigned long i = 0; i < kids->GetLength(); ++i) {
+                PDFObjectCastPtr<PDFDictionary> kid(parser_.QueryArrayObject(kids.GetPtr(), i));
+                if (kid.GetPtr()) {
+                    WalkNameTree(kid.GetPtr(), depth + 1);
+                }
+            }
+        }
+    }
+
+    PDFParser& parser_;
+    std::unordered_map<ObjectIDType, long> pageIndexes_;
+    std::unordered_map<std::string, long> namedPages_;
+    bool namedLoaded_;
+};
+
+/**
+ * Object id of an outline link (/First, /Next), or 0 if absent or direct
+ */
+static ObjectIDType GetOutlineLink(PDFDictionary* item, const std::string& key) {
+    PDFObjectCastPtr<PDFIndirectObjectReference> ref(item->QueryDirectObject(key));
+    return ref.GetPtr() ? ref->mObjectID : 0;
+}
+
+// ============================================================================
+// CORE OUTLINE EXTRACTION LOGIC
+// ============================================================================
+
+OutlineExtractionResult OutlineBaseWorker::ExtractOutlineCore(
+    IByteReaderWithPosition* stream,
+    std::atomic<bool>* cancelFlag
+) {
+    // Check for cancellation before starting
+    if (cancelFlag && cancelFlag->load()) {
+        return {0, {}, true};
+    }
+
+    PDFParser parser;
+    PDFHummus::EStatusCode status = parser.StartPDFParsing(stream);
+
+    if (status != PDFHummus::eSuccess) {
+        throw std::runtime_error("Failed to parse PDF from stream");
+    }
+
+    OutlineExtractionResult result = {parser.GetPagesCount(), {}, false};
+
+    PDFObjectCastPtr<PDFDictionary> catalog(parser.QueryDictionaryObject(parser.GetTrailer(), "Root"));
+    if (!catalog.GetPtr()) {
+        return result;
+    }
+    PDFObjectCastPtr<PDFDictionary> outlines(parser.QueryDictionaryObject(catalog.GetPtr(), "Outlines"));
+    if (!outlines.GetPtr()) {
+        return result;
+    }
+
+    DestinationResolver resolver(parser);
+
+    // Depth-first walk in document order: an item, its children (/First),
+    // then its following siblings (/Next)
+    struct PendingItem {
+        ObjectIDType objectId;
+        int level;
+    };
+    std::vector<PendingItem> pending;
+    std::unordered_set<ObjectIDType> visited;
+
+    ObjectIDType firstId = GetOutlineLink(outlines.GetPtr(), "First");
+    if (firstId != 0) {
+        pending.push_back({firstId, 0});
+    }
+
+    while (!pending.empty() && result.entries.size() < MAX_OUTLINE_ENTRIES) {
+        if (cancelFlag && cancelFlag->load()) {
+            return {0, {}, true};
+        }
+
+        PendingItem current = pending.back();
+        pending.pop_back();
+        if (!visited.insert(current.objectId).second) {
+            continue;   // Cycle in a malformed outline
+        }
+
+        PDFObjectCastPtr<PDFDictionary> item(parser.ParseNewObject(current.objectId));
+        if (!item.GetPtr()) {
+            continue;
+        }
+
+        RefCountPtr<PDFObject> title(parser.QueryDictionaryObject(item.GetPtr(), "Title"));
+        result.entries.push_back({
+            PdfParser::GetTextString(title.GetPtr()),
+            current.level,
+            resolver.ResolveItem(item.GetPtr())
+        });
+
+        ObjectIDType nextId = GetOutlineLink(item.GetPtr(), "Next");
+        if (nextId != 0) {
+            pending.push_back({nextId, current.level});
+        }
+        ObjectIDType childId = GetOutlineLink(item.GetPtr(), "First");
+        if (childId != 0) {
+            pending.push_back({childId, current.level + 1});
+        }
+    }
+
+    return result;
+}
+
+// ============================================================================
+// OUTLINE BASE WORKER
+// ============================================================================
+
+OutlineBaseWorker::OutlineBaseWorker(
+    Napi::Env env
+) : CancellableAsyncWorker<OutlineExtractionResult>(env) {
+    result_ = {0, {}, false};
+}
+
+Napi::Object OutlineBaseWorker::ResultToNapiObject(
+    Napi::Env env,
+    const OutlineExtractionResult& result
+) {
+    Napi::Array entries = Napi::Array::New(env, result.entries.size());
+    for (size_t i = 0; i < result.entries.size(); ++i) {
+        const OutlineEntry& entry = result.entries[i];
+        Napi::Object napiEntry = Napi::Object::New(env);
+        napiEntry.Set("title", Napi::String::New(env, entry.title));
+        napiEntry.Set("level", Napi::Number::New(env, entry.level));
+        if (entry.pageIndex >= 0) {
+            napiEntry.Set("pageNumber", Napi::Number::New(env, entry.pageIndex + 1));
+        } else {
+            napiEntry.Set("pageNumber", env.Null());
+        }
+        entries.Set(static_cast<uint32_t>(i), napiEntry);
+    }
+
+    Napi::Object napiResult = Napi::Object::New(env);
+    napiResult.Set("pageCount", Napi::Number::New(env, result.pageCount));
+    napiResult.Set("entries", entries);
+    return napiResult;
+}
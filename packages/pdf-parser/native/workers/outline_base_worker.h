@@ -0,0 +1,59 @@
+/**
+ * Outline Extraction Base Worker
+ *
+ * Base class for outline (bookmark) workers (file and buffer).
+ * Reads the document outline with PDFParser only and resolves each entry's
+ * destination to a page, without interpreting any page content.
+ */
+
+#ifndef OUTLINE_BASE_WORKER_H
+#define OUTLINE_BASE_WORKER_H
+
+#include "cancellable_async_worker.h"
+#include "IByteReaderWithPosition.h"
+#include <string>
+#include <vector>
+
+/**
+ * One outline entry, flattened in document order
+ */
+struct OutlineEntry {
+    std::string title;      // UTF-8 title
+    int level;              // Nesting depth (0 = top level)
+    long pageIndex;         // 0-based target page (-1 if it could not be resolved)
+};
+
+/**
+ * Result structure for outline extraction operations
+ */
+struct OutlineExtractionResult {
+    unsigned long pageCount;
+    std::vector<OutlineEntry> entries;
+    bool cancelled;
+};
+
+/**
+ * Base class for outline extraction workers
+ * Provides shared outline logic and result conversion
+ */
+class OutlineBaseWorker : public CancellableAsyncWorker<OutlineExtractionResult> {
+public:
+    OutlineBaseWorker(Napi::Env env);
+
+protected:
+    /**
+     * Core outline extraction logic (shared by file and buffer operations)
+     *
+     * @param stream Byte stream to read PDF from
+     * @param cancelFlag Optional atomic flag for cancellation
+     * @return Outline extraction result
+     */
+    static OutlineExtractionResult ExtractOutlineCore(
+        IByteReaderWithPosition* stream,
+        std::atomic<bool>* cancelFlag = nullptr
+    );
+
+    Napi::Object ResultToNapiObject(Napi::Env env, const OutlineExtractionResult& result) override;
+};
+
+#endif // OUTLINE_BASE_WORKER_H
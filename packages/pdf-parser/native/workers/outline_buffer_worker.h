@@ -0,0 +1,32 @@
+/**
+ * Outline Worker - Buffer-based
+ *
+ * Async worker for reading the outline of PDF buffers.
+ */
+
+#ifndef OUTLINE_BUFFER_WORKER_H
+#define OUTLINE_BUFFER_WORKER_H
+
+#include "outline_base_worker.h"
+#include <memory>
+
+/**
+ * AsyncWorker for outline extraction from buffer
+ */
+class OutlineFromBufferWorker : public OutlineBaseWorker {
+public:
+    OutlineFromBufferWorker(
+        Napi::Env env,
+        const uint8_t* data,
+        size_t size
+    );
+
+protected:
+    void Execute() override;
+
+private:
+    std::unique_ptr<uint8_t[]> bufferData_;
+    size_t bufferSize_;
+};
+
+#endif // OUTLINE_BUFFER_WORKER_H
@@ -0,0 +1,44 @@
+/**
+ * Outline Worker Implementation
+ */
+
+#include "outline_worker.h"
+#include "InputFile.h"
+#include <stdexcept>
+
+OutlineWorker::OutlineWorker(
+    Napi::Env env,
+    const std::string& filePath
+) : OutlineBaseWorker(env),
+    filePath_(filePath) {
+}
+
+void OutlineWorker::Execute() {
+    try {
+        // Open PDF file
+        InputFile pdfFile;
+        PDFHummus::EStatusCode status = pdfFile.OpenFile(filePath_);
+
+        if (status != PDFHummus::eSuccess) {
+            SetError("Failed to open PDF file");
+            return;
+        }
+
+        // Check cancellation
+        if (cancelled_.load()) {
+            SetError("Operation cancelled");
+            return;
+        }
+
+        // Get the file stream and delegate to core function
+        IByteReaderWithPosition* stream = pdfFile.GetInputStream();
+        result_ = OutlineBaseWorker::ExtractOutlineCore(stream, &cancelled_);
+
+        if (result_.cancelled) {
+            SetError("Operation cancelled");
+        }
+
+    } catch (const std::exception& e) {
+        SetError(std::string("Outline extraction failed: ") + e.what());
+    }
+}
@@ -0,0 +1,26 @@
+/**
+ * Outline Worker - File-based
+ *
+ * Async worker for reading the outline of PDF files.
+ */
+
+#ifndef OUTLINE_WORKER_H
+#define OUTLINE_WORKER_H
+
+#include "outline_base_worker.h"
+
+/**
+ * AsyncWorker for outline extraction from file
+ */
+class OutlineWorker : public OutlineBaseWorker {
+public:
+    OutlineWorker(Napi::Env env, const std::string& filePath);
+
+protected:
+    void Execute() override;
+
+private:
+    std::string filePath_;
+};
+
+#endif // OUTLINE_WORKER_H
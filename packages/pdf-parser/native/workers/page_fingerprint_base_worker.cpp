@@ -0,0 +1,137 @@
+/**
+ * Page Fingerprint Base Worker Implementation
+ */
+
+#include "page_fingerprint_base_worker.h"
+#include "../hash_utils.h"
+#include "../pdf_object_hasher.h"
+#include "PDFParser.h"
+#include "PDFArray.h"
+#include "PDFDictionary.h"
+#include "PDFStreamInput.h"
+#include "PDFObjectCast.h"
+#include "RefCountPtr.h"
+#include "EStatusCode.h"
+#include <stdexcept>
+
+using namespace PdfParser;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Hash a page's decoded content stream(s). /Contents may be a single
+ * stream or an array of streams that are concatenated in order.
+ */
+static void HashPageContents(
+    PDFParser& parser,
+    PdfObjectHasher& objectHasher,
+    PDFDictionary* page,
+    Fnv1a64& hasher
+) {
+    RefCountPtr<PDFObject> contents(parser.QueryDictionaryObject(page, "Contents"));
+    if (!contents.GetPtr()) {
+        hasher.UpdateUInt64(0);
+        return;
+    }
+
+    if (contents->GetType() == PDFObject::ePDFObjectStream) {
+        objectHasher.HashDecodedStream(static_cast<PDFStreamInput*>(contents.GetPtr()), hasher);
+        return;
+    }
+
+    if (contents->GetType() == PDFObject::ePDFObjectArray) {
+        PDFArray* contentsArray = static_cast<PDFArray*>(contents.GetPtr());
+        for (unsigned long i = 0; i < contentsArray->GetLength(); ++i) {
+            PDFObjectCastPtr<PDFStreamInput> stream(parser.QueryArrayObject(contentsArray, i));
+            if (stream.GetPtr()) {
+                objectHasher.HashDecodedStream(stream.GetPtr(), hasher);
+            }
+        }
+    }
+}
+
+/**
+ * Fingerprint one page: boxes and rotation (inherited), resources, contents
+ */
+static std::string FingerprintPage(PDFParser& parser, PdfObjectHasher& objectHasher, unsigned long pageIndex) {
+    PDFObjectCastPtr<PDFDictionary> page(parser.ParsePage(pageIndex));
+    if (!page.GetPtr()) {
+        throw std::runtime_error("Failed to parse page " + std::to_string(pageIndex + 1));
+    }
+
+    Fnv1a64 hasher;
+
+    static const char* const PAGE_KEYS[] = {"MediaBox", "CropBox", "Rotate", "Resources"};
+    for (const char* key : PAGE_KEYS) {
+        RefCountPtr<PDFObject> value(objectHasher.QueryInheritedPageValue(page.GetPtr(), key));
+        hasher.Update(std::string(key));
+        hasher.UpdateUInt64(objectHasher.HashObject(value.GetPtr()));
+    }
+
+    HashPageContents(parser, objectHasher, page.GetPtr(), hasher);
+
+    return ToHex(hasher.Digest());
+}
+
+// ============================================================================
+// CORE PAGE FINGERPRINT LOGIC
+// ============================================================================
+
+PageFingerprintResult PageFingerprintBaseWorker::ComputeFingerprintsCore(
+    IByteReaderWithPosition* stream,
+    std::atomic<bool>* cancelFlag
+) {
+    // Check for cancellation before starting
+    if (cancelFlag && cancelFlag->load()) {
+        return {{}, true};
+    }
+
+    PDFParser parser;
+    PDFHummus::EStatusCode status = parser.StartPDFParsing(stream);
+
+    if (status != PDFHummus::eSuccess) {
+        throw std::runtime_error("Failed to parse PDF from stream");
+    }
+
+    // One hasher for the whole document so shared resources are hashed once
+    PdfObjectHasher objectHasher(parser);
+    PageFingerprintResult result = {{}, false};
+    unsigned long pageCount = parser.GetPagesCount();
+    result.fingerprints.reserve(pageCount);
+
+    for (unsigned long i = 0; i < pageCount; ++i) {
+        if (cancelFlag && cancelFlag->load()) {
+            return {{}, true};
+        }
+        result.fingerprints.push_back(FingerprintPage(parser, objectHasher, i));
+    }
+
+    return result;
+}
+
+// ============================================================================
+// PAGE FINGERPRINT BASE WORKER
+// ============================================================================
+
+PageFingerprintBaseWorker::PageFingerprintBaseWorker(
+    Napi::Env env
+) : CancellableAsyncWorker<PageFingerprintResult>(env) {
+    result_ = {{}, false};
+}
+
+Napi::Object PageFingerprintBaseWorker::ResultToNapiObject(
+    Napi::Env env,
+    const PageFingerprintResult& result
+) {
+    Napi::Array fingerprints = Napi::Array::New(env, result.fingerprints.size());
+    for (size_t i = 0; i < result.fingerprints.size(); ++i) {
+        fingerprints.Set(static_cast<uint32_t>(i), Napi::String::New(env, result.fingerprints[i]));
+    }
+
+    Napi::Object napiResult = Napi::Object::New(env);
+    napiResult.Set("pageCount", Napi::Number::New(env, result.fingerprints.size()));
+    napiResult.Set("fingerprints", fingerprints);
+    return napiResult;
+}
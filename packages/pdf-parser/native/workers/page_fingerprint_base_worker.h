@@ -0,0 +1,50 @@
+/**
+ * Page Fingerprint Base Worker
+ *
+ * Base class for page fingerprint workers (file and buffer).
+ * Fingerprints identify a page's rendered inputs (content streams,
+ * resources, page boxes) without interpreting text, so callers can tell
+ * which pages changed between two revisions of a document cheaply.
+ */
+
+#ifndef PAGE_FINGERPRINT_BASE_WORKER_H
+#define PAGE_FINGERPRINT_BASE_WORKER_H
+
+#include "cancellable_async_worker.h"
+#include "IByteReaderWithPosition.h"
+#include <string>
+#include <vector>
+
+/**
+ * Result structure for page fingerprint operations
+ */
+struct PageFingerprintResult {
+    std::vector<std::string> fingerprints;   // One hex digest per page, in page order
+    bool cancelled;
+};
+
+/**
+ * Base class for page fingerprint workers
+ * Provides shared fingerprint logic and result conversion
+ */
+class PageFingerprintBaseWorker : public CancellableAsyncWorker<PageFingerprintResult> {
+public:
+    PageFingerprintBaseWorker(Napi::Env env);
+
+protected:
+    /**
+     * Core page fingerprint logic (shared by file and buffer operations)
+     *
+     * @param stream Byte stream to read PDF from
+     * @param cancelFlag Optional atomic flag for cancellation (checked per page)
+     * @return Page fingerprint result
+     */
+    static PageFingerprintResult ComputeFingerprintsCore(
+        IByteReaderWithPosition* stream,
+        std::atomic<bool>* cancelFlag = nullptr
+    );
+
+    Napi::Object ResultToNapiObject(Napi::Env env, const PageFingerprintResult& result) override;
+};
+
+#endif // PAGE_FINGERPRINT_BASE_WORKER_H
@@ -0,0 +1,42 @@
+/**
+ * Page Fingerprint Buffer Worker Implementation
+ */
+
+#include "page_fingerprint_buffer_worker.h"
+#include "../buffer_byte_reader.h"
+#include <cstring>
+#include <stdexcept>
+
+PageFingerprintFromBufferWorker::PageFingerprintFromBufferWorker(
+    Napi::Env env,
+    const uint8_t* data,
+    size_t size
+) : PageFingerprintBaseWorker(env),
+    bufferData_(new uint8_t[size]),
+    bufferSize_(size) {
+    // Copy buffer data for use in worker thread
+    std::memcpy(bufferData_.get(), data, size);
+}
+
+void PageFingerprintFromBufferWorker::Execute() {
+    try {
+        // Check cancellation
+        if (cancelled_.load()) {
+            SetError("Operation cancelled");
+            return;
+        }
+
+        // Create a buffer reader for direct stream access
+        BufferByteReader bufferReader(bufferData_.get(), bufferSize_);
+
+        // Delegate to core function
+        result_ = PageFingerprintBaseWorker::ComputeFingerprintsCore(&bufferReader, &cancelled_);
+
+        if (result_.cancelled) {
+            SetError("Operation cancelled");
+        }
+
+    } catch (const std::exception& e) {
+        SetError(std::string("Page fingerprinting failed: ") + e.what());
+    }
+}
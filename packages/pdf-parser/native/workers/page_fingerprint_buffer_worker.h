@@ -0,0 +1,32 @@
+/**
+ * Page Fingerprint Worker - Buffer-based
+ *
+ * Async worker for computing page fingerprints of PDF buffers.
+ */
+
+#ifndef PAGE_FINGERPRINT_BUFFER_WORKER_H
+#define PAGE_FINGERPRINT_BUFFER_WORKER_H
+
+#include "page_fingerprint_base_worker.h"
+#include <memory>
+
+/**
+ * AsyncWorker for page fingerprints from buffer
+ */
+class PageFingerprintFromBufferWorker : public PageFingerprintBaseWorker {
+public:
+    PageFingerprintFromBufferWorker(
+        Napi::Env env,
+        const uint8_t* data,
+        size_t size
+    );
+
+protected:
+    void Execute() override;
+
+private:
+    std::unique_ptr<uint8_t[]> bufferData_;
+    size_t bufferSize_;
+};
+
+#endif // PAGE_FINGERPRINT_BUFFER_WORKER_H
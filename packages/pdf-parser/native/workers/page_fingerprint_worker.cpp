@@ -0,0 +1,44 @@
+/**
+ * Page Fingerprint Worker Implementation
+ */
+
+#include "page_fingerprint_worker.h"
+#include "InputFile.h"
+#include <stdexcept>
+
+PageFingerprintWorker::PageFingerprintWorker(
+    Napi::Env env,
+    const std::string& filePath
+) : PageFingerprintBaseWorker(env),
+    filePath_(filePath) {
+}
+
+void PageFingerprintWorker::Execute() {
+    try {
+        // Open PDF file
+        InputFile pdfFile;
+        PDFHummus::EStatusCode status = pdfFile.OpenFile(filePath_);
+
+        if (status != PDFHummus::eSuccess) {
+            SetError("Failed to open PDF file");
+            return;
+        }
+
+        // Check cancellation
+        if (cancelled_.load()) {
+            SetError("Operation cancelled");
+            return;
+        }
+
+        // Get the file stream and delegate to core function
+        IByteReaderWithPosition* stream = pdfFile.GetInputStream();
+        result_ = PageFingerprintBaseWorker::ComputeFingerprintsCore(stream, &cancelled_);
+
+        if (result_.cancelled) {
+            SetError("Operation cancelled");
+        }
+
+    } catch (const std::exception& e) {
+        SetError(std::string("Page fingerprinting failed: ") + e.what());
+    }
+}
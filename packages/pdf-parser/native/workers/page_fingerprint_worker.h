@@ -0,0 +1,26 @@
+/**
+ * Page Fingerprint Worker - File-based
+ *
+ * Async worker for computing page fingerprints of PDF files.
+ */
+
+#ifndef PAGE_FINGERPRINT_WORKER_H
+#define PAGE_FINGERPRINT_WORKER_H
+
+#include "page_fingerprint_base_worker.h"
+
+/**
+ * AsyncWorker for page fingerprints from file
+ */
+class PageFingerprintWorker : public PageFingerprintBaseWorker {
+public:
+    PageFingerprintWorker(Napi::Env env, const std::string& filePath);
+
+protected:
+    void Execute() override;
+
+private:
+    std::string filePath_;
+};
+
+#endif // PAGE_FINGERPRINT_WORKER_H
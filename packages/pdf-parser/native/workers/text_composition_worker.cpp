@@ -0,0 +1,50 @@
+/**
+ * Text Composition Worker Implementation
+ */
+
+#include "text_composition_worker.h"
+#include "../placement_ir.h"
+#include <cstring>
+#include <stdexcept>
+
+TextCompositionWorker::TextCompositionWorker(
+    Napi::Env env,
+    const uint8_t* data,
+    size_t size,
+    int bidiDirection,
+    const TextExtractionOptions& options
+) : TextExtractionBaseWorker(env, bidiDirection, options),
+    placementData_(new uint8_t[size]),
+    placementSize_(size) {
+    // Copy placement IR for use in worker thread
+    std::memcpy(placementData_.get(), data, size);
+
+    // The IR is the input here, not something to hand back
+    options_.keepPlacements = false;
+}
+
+void TextCompositionWorker::Execute() {
+    try {
+        // Check cancellation
+        if (cancelled_.load()) {
+            SetError("Operation cancelled");
+            return;
+        }
+
+        // Rebuild only the requested pages
+        TextExtraction textExtraction;
+        PdfParser::DeserializePlacements(
+            placementData_.get(), placementSize_, options_.startPage, options_.endPage,
+            textExtraction.textsForPages
+        );
+
+        result_ = TextExtractionBaseWorker::ComposeTextCore(textExtraction, bidiDirection_, options_);
+
+        if (cancelled_.load()) {
+            SetError("Operation cancelled");
+        }
+
+    } catch (const std::exception& e) {
+        SetError(std::string("Composition failed: ") + e.what());
+    }
+}
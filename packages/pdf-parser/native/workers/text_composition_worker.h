@@ -0,0 +1,35 @@
+/**
+ * Text Composition Worker - Placement IR-based
+ *
+ * Async worker composing text from placement IR kept by an earlier
+ * extraction, without parsing the PDF again.
+ */
+
+#ifndef TEXT_COMPOSITION_WORKER_H
+#define TEXT_COMPOSITION_WORKER_H
+
+#include "text_extraction_base_worker.h"
+#include <memory>
+
+/**
+ * AsyncWorker for text composition from placement IR
+ */
+class TextCompositionWorker : public TextExtractionBaseWorker {
+public:
+    TextCompositionWorker(
+        Napi::Env env,
+        const uint8_t* data,
+        size_t size,
+        int bidiDirection,
+        const TextExtractionOptions& options
+    );
+
+protected:
+    void Execute() override;
+
+private:
+    std::unique_ptr<uint8_t[]> placementData_;
+    size_t placementSize_;
+};
+
+#endif // TEXT_COMPOSITION_WORKER_H
@@ -4,13 +4,173 @@
 
 #include "text_extraction_base_worker.h"
 #include "../text_direction_detection.h"
+#include "../minhash.h"
+#include "../placement_ir.h"
 #include "TextExtraction.h"
 #include "ErrorsAndWarnings.h"
 #include "lib/text-composition/TextComposer.h"
+#include "PDFParser.h"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace PdfParser;
 
+// Smallest page span worth a helper thread. Each span re-reads the xref
+// table, so tiny spans cost more than they save.
+static const unsigned long MIN_PAGES_PER_SPAN = 4;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Result of extracting one contiguous page span
+ */
+struct PageSpanResult {
+    ParsedTextPlacementListList textsForPages;
+    std::string error;      // Empty on success
+};
+
+/**
+ * Extract placements for pages [startPage, endPage] (0-based, inclusive)
+ * A span that starts after cancellation is skipped.
+ */
+static void ExtractPageSpan(
+    IByteReaderWithPosition* stream,
+    long startPage,
+    long endPage,
+    std::atomic<bool>* cancelFlag,
+    PageSpanResult& outResult
+) {
+    if (cancelFlag && cancelFlag->load()) {
+        return;
+    }
+
+    TextExtraction spanExtraction;
+    PDFHummus::EStatusCode status = spanExtraction.ExtractText(stream, startPage, endPage);
+
+    if (status != PDFHummus::eSuccess) {
+        outResult.error = "Extraction failed";
+        if (!spanExtraction.LatestError.description.empty()) {
+            outResult.error += ": " + spanExtraction.LatestError.description;
+        }
+        return;
+    }
+    outResult.textsForPages.swap(spanExtraction.textsForPages);
+}
+
+/**
+ * Read the page count without interpreting any page content
+ */
+static unsigned long CountPages(IByteReaderWithPosition* stream) {
+    PDFParser parser;
+    if (parser.StartPDFParsing(stream) != PDFHummus::eSuccess) {
+        throw std::runtime_error("Failed to parse PDF from stream");
+    }
+    return parser.GetPagesCount();
+}
+
+/**
+ * Extract all pages by splitting them into spans run on helper threads.
+ * The calling thread extracts the first span with the primary stream.
+ * Spans are as even as possible: span i covers [i*P/S, (i+1)*P/S - 1].
+ */
+static void ExtractPagesInParallel(
+    IByteReaderWithPosition* stream,
+    unsigned long pageCount,
+    unsigned long spanCount,
+    const StreamFactory& openHelperStream,
+    std::atomic<bool>* cancelFlag,
+    ParsedTextPlacementListList& outTextsForPages
+) {
+    std::vector<PageSpanResult> spans(spanCount);
+    std::vector<std::thread> helpers;
+
+    auto spanStart = [pageCount, spanCount](unsigned long i) {
+        return static_cast<long>(i * pageCount / spanCount);
+    };
+
+    for (unsigned long i = 1; i < spanCount; ++i) {
+        long startPage = spanStart(i);
+        long endPage = spanStart(i + 1) - 1;
+        PageSpanResult& spanResult = spans[i];
+
+        helpers.emplace_back([&openHelperStream, startPage, endPage, cancelFlag, &spanResult]() {
+            try {
+                std::unique_ptr<IByteReaderWithPosition> helperStream = openHelperStream();
+                ExtractPageSpan(helperStream.get(), startPage, endPage, cancelFlag, spanResult);
+            } catch (const std::exception& e) {
+                spanResult.error = e.what();
+            }
+        });
+    }
+
+    // Helpers must always be joined, so keep exceptions out of this thread too
+    try {
+        stream->SetPosition(0);
+        ExtractPageSpan(stream, 0, spanStart(1) - 1, cancelFlag, spans[0]);
+    } catch (const std::exception& e) {
+        spans[0].error = e.what();
+    }
+
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+
+    // A cancelled extraction has missing spans; the caller reports it as cancelled
+    if (cancelFlag && cancelFlag->load()) {
+        return;
+    }
+
+    // Stitch spans back together in page order
+    for (auto& span : spans) {
+        if (!span.error.empty()) {
+            throw std::runtime_error(span.error);
+        }
+        outTextsForPages.splice(outTextsForPages.end(), span.textsForPages);
+    }
+}
+
+/**
+ * Compose each page on its own. Pages are moved through a scratch
+ * extraction one at a time (list splice, no copies) and moved back.
+ */
+static std::vector<std::string> ComposePageTexts(
+    ParsedTextPlacementListList& textsForPages,
+    int composerBidiFlag
+) {
+    std::vector<std::string> pageTexts;
+    pageTexts.reserve(textsForPages.size());
+
+    TextExtraction pageExtraction;
+    auto it = textsForPages.begin();
+    while (it != textsForPages.end()) {
+        auto next = std::next(it);
+        pageExtraction.textsForPages.splice(pageExtraction.textsForPages.end(), textsForPages, it);
+        pageTexts.push_back(pageExtraction.GetResultsAsText(composerBidiFlag, TextComposer::eSpacingBoth));
+        textsForPages.splice(next, pageExtraction.textsForPages);
+        it = next;
+    }
+    return pageTexts;
+}
+
+/**
+ * Throw when a page range reaches past the last page. The library stops at the
+ * last page, so fewer pages from the range's start than it spans means it did.
+ *
+ * @param pagesFromStart Pages the document has from options.startPage on
+ */
+static void CheckPageRangeInDocument(const TextExtractionOptions& options, long pagesFromStart) {
+    long requestedPages = options.endPage >= 0 ? options.endPage - options.startPage + 1 : 1;
+    if (pagesFromStart < requestedPages) {
+        throw std::runtime_error("Page range is past the last page");
+    }
+}
+
 // ============================================================================
 // CORE TEXT EXTRACTION LOGIC
 // ============================================================================
@@ -18,6 +178,8 @@ using namespace PdfParser;
 TextExtractionResult TextExtractionBaseWorker::ExtractTextCore(
     IByteReaderWithPosition* stream,
     int bidiDirection,
+    const TextExtractionOptions& options,
+    const StreamFactory& openHelperStream,
     std::atomic<bool>* cancelFlag
 ) {
     // Check for cancellation before starting
@@ -27,38 +189,131 @@ TextExtractionResult TextExtractionBaseWorker::ExtractTextCore(
 
     TextExtraction textExtraction;
 
-    // Extract text from all pages
-    PDFHummus::EStatusCode status = textExtraction.ExtractText(stream, 0, -1);
+    // Placements are kept for the whole document, so extract every page
+    bool fullRange = options.keepPlacements || (options.startPage == 0 && options.endPage == -1);
+    long startPage = options.keepPlacements ? 0 : options.startPage;
+    long endPage = options.keepPlacements ? -1 : options.endPage;
+
+    // Decide whether the document is large enough to split across helpers
+    unsigned long spanCount = 1;
+    unsigned long pageCount = 0;
+    if (options.pageWorkers > 1 && openHelperStream && fullRange) {
+        pageCount = CountPages(stream);
+
+        // No more spans than cores, and each span at least MIN_PAGES_PER_SPAN pages
+        unsigned long workers = static_cast<unsigned long>(options.pageWorkers);
+        unsigned long cores = std::thread::hardware_concurrency();
+        if (cores > 0) {
+            workers = std::min(workers, cores);
+        }
+        spanCount = std::min(workers, pageCount / MIN_PAGES_PER_SPAN);
+    }
+
+    if (spanCount > 1) {
+        // Extract page spans concurrently, then compose as one document
+        ExtractPagesInParallel(stream, pageCount, spanCount, openHelperStream, cancelFlag,
+                               textExtraction.textsForPages);
+    } else {
+        // Extract text from the requested pages (all pages by default)
+        PDFHummus::EStatusCode status = textExtraction.ExtractText(stream, startPage, endPage);
+
+        if (status != PDFHummus::eSuccess && !(cancelFlag && cancelFlag->load())) {
+            std::string errorMsg = "Extraction failed";
+            if (!textExtraction.LatestError.description.empty()) {
+                errorMsg += ": " + textExtraction.LatestError.description;
+            }
+            throw std::runtime_error(errorMsg);
+        }
+    }
 
     // Check for cancellation after extraction
     if (cancelFlag && cancelFlag->load()) {
         return {"", 0, bidiDirection, true};
     }
 
-    if (status != PDFHummus::eSuccess) {
-        std::string errorMsg = "Extraction failed";
-        if (!textExtraction.LatestError.description.empty()) {
-            errorMsg += ": " + textExtraction.LatestError.description;
+    if (!options.keepPlacements) {
+        if (!fullRange) {
+            CheckPageRangeInDocument(options, static_cast<long>(textExtraction.textsForPages.size()));
         }
-        throw std::runtime_error(errorMsg);
+        return ComposeTextCore(textExtraction, bidiDirection, options);
+    }
+
+    std::vector<uint8_t> placements;
+    SerializePlacements(textExtraction.textsForPages, placements);
+
+    // Drop the pages outside the requested range before composing
+    ParsedTextPlacementListList& pages = textExtraction.textsForPages;
+    long lastPage = static_cast<long>(pages.size()) - 1;
+    if (options.startPage != 0 || options.endPage != -1) {
+        CheckPageRangeInDocument(options, lastPage + 1 - options.startPage);
+    }
+    if (options.endPage >= 0 && options.endPage < lastPage) {
+        pages.erase(std::next(pages.begin(), options.endPage + 1), pages.end());
     }
+    long firstKept = std::min(options.startPage, static_cast<long>(pages.size()));
+    pages.erase(pages.begin(), std::next(pages.begin(), firstKept));
 
+    TextExtractionResult result = ComposeTextCore(textExtraction, bidiDirection, options);
+    result.placements.swap(placements);
+    return result;
+}
+
+// ============================================================================
+// CORE TEXT COMPOSITION LOGIC
+// ============================================================================
+
+TextExtractionResult TextExtractionBaseWorker::ComposeTextCore(
+    TextExtraction& textExtraction,
+    int bidiDirection,
+    const TextExtractionOptions& options
+) {
     // Auto-detect text direction if bidiDirection is -1
     int effectiveBidiDirection = bidiDirection;
     if (bidiDirection == -1) {
         effectiveBidiDirection = DetectTextDirection(textExtraction.textsForPages);
     }
 
+    // Pure-LTR fast path: an LTR document without RTL or bidi-control
+    // characters comes out of the bidi algorithm unchanged, so tell the
+    // composer to skip it (-1) and avoid opening ICU objects for every line
+    int composerBidiFlag = effectiveBidiDirection;
+    if (effectiveBidiDirection == 0 && !ContainsRtlContent(textExtraction.textsForPages)) {
+        composerBidiFlag = -1;
+    }
+
+    // Count pages
+    int extractedPageCount = static_cast<int>(textExtraction.textsForPages.size());
+
+    if (options.perPage || options.pageOffsets) {
+        // The composer ends every page with its page break, so concatenating
+        // page texts reproduces the whole-document composition
+        TextExtractionResult result = {"", extractedPageCount, effectiveBidiDirection, false};
+        result.pageTexts = ComposePageTexts(textExtraction.textsForPages, composerBidiFlag);
+        for (const auto& pageText : result.pageTexts) {
+            result.pageOffsets.push_back(result.text.size());
+            result.text += pageText;
+        }
+        if (!options.perPage) {
+            result.pageTexts.clear();
+        }
+        if (options.minhashPermutations > 0) {
+            result.minhash = ComputeMinHash(result.text, options.minhashPermutations);
+        }
+        return result;
+    }
+
     // Get results as text with bidi algorithm applied
     std::string extractedText = textExtraction.GetResultsAsText(
-        effectiveBidiDirection,
+        composerBidiFlag,
         TextComposer::eSpacingBoth
     );
 
-    // Count pages
-    int pageCount = static_cast<int>(textExtraction.textsForPages.size());
-
-    return {extractedText, pageCount, effectiveBidiDirection, false};
+    TextExtractionResult result = {extractedText, extractedPageCount, effectiveBidiDirection, false};
+    if (options.minhashPermutations > 0) {
+        // Signature is computed here, on the worker thread, not on the JS thread
+        result.minhash = ComputeMinHash(result.text, options.minhashPermutations);
+    }
+    return result;
 }
 
 // ============================================================================
@@ -67,9 +322,11 @@ TextExtractionResult TextExtractionBaseWorker::ExtractTextCore(
 
 TextExtractionBaseWorker::TextExtractionBaseWorker(
     Napi::Env env,
-    int bidiDirection
+    int bidiDirection,
+    const TextExtractionOptions& options
 ) : CancellableAsyncWorker<TextExtractionResult>(env),
-    bidiDirection_(bidiDirection) {
+    bidiDirection_(bidiDirection),
+    options_(options) {
     result_ = {"", 0, bidiDirection, false};
 }
 
@@ -81,5 +338,36 @@ Napi::Object TextExtractionBaseWorker::ResultToNapiObject(
     napiResult.Set("text", Napi::String::New(env, result.text));
     napiResult.Set("pageCount", Napi::Number::New(env, result.pageCount));
     napiResult.Set("bidiDirection", Napi::Number::New(env, result.bidiDirection));
+
+    if (options_.perPage) {
+        Napi::Array pageTexts = Napi::Array::New(env, result.pageTexts.size());
+        for (size_t i = 0; i < result.pageTexts.size(); ++i) {
+            pageTexts.Set(static_cast<uint32_t>(i), Napi::String::New(env, result.pageTexts[i]));
+        }
+        napiResult.Set("pageTexts", pageTexts);
+    }
+
+    if (options_.pageOffsets) {
+        Napi::Array pageOffsets = Napi::Array::New(env, result.pageOffsets.size());
+        for (size_t i = 0; i < result.pageOffsets.size(); ++i) {
+            pageOffsets.Set(static_cast<uint32_t>(i),
+                            Napi::Number::New(env, static_cast<double>(result.pageOffsets[i])));
+        }
+        napiResult.Set("pageOffsets", pageOffsets);
+    }
+
+    if (options_.minhashPermutations > 0) {
+        Napi::Array minhash = Napi::Array::New(env, result.minhash.size());
+        for (size_t i = 0; i < result.minhash.size(); ++i) {
+            minhash.Set(static_cast<uint32_t>(i), Napi::Number::New(env, result.minhash[i]));
+        }
+        napiResult.Set("minhash", minhash);
+    }
+
+    if (options_.keepPlacements) {
+        napiResult.Set("placements", Napi::Buffer<uint8_t>::Copy(
+            env, result.placements.data(), result.placements.size()
+        ));
+    }
     return napiResult;
 }
@@ -10,7 +10,11 @@
 
 #include "cancellable_async_worker.h"
 #include "IByteReaderWithPosition.h"
+#include "TextExtraction.h"
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 /**
  * Result structure for text extraction operations
@@ -20,34 +24,93 @@ struct TextExtractionResult {
     int pageCount;          // Number of pages processed
     int bidiDirection;      // Detected/applied direction (0=LTR, 1=RTL)
     bool cancelled;         // Whether extraction was cancelled
+    std::vector<std::string> pageTexts;     // Per-page text (only with options.perPage)
+    std::vector<uint64_t> pageOffsets;      // UTF-8 byte offset of each page in text (only with options.pageOffsets)
+    std::vector<uint32_t> minhash;          // MinHash signature (only with options.minhashPermutations)
+    std::vector<uint8_t> placements;        // Placement IR of all pages (only with options.keepPlacements)
 };
 
+/**
+ * Per-call options for text extraction operations
+ */
+struct TextExtractionOptions {
+    int pageWorkers = 1;    // Threads extracting page spans of one document (1 = sequential)
+    long startPage = 0;     // First page to extract (0-based)
+    long endPage = -1;      // Last page to extract, inclusive (-1 = last page)
+    bool perPage = false;   // Also return each page's text; text is then their concatenation
+    int minhashPermutations = 0;    // MinHash signature length over the composed text (0 = off)
+    bool prefetchReads = false;     // Read files through PrefetchingFileReader (file workers only)
+    bool keepPlacements = false;    // Also return the placements of all pages as placement IR
+    bool pageOffsets = false;       // Also return where each page starts in text
+};
+
+/**
+ * Opens an independent stream over the same PDF.
+ * Used to give helper threads their own read position.
+ */
+using StreamFactory = std::function<std::unique_ptr<IByteReaderWithPosition>()>;
+
 /**
  * Base class for text extraction workers
  * Provides shared extraction logic and result conversion
  */
 class TextExtractionBaseWorker : public CancellableAsyncWorker<TextExtractionResult> {
 public:
-    TextExtractionBaseWorker(Napi::Env env, int bidiDirection);
+    TextExtractionBaseWorker(Napi::Env env, int bidiDirection, const TextExtractionOptions& options);
 
 protected:
+    // Archive workers extract each entry with the same core logic; warm-up runs it once
+    friend class ArchiveExtractionBaseWorker;
+    friend class WarmupWorker;
+
     /**
      * Core text extraction logic (shared by file and buffer operations)
      *
+     * With options.pageWorkers > 1 and a stream factory, the page range is
+     * split into contiguous spans extracted concurrently, each helper thread
+     * reading through its own stream. The span count is capped by the
+     * hardware concurrency and by the page count, and a span starting after
+     * cancellation is skipped. All spans' placements are held until they are
+     * stitched together. A partial page range (startPage/endPage) is always
+     * extracted sequentially.
+     *
+     * With options.keepPlacements, all pages are extracted whatever the page
+     * range, and their placements are returned as placement IR before the
+     * requested range is composed.
+     *
      * @param stream Byte stream to read PDF from
      * @param bidiDirection Text direction: 0=LTR, 1=RTL, -1=auto-detect
+     * @param options Extraction options
+     * @param openHelperStream Opens extra streams for helper threads (optional)
      * @param cancelFlag Optional atomic flag for cancellation
      * @return Extraction result with text and metadata
      */
     static TextExtractionResult ExtractTextCore(
         IByteReaderWithPosition* stream,
         int bidiDirection,
+        const TextExtractionOptions& options,
+        const StreamFactory& openHelperStream = nullptr,
         std::atomic<bool>* cancelFlag = nullptr
     );
 
+    /**
+     * Compose extracted placements into text (shared with composition from placement IR)
+     *
+     * @param textExtraction Extraction holding the placements of the pages to compose
+     * @param bidiDirection Text direction: 0=LTR, 1=RTL, -1=auto-detect
+     * @param options Extraction options (perPage, pageOffsets, minhashPermutations)
+     * @return Result with the composed text
+     */
+    static TextExtractionResult ComposeTextCore(
+        TextExtraction& textExtraction,
+        int bidiDirection,
+        const TextExtractionOptions& options
+    );
+
     Napi::Object ResultToNapiObject(Napi::Env env, const TextExtractionResult& result) override;
 
     int bidiDirection_;
+    TextExtractionOptions options_;
 };
 
 #endif // TEXT_EXTRACTION_BASE_WORKER_H
@@ -11,8 +11,9 @@ TextExtractionFromBufferWorker::TextExtractionFromBufferWorker(
     Napi::Env env,
     const uint8_t* data,
     size_t size,
-    int bidiDirection
-) : TextExtractionBaseWorker(env, bidiDirection),
+    int bidiDirection,
+    const TextExtractionOptions& options
+) : TextExtractionBaseWorker(env, bidiDirection, options),
     bufferData_(new uint8_t[size]),
     bufferSize_(size) {
     // Copy buffer data for use in worker thread
@@ -30,8 +31,17 @@ void TextExtractionFromBufferWorker::Execute() {
         // Create a buffer reader for direct stream access
         BufferByteReader bufferReader(bufferData_.get(), bufferSize_);
 
+        // Helper threads get their own reader over the same (read-only) copy
+        StreamFactory openHelperStream = [this]() -> std::unique_ptr<IByteReaderWithPosition> {
+            return std::unique_ptr<IByteReaderWithPosition>(
+                new BufferByteReader(bufferData_.get(), bufferSize_)
+            );
+        };
+
         // Delegate to core function
-        result_ = TextExtractionBaseWorker::ExtractTextCore(&bufferReader, bidiDirection_, &cancelled_);
+        result_ = TextExtractionBaseWorker::ExtractTextCore(
+            &bufferReader, bidiDirection_, options_, openHelperStream, &cancelled_
+        );
 
         if (result_.cancelled) {
             SetError("Operation cancelled");
@@ -19,7 +19,8 @@ public:
         Napi::Env env,
         const uint8_t* data,
         size_t size,
-        int bidiDirection
+        int bidiDirection,
+        const TextExtractionOptions& options
     );
 
 protected:
@@ -3,24 +3,26 @@
  */
 
 #include "text_extraction_worker.h"
-#include "InputFile.h"
+#include "../prefetching_file_reader.h"
+#include "InputFileStream.h"
 #include <stdexcept>
 
 TextExtractionWorker::TextExtractionWorker(
     Napi::Env env,
     const std::string& filePath,
-    int bidiDirection
-) : TextExtractionBaseWorker(env, bidiDirection),
+    int bidiDirection,
+    const TextExtractionOptions& options
+) : TextExtractionBaseWorker(env, bidiDirection, options),
     filePath_(filePath) {
 }
 
 void TextExtractionWorker::Execute() {
     try {
         // Open PDF file
-        InputFile pdfFile;
-        PDFHummus::EStatusCode status = pdfFile.OpenFile(filePath_);
-
-        if (status != PDFHummus::eSuccess) {
+        std::unique_ptr<IByteReaderWithPosition> stream;
+        try {
+            stream = OpenStream();
+        } catch (const std::runtime_error&) {
             SetError("Failed to open PDF file");
             return;
         }
@@ -31,9 +33,13 @@ void TextExtractionWorker::Execute() {
             return;
         }
 
-        // Get the file stream and delegate to core function
-        IByteReaderWithPosition* stream = pdfFile.GetInputStream();
-        result_ = TextExtractionBaseWorker::ExtractTextCore(stream, bidiDirection_, &cancelled_);
+        // Helper threads each open their own handle on the same file
+        StreamFactory openHelperStream = [this]() { return OpenStream(); };
+
+        // Delegate to core function
+        result_ = TextExtractionBaseWorker::ExtractTextCore(
+            stream.get(), bidiDirection_, options_, openHelperStream, &cancelled_
+        );
 
         if (result_.cancelled) {
             SetError("Operation cancelled");
@@ -43,3 +49,16 @@ void TextExtractionWorker::Execute() {
         SetError(std::string("Extraction failed: ") + e.what());
     }
 }
+
+std::unique_ptr<IByteReaderWithPosition> TextExtractionWorker::OpenStream() const {
+#ifndef _WIN32
+    if (options_.prefetchReads) {
+        return std::unique_ptr<IByteReaderWithPosition>(new PrefetchingFileReader(filePath_));
+    }
+#endif
+    std::unique_ptr<InputFileStream> fileStream(new InputFileStream());
+    if (fileStream->Open(filePath_) != PDFHummus::eSuccess) {
+        throw std::runtime_error("Failed to open PDF file");
+    }
+    return fileStream;
+}
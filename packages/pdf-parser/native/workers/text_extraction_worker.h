@@ -14,12 +14,23 @@
  */
 class TextExtractionWorker : public TextExtractionBaseWorker {
 public:
-    TextExtractionWorker(Napi::Env env, const std::string& filePath, int bidiDirection);
+    TextExtractionWorker(
+        Napi::Env env,
+        const std::string& filePath,
+        int bidiDirection,
+        const TextExtractionOptions& options
+    );
 
 protected:
     void Execute() override;
 
 private:
+    /**
+     * Open a stream over the file, reading ahead when options_.prefetchReads is set
+     * @throws std::runtime_error if the file cannot be opened
+     */
+    std::unique_ptr<IByteReaderWithPosition> OpenStream() const;
+
     std::string filePath_;
 };
 
@@ -0,0 +1,86 @@
+/**
+ * Warm-up Worker Implementation
+ */
+
+#include "warmup_worker.h"
+#include "text_extraction_base_worker.h"
+#include "../buffer_byte_reader.h"
+#include <chrono>
+#include <stdexcept>
+
+namespace {
+
+// One page with one line of Helvetica text
+const char kWarmupPdf[] =
+    "%PDF-1.4\n"
+    "1 0 obj\n"
+    "<< /Type /Catalog /Pages 2 0 R >>\n"
+    "endobj\n"
+    "2 0 obj\n"
+    "<< /Type /Pages /Kids [3 0 R] /Count 1 >>\n"
+    "endobj\n"
+    "3 0 obj\n"
+    "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 200 50] /Contents 4 0 R /Resources << /Font << /F1 5 0 R >> >> >>\n"
+    "endobj\n"
+    "4 0 obj\n"
+    "<< /Length 37 >>\n"
+    "stream\n"
+    "BT /F1 12 Tf 10 20 Td (warm-up) Tj ET\n"
+    "endstream\n"
+    "endobj\n"
+    "5 0 obj\n"
+    "<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica >>\n"
+    "endobj\n"
+    "xref\n"
+    "0 6\n"
+    "0000000000 65535 f \n"
+    "0000000009 00000 n \n"
+    "0000000058 00000 n \n"
+    "0000000115 00000 n \n"
+    "0000000240 00000 n \n"
+    "0000000327 00000 n \n"
+    "trailer\n"
+    "<< /Size 6 /Root 1 0 R >>\n"
+    "startxref\n"
+    "397\n"
+    "%%EOF\n";
+
+} // namespace
+
+double WarmupWorker::TimeExtraction(int bidiDirection) {
+    auto startTime = std::chrono::steady_clock::now();
+
+    BufferByteReader reader(reinterpret_cast<const uint8_t*>(kWarmupPdf), sizeof(kWarmupPdf) - 1);
+    TextExtractionResult result = TextExtractionBaseWorker::ExtractTextCore(
+        &reader, bidiDirection, TextExtractionOptions()
+    );
+    if (result.pageCount != 1 || result.text.find("warm-up") == std::string::npos) {
+        throw std::runtime_error("Unexpected text from the warm-up document");
+    }
+
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - startTime
+    ).count();
+}
+
+WarmupWorker::WarmupWorker(Napi::Env env)
+    : CancellableAsyncWorker<WarmupResult>(env) {
+    result_ = {0, 0};
+}
+
+void WarmupWorker::Execute() {
+    try {
+        // Auto-detected direction takes the LTR fast path, which skips ICU
+        result_.extractionTime = TimeExtraction(-1);
+        result_.bidiTime = TimeExtraction(1);
+    } catch (const std::exception& e) {
+        SetError(std::string("Warm-up failed: ") + e.what());
+    }
+}
+
+Napi::Object WarmupWorker::ResultToNapiObject(Napi::Env env, const WarmupResult& result) {
+    Napi::Object napiResult = Napi::Object::New(env);
+    napiResult.Set("extractionTime", Napi::Number::New(env, result.extractionTime));
+    napiResult.Set("bidiTime", Napi::Number::New(env, result.bidiTime));
+    return napiResult;
+}
@@ -0,0 +1,42 @@
+/**
+ * Warm-up Worker
+ *
+ * Runs a tiny embedded PDF through the whole text extraction pipeline on a
+ * libuv pool thread, so that the work done lazily by the first extraction of
+ * a process (thread pool start, parser and font tables, ICU bidi data) is
+ * paid before the first request rather than by it.
+ */
+
+#ifndef WARMUP_WORKER_H
+#define WARMUP_WORKER_H
+
+#include "cancellable_async_worker.h"
+
+/**
+ * Timings of one warm-up run, in milliseconds
+ */
+struct WarmupResult {
+    double extractionTime;  // Extraction with direction detection (parser, tables, composer)
+    double bidiTime;        // Right-to-left extraction of the same document (ICU bidi)
+};
+
+/**
+ * AsyncWorker extracting the embedded warm-up document twice
+ */
+class WarmupWorker : public CancellableAsyncWorker<WarmupResult> {
+public:
+    explicit WarmupWorker(Napi::Env env);
+
+protected:
+    void Execute() override;
+    Napi::Object ResultToNapiObject(Napi::Env env, const WarmupResult& result) override;
+
+private:
+    /**
+     * Extract the warm-up document and return the milliseconds it took
+     * @throws std::runtime_error if it does not give the expected text
+     */
+    static double TimeExtraction(int bidiDirection);
+};
+
+#endif // WARMUP_WORKER_H
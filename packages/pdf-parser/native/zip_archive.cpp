@@ -0,0 +1,349 @@
+/**
+ * Zip Archives Implementation
+ */
+
+#include "zip_archive.h"
+#include "zlib.h"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+namespace PdfParser {
+
+static const uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+static const uint32_t CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+static const uint32_t END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+static const uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06064b50;
+static const uint32_t ZIP64_LOCATOR_SIGNATURE = 0x07064b50;
+
+static const size_t LOCAL_HEADER_SIZE = 30;
+static const size_t CENTRAL_HEADER_SIZE = 46;
+static const size_t END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+static const size_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE = 56;
+static const size_t ZIP64_LOCATOR_SIZE = 20;
+static const size_t MAX_ARCHIVE_COMMENT_SIZE = 0xFFFF;
+
+static const uint16_t ZIP64_EXTRA_FIELD_ID = 0x0001;
+static const uint16_t FLAG_ENCRYPTED = 0x0001;
+static const uint16_t METHOD_STORED = 0;
+static const uint16_t METHOD_DEFLATED = 8;
+
+// Compressed bytes read per step while inflating
+static const size_t INFLATE_CHUNK_SIZE = 64 * 1024;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static uint16_t ReadU16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+static uint32_t ReadU32(const uint8_t* p) {
+    return static_cast<uint32_t>(ReadU16(p)) | (static_cast<uint32_t>(ReadU16(p + 2)) << 16);
+}
+
+static uint64_t ReadU64(const uint8_t* p) {
+    return static_cast<uint64_t>(ReadU32(p)) | (static_cast<uint64_t>(ReadU32(p + 4)) << 32);
+}
+
+static uint64_t StreamSize(IByteReaderWithPosition* stream) {
+    stream->SetPositionFromEnd(0);
+    return static_cast<uint64_t>(stream->GetCurrentPosition());
+}
+
+/**
+ * Read exactly size bytes at offset
+ */
+static void ReadAt(IByteReaderWithPosition* stream, uint64_t offset, uint8_t* buffer, size_t size) {
+    stream->SetPosition(static_cast<IOBasicTypes::LongFilePositionType>(offset));
+    size_t total = 0;
+    while (total < size) {
+        IOBasicTypes::LongBufferSizeType read = stream->Read(buffer + total, size - total);
+        if (read == 0) {
+            throw std::runtime_error("Unexpected end of zip archive");
+        }
+        total += static_cast<size_t>(read);
+    }
+}
+
+/**
+ * Replace the 32-bit fields saturated at 0xFFFFFFFF with their ZIP64 extra
+ * field values, which appear in this order for the saturated fields only
+ */
+static void ApplyZip64Extra(const uint8_t* extra, size_t extraSize, ZipEntry& entry) {
+    size_t pos = 0;
+    while (pos + 4 <= extraSize) {
+        uint16_t id = ReadU16(extra + pos);
+        size_t size = ReadU16(extra + pos + 2);
+        const uint8_t* field = extra + pos + 4;
+        if (pos + 4 + size > extraSize) {
+            break;
+        }
+        if (id == ZIP64_EXTRA_FIELD_ID) {
+            size_t fieldPos = 0;
+            uint64_t* saturated[] = {&entry.uncompressedSize, &entry.compressedSize, &entry.localHeaderOffset};
+            for (uint64_t* value : saturated) {
+                if (*value != 0xFFFFFFFF) {
+                    continue;
+                }
+                if (fieldPos + 8 > size) {
+                    throw std::runtime_error("Truncated ZIP64 field of " + entry.name);
+                }
+                *value = ReadU64(field + fieldPos);
+                fieldPos += 8;
+            }
+            return;
+        }
+        pos += 4 + size;
+    }
+}
+
+/**
+ * Locate the central directory from the end of central directory record,
+ * following the ZIP64 locator when the classic record is saturated
+ */
+static void FindCentralDirectory(
+    IByteReaderWithPosition* stream,
+    uint64_t archiveSize,
+    uint64_t& outEntryCount,
+    uint64_t& outOffset,
+    uint64_t& outSize
+) {
+    if (archiveSize < END_OF_CENTRAL_DIRECTORY_SIZE) {
+        throw std::runtime_error("Not a zip archive");
+    }
+
+    // The record is the last thing in the archive, followed only by a comment
+    size_t tailSize = static_cast<size_t>(
+        std::min<uint64_t>(archiveSize, END_OF_CENTRAL_DIRECTORY_SIZE + MAX_ARCHIVE_COMMENT_SIZE)
+    );
+    uint64_t tailOffset = archiveSize - tailSize;
+    std::vector<uint8_t> tail(tailSize);
+    ReadAt(stream, tailOffset, tail.data(), tailSize);
+
+    size_t recordPos = tailSize - END_OF_CENTRAL_DIRECTORY_SIZE;
+    while (true) {
+        const uint8_t* record = tail.data() + recordPos;
+        if (ReadU32(record) == END_OF_CENTRAL_DIRECTORY_SIGNATURE &&
+            recordPos + END_OF_CENTRAL_DIRECTORY_SIZE + ReadU16(record + 20) == tailSize) {
+            break;
+        }
+        if (recordPos == 0) {
+            throw std::runtime_error("Not a zip archive");
+        }
+        --recordPos;
+    }
+
+    const uint8_t* record = tail.data() + recordPos;
+    if (ReadU16(record + 4) != 0 || ReadU16(record + 6) != 0) {
+        throw std::runtime_error("Multi-volume zip archives are not supported");
+    }
+    outEntryCount = ReadU16(record + 10);
+    outSize = ReadU32(record + 12);
+    outOffset = ReadU32(record + 16);
+
+    if (outEntryCount == 0xFFFF || outSize == 0xFFFFFFFF || outOffset == 0xFFFFFFFF) {
+        uint64_t recordOffset = tailOffset + recordPos;
+        if (recordOffset < ZIP64_LOCATOR_SIZE) {
+            throw std::runtime_error("Missing ZIP64 end of central directory locator");
+        }
+        uint8_t locator[ZIP64_LOCATOR_SIZE];
+        ReadAt(stream, recordOffset - ZIP64_LOCATOR_SIZE, locator, ZIP64_LOCATOR_SIZE);
+        if (ReadU32(locator) != ZIP64_LOCATOR_SIGNATURE) {
+            throw std::runtime_error("Missing ZIP64 end of central directory locator");
+        }
+
+        uint8_t zip64Record[ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE];
+        ReadAt(stream, ReadU64(locator + 8), zip64Record, ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE);
+        if (ReadU32(zip64Record) != ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+            throw std::runtime_error("Corrupt ZIP64 end of central directory record");
+        }
+        outEntryCount = ReadU64(zip64Record + 32);
+        outSize = ReadU64(zip64Record + 40);
+        outOffset = ReadU64(zip64Record + 48);
+    }
+
+    if (outOffset > archiveSize || outSize > archiveSize - outOffset) {
+        throw std::runtime_error("Central directory lies outside the zip archive");
+    }
+}
+
+/**
+ * Releases the inflate state however inflating ends
+ */
+struct InflateStream {
+    z_stream zs;
+
+    InflateStream() {
+        zs = z_stream();
+        // Negative window bits: raw deflate data, as stored in zip entries
+        if (inflateInit2(&zs, -MAX_WBITS) != Z_OK) {
+            throw std::runtime_error("Failed to initialize zlib");
+        }
+    }
+
+    ~InflateStream() {
+        inflateEnd(&zs);
+    }
+};
+
+static void InflateEntry(
+    IByteReaderWithPosition* stream,
+    const ZipEntry& entry,
+    uint64_t maxSize,
+    std::vector<uint8_t>& outData
+) {
+    InflateStream inflater;
+    std::vector<uint8_t> input(INFLATE_CHUNK_SIZE);
+    std::vector<uint8_t> output(INFLATE_CHUNK_SIZE);
+    uint64_t remaining = entry.compressedSize;
+
+    int status = Z_OK;
+    while (status != Z_STREAM_END) {
+        if (inflater.zs.avail_in == 0) {
+            if (remaining == 0) {
+                throw std::runtime_error("Truncated deflate data");
+            }
+            size_t chunk = static_cast<size_t>(std::min<uint64_t>(remaining, INFLATE_CHUNK_SIZE));
+            IOBasicTypes::LongBufferSizeType read = stream->Read(input.data(), chunk);
+            if (read == 0) {
+                throw std::runtime_error("Unexpected end of zip archive");
+            }
+            remaining -= read;
+            inflater.zs.next_in = input.data();
+            inflater.zs.avail_in = static_cast<uInt>(read);
+        }
+
+        inflater.zs.next_out = output.data();
+        inflater.zs.avail_out = static_cast<uInt>(output.size());
+        status = inflate(&inflater.zs, Z_NO_FLUSH);
+        if (status != Z_OK && status != Z_STREAM_END) {
+            throw std::runtime_error(
+                std::string("Corrupt deflate data: ") + (inflater.zs.msg ? inflater.zs.msg : "unknown error")
+            );
+        }
+
+        size_t produced = output.size() - inflater.zs.avail_out;
+        if (outData.size() + produced > maxSize) {
+            throw std::runtime_error("File too large: inflates past " + std::to_string(maxSize) + " bytes");
+        }
+        outData.insert(outData.end(), output.begin(), output.begin() + produced);
+    }
+}
+
+// ============================================================================
+// ZIP ARCHIVE
+// ============================================================================
+
+void ReadZipEntries(IByteReaderWithPosition* stream, std::vector<ZipEntry>& outEntries) {
+    uint64_t archiveSize = StreamSize(stream);
+    uint64_t entryCount = 0;
+    uint64_t directoryOffset = 0;
+    uint64_t directorySize = 0;
+    FindCentralDirectory(stream, archiveSize, entryCount, directoryOffset, directorySize);
+
+    std::vector<uint8_t> directory(static_cast<size_t>(directorySize));
+    ReadAt(stream, directoryOffset, directory.data(), directory.size());
+
+    outEntries.clear();
+    outEntries.reserve(static_cast<size_t>(std::min<uint64_t>(entryCount, directorySize / CENTRAL_HEADER_SIZE)));
+
+    size_t pos = 0;
+    for (uint64_t i = 0; i < entryCount; ++i) {
+        if (pos + CENTRAL_HEADER_SIZE > directory.size() ||
+            ReadU32(directory.data() + pos) != CENTRAL_HEADER_SIGNATURE) {
+            throw std::runtime_error("Corrupt zip central directory");
+        }
+        const uint8_t* header = directory.data() + pos;
+        size_t nameSize = ReadU16(header + 28);
+        size_t extraSize = ReadU16(header + 30);
+        size_t commentSize = ReadU16(header + 32);
+        if (pos + CENTRAL_HEADER_SIZE + nameSize + extraSize + commentSize > directory.size()) {
+            throw std::runtime_error("Corrupt zip central directory");
+        }
+
+        ZipEntry entry;
+        entry.flags = ReadU16(header + 8);
+        entry.method = ReadU16(header + 10);
+        entry.crc32 = ReadU32(header + 16);
+        entry.compressedSize = ReadU32(header + 20);
+        entry.uncompressedSize = ReadU32(header + 24);
+        entry.localHeaderOffset = ReadU32(header + 42);
+        entry.name.assign(reinterpret_cast<const char*>(header + CENTRAL_HEADER_SIZE), nameSize);
+        ApplyZip64Extra(header + CENTRAL_HEADER_SIZE + nameSize, extraSize, entry);
+        outEntries.push_back(std::move(entry));
+
+        pos += CENTRAL_HEADER_SIZE + nameSize + extraSize + commentSize;
+    }
+}
+
+bool IsPdfZipEntry(const ZipEntry& entry) {
+    const std::string& name = entry.name;
+    if (name.size() < 4 || name.compare(0, 9, "__MACOSX/") == 0) {
+        return false;
+    }
+    std::string extension = name.substr(name.size() - 4);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".pdf";
+}
+
+void ReadZipEntry(
+    IByteReaderWithPosition* stream,
+    const ZipEntry& entry,
+    uint64_t maxSize,
+    std::vector<uint8_t>& outData
+) {
+    if (entry.flags & FLAG_ENCRYPTED) {
+        throw std::runtime_error("Encrypted zip entries are not supported");
+    }
+    if (entry.method != METHOD_STORED && entry.method != METHOD_DEFLATED) {
+        throw std::runtime_error("Unsupported zip compression method " + std::to_string(entry.method));
+    }
+    if (entry.uncompressedSize > maxSize) {
+        throw std::runtime_error(
+            "File too large: " + std::to_string(entry.uncompressedSize) +
+            " bytes (max: " + std::to_string(maxSize) + ")"
+        );
+    }
+
+    // The local header repeats the name and has its own extra field; only
+    // their lengths are needed to find the data
+    uint8_t localHeader[LOCAL_HEADER_SIZE];
+    ReadAt(stream, entry.localHeaderOffset, localHeader, LOCAL_HEADER_SIZE);
+    if (ReadU32(localHeader) != LOCAL_HEADER_SIGNATURE) {
+        throw std::runtime_error("Corrupt zip local header");
+    }
+    uint64_t dataOffset = entry.localHeaderOffset + LOCAL_HEADER_SIZE +
+                          ReadU16(localHeader + 26) + ReadU16(localHeader + 28);
+
+    outData.clear();
+    if (entry.method == METHOD_STORED) {
+        if (entry.compressedSize != entry.uncompressedSize) {
+            throw std::runtime_error("Corrupt zip entry sizes");
+        }
+        outData.resize(static_cast<size_t>(entry.uncompressedSize));
+        ReadAt(stream, dataOffset, outData.data(), outData.size());
+    } else {
+        outData.reserve(static_cast<size_t>(entry.uncompressedSize));
+        stream->SetPosition(static_cast<IOBasicTypes::LongFilePositionType>(dataOffset));
+        InflateEntry(stream, entry, maxSize, outData);
+    }
+
+    if (outData.size() != entry.uncompressedSize) {
+        throw std::runtime_error("Zip entry size does not match its central directory record");
+    }
+
+    // zlib takes lengths as uInt, so checksum large entries in pieces
+    uLong checksum = ::crc32(0L, Z_NULL, 0);
+    for (size_t pos = 0; pos < outData.size(); pos += INFLATE_CHUNK_SIZE) {
+        size_t size = std::min(INFLATE_CHUNK_SIZE, outData.size() - pos);
+        checksum = ::crc32(checksum, outData.data() + pos, static_cast<uInt>(size));
+    }
+    if (static_cast<uint32_t>(checksum) != entry.crc32) {
+        throw std::runtime_error("Zip entry CRC-32 mismatch");
+    }
+}
+
+} // namespace PdfParser
@@ -0,0 +1,73 @@
+/**
+ * Zip Archives
+ *
+ * Reads the central directory of a zip archive and inflates single entries
+ * into memory. Entries are located through the central directory only (the
+ * local headers are trusted for nothing but their own length), so archives
+ * written with data descriptors are handled too. Stored and deflated entries
+ * are supported, including ZIP64 sizes and offsets; encrypted entries and
+ * other compression methods are reported as errors.
+ *
+ * All reads go through IByteReaderWithPosition, so an archive can be read
+ * from a file or a memory buffer, and each thread reading entries concurrently
+ * uses its own stream over the same archive.
+ */
+
+#ifndef ZIP_ARCHIVE_H
+#define ZIP_ARCHIVE_H
+
+#include "IByteReaderWithPosition.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace PdfParser {
+
+/**
+ * One file of a zip archive, as listed in its central directory
+ */
+struct ZipEntry {
+    std::string name;               // Path inside the archive, '/'-separated
+    uint16_t flags;                 // General purpose bit flags
+    uint16_t method;                // 0 = stored, 8 = deflated
+    uint32_t crc32;                 // CRC-32 of the uncompressed data
+    uint64_t compressedSize;
+    uint64_t uncompressedSize;
+    uint64_t localHeaderOffset;     // Offset of the entry's local file header
+};
+
+/**
+ * List the entries of an archive
+ *
+ * @param stream Stream over the whole archive
+ * @param outEntries Receives the entries in central directory order
+ * @throws std::runtime_error if the stream is not a readable zip archive
+ */
+void ReadZipEntries(IByteReaderWithPosition* stream, std::vector<ZipEntry>& outEntries);
+
+/**
+ * Whether an entry is a PDF worth extracting: a file named *.pdf (any case),
+ * excluding the resource-fork copies macOS adds under __MACOSX/
+ */
+bool IsPdfZipEntry(const ZipEntry& entry);
+
+/**
+ * Decompress an entry into memory and check its CRC-32
+ *
+ * @param stream Stream over the whole archive
+ * @param entry Entry to read, from ReadZipEntries on the same archive
+ * @param maxSize Largest uncompressed size accepted; checked while inflating,
+ *        so the declared size cannot be used to get past it
+ * @param outData Receives the uncompressed bytes
+ * @throws std::runtime_error if the entry cannot be read, is too large or is corrupt
+ */
+void ReadZipEntry(
+    IByteReaderWithPosition* stream,
+    const ZipEntry& entry,
+    uint64_t maxSize,
+    std::vector<uint8_t>& outData
+);
+
+} // namespace PdfParser
+
+#endif // ZIP_ARCHIVE_H
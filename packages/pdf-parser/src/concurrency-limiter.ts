@@ -0,0 +1,190 @@
+import { PdfExtractionError, PdfErrorCode } from './types';
+
+/**
+ * Adaptive limit on concurrent native extractions
+ *
+ * A gradient limiter in the style of Netflix's concurrency-limits (Gradient2).
+ * Each completed extraction reports its execution time per megabyte of input.
+ * A long-term average of that cost is the baseline; when the short-term cost
+ * rises above it (threads contending for cores, memory bandwidth or the libuv
+ * pool), the limit shrinks in proportion, and while the two agree it grows by
+ * a queue allowance of sqrt(limit). Timeouts cut the limit multiplicatively.
+ * Requests over the limit wait in FIFO order.
+ */
+
+// Samples averaged into the baseline and into the short-term cost
+const LONG_WINDOW = 100;
+const SHORT_WINDOW = 10;
+// Short-term cost may exceed the baseline by this factor before the limit shrinks
+const TOLERANCE = 1.5;
+// Weight of each new limit estimate
+const SMOOTHING = 0.2;
+// Limit kept after a timeout
+const BACKOFF_RATIO = 0.9;
+// Inputs are normalized per megabyte, small ones as if they were this large
+const MIN_SAMPLE_BYTES = 256 * 1024;
+
+export interface ConcurrencyLimiterOptions {
+  /** Limit before any measurement */
+  initialLimit: number;
+  /** Lowest limit (default: 1) */
+  minLimit?: number;
+  /** Highest limit */
+  maxLimit: number;
+}
+
+/**
+ * Current state of a limiter
+ */
+export interface ConcurrencyStats {
+  /** Extractions allowed to run at once */
+  limit: number;
+  /** Extractions running */
+  inFlight: number;
+  /** Extractions waiting for a slot */
+  queued: number;
+}
+
+/**
+ * A slot held by one extraction. Exactly one of the methods must be called,
+ * once the native work has finished.
+ */
+export interface ConcurrencyPermit {
+  /** Milliseconds spent waiting for the slot */
+  readonly queueWaitMs: number;
+  /** The extraction succeeded; its cost feeds the limit */
+  success(bytes: number): void;
+  /** The extraction timed out; the limit backs off */
+  dropped(): void;
+  /** The extraction failed for its own reasons; the limit is unchanged */
+  ignore(): void;
+}
+
+interface Waiter {
+  grant: () => void;
+  timer?: NodeJS.Timeout;
+}
+
+export class ConcurrencyLimiter {
+  private estimatedLimit: number;
+  private readonly minLimit: number;
+  private readonly maxLimit: number;
+  private inFlight = 0;
+  private readonly waiters: Waiter[] = [];
+  private longTermCost = 0;
+  private shortTermCost = 0;
+
+  constructor(options: ConcurrencyLimiterOptions) {
+    this.minLimit = Math.max(1, options.minLimit ?? 1);
+    this.maxLimit = Math.max(this.minLimit, options.maxLimit);
+    this.estimatedLimit = clamp(options.initialLimit, this.minLimit, this.maxLimit);
+  }
+
+  get limit(): number {
+    return Math.floor(this.estimatedLimit);
+  }
+
+  get stats(): ConcurrencyStats {
+    return { limit: this.limit, inFlight: this.inFlight, queued: this.waiters.length };
+  }
+
+  /**
+   * Wait for a slot. Rejects with a TIMEOUT error after timeoutMs in the queue.
+   */
+  acquire(timeoutMs: number): Promise<ConcurrencyPermit> {
+    const queuedAt = Date.now();
+
+    return new Promise<ConcurrencyPermit>((resolve, reject) => {
+      const grant = () => {
+        this.inFlight++;
+        resolve(this.createPermit(Date.now() - queuedAt, Date.now()));
+      };
+
+      if (this.waiters.length === 0 && this.inFlight < this.limit) {
+        grant();
+        return;
+      }
+
+      const waiter: Waiter = { grant };
+      if (timeoutMs > 0) {
+        waiter.timer = setTimeout(() => {
+          this.waiters.splice(this.waiters.indexOf(waiter), 1);
+          reject(
+            new PdfExtractionError(
+              `Timed out after ${timeoutMs}ms waiting for an extraction slot`,
+              PdfErrorCode.TIMEOUT
+            )
+          );
+        }, timeoutMs);
+      }
+      this.waiters.push(waiter);
+    });
+  }
+
+  private createPermit(queueWaitMs: number, startedAt: number): ConcurrencyPermit {
+    let settled = false;
+    const settle = (update: () => void) => {
+      if (settled) {
+        return;
+      }
+      settled = true;
+      // Measured with this extraction still counted, as it ran
+      update();
+      this.inFlight--;
+      this.grantWaiters();
+    };
+
+    return {
+      queueWaitMs,
+      success: (bytes: number) =>
+        settle(() =>
+          this.onSample((Date.now() - startedAt) / (Math.max(bytes, MIN_SAMPLE_BYTES) / 1048576))
+        ),
+      dropped: () =>
+        settle(() => {
+          this.estimatedLimit = Math.max(this.minLimit, this.estimatedLimit * BACKOFF_RATIO);
+        }),
+      ignore: () => settle(() => undefined),
+    };
+  }
+
+  private onSample(cost: number): void {
+    if (this.longTermCost === 0) {
+      this.longTermCost = cost;
+      this.shortTermCost = cost;
+    } else {
+      this.longTermCost += (cost - this.longTermCost) / LONG_WINDOW;
+      this.shortTermCost += (cost - this.shortTermCost) / SHORT_WINDOW;
+    }
+
+    // After a sustained drop in load, let the baseline catch up quickly
+    if (this.longTermCost / this.shortTermCost > 2) {
+      this.longTermCost *= 0.95;
+    }
+
+    // Underused: the samples say nothing about a higher limit
+    if (this.inFlight < this.estimatedLimit / 2) {
+      return;
+    }
+
+    const gradient = clamp((TOLERANCE * this.longTermCost) / this.shortTermCost, 0.5, 1);
+    const target = this.estimatedLimit * gradient + Math.sqrt(this.estimatedLimit);
+    this.estimatedLimit = clamp(
+      this.estimatedLimit * (1 - SMOOTHING) + target * SMOOTHING,
+      this.minLimit,
+      this.maxLimit
+    );
+  }
+
+  private grantWaiters(): void {
+    while (this.waiters.length > 0 && this.inFlight < this.limit) {
+      const waiter = this.waiters.shift() as Waiter;
+      clearTimeout(waiter.timer);
+      waiter.grant();
+    }
+  }
+}
+
+function clamp(value: number, min: number, max: number): number {
+  return Math.min(max, Math.max(min, value));
+}
@@ -0,0 +1,90 @@
+import { promises as fs } from 'fs';
+import { createHash } from 'crypto';
+import { PdfExtractionResult, PdfMetadata } from './types';
+
+/**
+ * Path-keyed cache of extraction results for local files
+ *
+ * Entries are validated by the file's stat identity (device, inode, size and
+ * nanosecond mtime), so a hit costs a single stat() call and never reads the
+ * file. Only when the identity changed (the file was touched, copied over or
+ * replaced) is the content hashed, and results are kept if the bytes are
+ * still the same.
+ */
+
+/**
+ * Stat identity of a file. Any write or replacement changes at least one field.
+ */
+export interface FileIdentity {
+  dev: bigint;
+  ino: bigint;
+  size: bigint;
+  mtimeNs: bigint;
+}
+
+/**
+ * Cached results of one file
+ */
+export interface FileCacheEntry {
+  /** Identity the results were validated against */
+  identity: FileIdentity;
+  /** SHA-256 of the content, recorded when the entry is created */
+  contentHash?: string;
+  /** Whole-document text extraction */
+  text?: PdfExtractionResult;
+  /** Document metadata */
+  metadata?: PdfMetadata;
+}
+
+/**
+ * Stat a file for its identity (one stat() call)
+ */
+export async function statIdentity(filePath: string): Promise<FileIdentity> {
+  const stats = await fs.stat(filePath, { bigint: true });
+  return { dev: stats.dev, ino: stats.ino, size: stats.size, mtimeNs: stats.mtimeNs };
+}
+
+export function sameIdentity(a: FileIdentity, b: FileIdentity): boolean {
+  return a.dev === b.dev && a.ino === b.ino && a.size === b.size && a.mtimeNs === b.mtimeNs;
+}
+
+export function hashContent(buffer: Buffer): string {
+  return createHash('sha256').update(buffer).digest('hex');
+}
+
+/**
+ * Least-recently-used cache of file results, keyed by path
+ */
+export class FileResultCache {
+  private readonly entries = new Map<string, FileCacheEntry>();
+
+  constructor(private readonly maxEntries: number) {}
+
+  get(filePath: string): FileCacheEntry | undefined {
+    const entry = this.entries.get(filePath);
+    if (entry) {
+      // Refresh recency
+      this.entries.delete(filePath);
+      this.entries.set(filePath, entry);
+    }
+    return entry;
+  }
+
+  set(filePath: string, entry: FileCacheEntry): void {
+    this.entries.delete(filePath);
+    this.entries.set(filePath, entry);
+
+    while (this.entries.size > this.maxEntries) {
+      const oldestPath = this.entries.keys().next().value as string;
+      this.entries.delete(oldestPath);
+    }
+  }
+
+  delete(filePath: string): void {
+    this.entries.delete(filePath);
+  }
+
+  get size(): number {
+    return this.entries.size;
+  }
+}
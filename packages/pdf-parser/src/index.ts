@@ -5,11 +5,27 @@
  * Provides clean, type-safe APIs for extracting text from PDF files
  */
 
-export { PdfExtractor } from './pdf-extractor';
+export { PdfExtractor, warmup } from './pdf-extractor';
+export { LshIndex, LshIndexOptions, NearDuplicateMatch, estimateSimilarity } from './lsh-index';
+export {
+  ConcurrencyLimiter,
+  ConcurrencyLimiterOptions,
+  ConcurrencyStats,
+} from './concurrency-limiter';
 export {
   PdfExtractionOptions,
   PdfExtractionResult,
   PdfMetadata,
+  PdfPageFingerprints,
+  PdfPageRange,
+  PdfTextRequestOptions,
+  PdfOutline,
+  PdfOutlineEntry,
+  PdfSectionResult,
+  PdfArchiveEntryResult,
+  PdfArchiveResult,
+  PdfWarmupResult,
+  ReadCacheStats,
   PdfExtractionError,
   PdfErrorCode,
 } from './types';
@@ -21,6 +37,17 @@ export {
   withTimeout,
   DEFAULT_MAX_FILE_SIZE,
   DEFAULT_TIMEOUT,
+  DEFAULT_PAGE_WORKERS,
+  DEFAULT_REVISION_CACHE_SIZE,
+  DEFAULT_MINHASH_PERMUTATIONS,
+  DEFAULT_FILE_CACHE_SIZE,
+  DEFAULT_MAX_CONCURRENCY,
+  DEFAULT_PREFETCH_READS,
+  DEFAULT_ARCHIVE_WORKERS,
+  DEFAULT_PLACEMENT_CACHE_SIZE,
+  DEFAULT_PLACEMENT_CACHE_BYTES,
+  DEFAULT_PAGE_OFFSETS,
+  DEFAULT_LAZY_METADATA,
 } from './utils';
 
 // Re-export for convenience
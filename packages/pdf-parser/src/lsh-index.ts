@@ -0,0 +1,142 @@
+/**
+ * Locality-sensitive hashing index over MinHash signatures
+ *
+ * Signatures are split into bands of rowsPerBand values. Two documents become
+ * candidates when any band matches exactly, which happens with probability
+ * 1 - (1 - s^rows)^bands for Jaccard similarity s. Candidates are then scored
+ * by the fraction of equal signature values, so only documents sharing a band
+ * are ever compared.
+ */
+
+export interface LshIndexOptions {
+  /** Number of bands the signature is split into */
+  bands: number;
+  /** Signature values per band */
+  rowsPerBand: number;
+  /** Oldest documents are dropped beyond this many (default: unbounded) */
+  maxEntries?: number;
+}
+
+export interface NearDuplicateMatch {
+  /** Identifier the matching document was added under */
+  id: string;
+  /** Estimated Jaccard similarity of the shingled texts (0..1) */
+  similarity: number;
+}
+
+/**
+ * Estimate Jaccard similarity as the fraction of equal MinHash values
+ */
+export function estimateSimilarity(a: number[], b: number[]): number {
+  const length = Math.min(a.length, b.length);
+  if (length === 0) {
+    return 0;
+  }
+
+  let equal = 0;
+  for (let i = 0; i < length; i++) {
+    if (a[i] === b[i]) {
+      equal++;
+    }
+  }
+  return equal / length;
+}
+
+export class LshIndex {
+  private readonly buckets = new Map<string, Set<string>>();
+  private readonly signatures = new Map<string, number[]>();
+
+  constructor(private readonly options: LshIndexOptions) {}
+
+  /**
+   * Minimum signature length this index accepts
+   */
+  get signatureLength(): number {
+    return this.options.bands * this.options.rowsPerBand;
+  }
+
+  get size(): number {
+    return this.signatures.size;
+  }
+
+  /**
+   * Add (or replace) a document's signature
+   */
+  add(id: string, signature: number[]): void {
+    this.checkSignature(signature);
+    this.remove(id);
+
+    this.signatures.set(id, signature);
+    for (const key of this.bandKeys(signature)) {
+      let bucket = this.buckets.get(key);
+      if (!bucket) {
+        bucket = new Set();
+        this.buckets.set(key, bucket);
+      }
+      bucket.add(id);
+    }
+
+    const maxEntries = this.options.maxEntries;
+    if (maxEntries !== undefined) {
+      while (this.signatures.size > maxEntries) {
+        this.remove(this.signatures.keys().next().value as string);
+      }
+    }
+  }
+
+  remove(id: string): void {
+    const signature = this.signatures.get(id);
+    if (!signature) {
+      return;
+    }
+
+    this.signatures.delete(id);
+    for (const key of this.bandKeys(signature)) {
+      const bucket = this.buckets.get(key);
+      bucket?.delete(id);
+      if (bucket && bucket.size === 0) {
+        this.buckets.delete(key);
+      }
+    }
+  }
+
+  /**
+   * Find indexed documents at or above a similarity threshold, most similar first
+   */
+  query(signature: number[], threshold: number): NearDuplicateMatch[] {
+    this.checkSignature(signature);
+
+    const candidates = new Set<string>();
+    for (const key of this.bandKeys(signature)) {
+      this.buckets.get(key)?.forEach((id) => candidates.add(id));
+    }
+
+    const matches: NearDuplicateMatch[] = [];
+    candidates.forEach((id) => {
+      const similarity = estimateSimilarity(signature, this.signatures.get(id) as number[]);
+      if (similarity >= threshold) {
+        matches.push({ id, similarity });
+      }
+    });
+
+    return matches.sort((a, b) => b.similarity - a.similarity);
+  }
+
+  private bandKeys(signature: number[]): string[] {
+    const { bands, rowsPerBand } = this.options;
+    const keys: string[] = [];
+    for (let band = 0; band < bands; band++) {
+      const rows = signature.slice(band * rowsPerBand, (band + 1) * rowsPerBand);
+      keys.push(`${band}:${rows.join(',')}`);
+    }
+    return keys;
+  }
+
+  private checkSignature(signature: number[]): void {
+    if (signature.length < this.signatureLength) {
+      throw new Error(
+        `Signature too short: ${signature.length} values (index needs ${this.signatureLength})`
+      );
+    }
+  }
+}
@@ -0,0 +1,78 @@
+import { PdfOutlineEntry } from './types';
+
+/**
+ * Outline helpers
+ *
+ * The native layer returns outline entries flattened in document order with
+ * their nesting level and target page. A section runs from its own page up
+ * to the page before the next entry at the same or a shallower level starts,
+ * or to the end of the document.
+ */
+
+/**
+ * Outline entry as returned by the native addon (no section span yet)
+ */
+export type NativeOutlineEntry = Omit<PdfOutlineEntry, 'endPageNumber'>;
+
+/**
+ * Attach each entry's last page (endPageNumber)
+ */
+export function withSectionSpans(
+  entries: NativeOutlineEntry[],
+  pageCount: number
+): PdfOutlineEntry[] {
+  return entries.map((entry, i) => {
+    if (entry.pageNumber === null) {
+      return { ...entry, endPageNumber: null };
+    }
+
+    let endPageNumber = pageCount;
+    for (let j = i + 1; j < entries.length; j++) {
+      const next = entries[j];
+      if (next.level <= entry.level && next.pageNumber !== null) {
+        // A following section starting on the same page still owns that page
+        endPageNumber = next.pageNumber > entry.pageNumber ? next.pageNumber - 1 : entry.pageNumber;
+        break;
+      }
+    }
+
+    return { ...entry, endPageNumber };
+  });
+}
+
+function normalizeTitle(title: string): string {
+  return title.replace(/\s+/g, ' ').trim().toLowerCase();
+}
+
+/**
+ * Find the outline entry best matching a section name: an exact title match
+ * first, then a title starting with the name ("Section 4" finds
+ * "Section 4: Termination"), then a title containing it. Case and whitespace
+ * are ignored, and entries without a resolvable page are skipped.
+ */
+export function findSection(
+  entries: PdfOutlineEntry[],
+  section: string
+): PdfOutlineEntry | undefined {
+  const query = normalizeTitle(section);
+  if (!query) {
+    return undefined;
+  }
+
+  const candidates = entries.filter((entry) => entry.pageNumber !== null);
+  const titles = candidates.map((entry) => normalizeTitle(entry.title));
+
+  const matchers: ((title: string) => boolean)[] = [
+    (title) => title === query,
+    (title) => title.startsWith(query),
+    (title) => title.includes(query),
+  ];
+  for (const matches of matchers) {
+    const index = titles.findIndex(matches);
+    if (index !== -1) {
+      return candidates[index];
+    }
+  }
+
+  return undefined;
+}
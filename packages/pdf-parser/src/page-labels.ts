@@ -0,0 +1,188 @@
+/**
+ * Page label helpers
+ *
+ * Page labels are the numbers printed on pages ("iv", "12", "A-3"). A PDF
+ * describes them as ranges: from a start page on, each page is labelled with
+ * a prefix and a number in the range's style, counting up from a first
+ * number. Labels are formatted and resolved from the ranges alone, so
+ * addressing a page by label never scans the document.
+ */
+
+/** Numbering style: decimal, upper/lower roman, upper/lower letters */
+export type PageLabelStyle = 'D' | 'R' | 'r' | 'A' | 'a';
+
+/**
+ * One label range, as read from the /PageLabels number tree
+ */
+export interface PageLabelRange {
+  /** First page of the range (1-based) */
+  startPage: number;
+  /** Numbering style, or null when pages are labelled with the prefix only */
+  style: PageLabelStyle | null;
+  /** Label prefix */
+  prefix: string;
+  /** Numeric part of the first page's label */
+  firstNumber: number;
+}
+
+const ROMAN_NUMERALS: [number, string][] = [
+  [1000, 'M'],
+  [900, 'CM'],
+  [500, 'D'],
+  [400, 'CD'],
+  [100, 'C'],
+  [90, 'XC'],
+  [50, 'L'],
+  [40, 'XL'],
+  [10, 'X'],
+  [9, 'IX'],
+  [5, 'V'],
+  [4, 'IV'],
+  [1, 'I'],
+];
+
+function toRoman(value: number): string {
+  let roman = '';
+  for (const [numeral, symbol] of ROMAN_NUMERALS) {
+    while (value >= numeral) {
+      roman += symbol;
+      value -= numeral;
+    }
+  }
+  return roman;
+}
+
+function fromRoman(roman: string): number | undefined {
+  if (!/^[MDCLXVI]+$/.test(roman)) {
+    return undefined;
+  }
+  let value = 0;
+  let rest = roman;
+  for (const [numeral, symbol] of ROMAN_NUMERALS) {
+    while (rest.startsWith(symbol)) {
+      value += numeral;
+      rest = rest.slice(symbol.length);
+    }
+  }
+  // Non-canonical numerals (e.g. "IIII") are rejected by the round trip
+  return rest === '' && toRoman(value) === roman ? value : undefined;
+}
+
+// A-Z, then AA-ZZ, then AAA-ZZZ and so on
+function toLetters(value: number): string {
+  const letter = String.fromCharCode(65 + ((value - 1) % 26));
+  return letter.repeat(Math.floor((value - 1) / 26) + 1);
+}
+
+function fromLetters(letters: string): number | undefined {
+  if (!/^([A-Z])\1*$/.test(letters)) {
+    return undefined;
+  }
+  return (letters.length - 1) * 26 + (letters.charCodeAt(0) - 64);
+}
+
+function formatNumber(style: PageLabelStyle, value: number): string {
+  switch (style) {
+    case 'D':
+      return String(value);
+    case 'R':
+      return toRoman(value);
+    case 'r':
+      return toRoman(value).toLowerCase();
+    case 'A':
+      return toLetters(value);
+    case 'a':
+      return toLetters(value).toLowerCase();
+  }
+}
+
+function parseNumber(style: PageLabelStyle, text: string): number | undefined {
+  switch (style) {
+    case 'D':
+      return /^[1-9][0-9]*$/.test(text) ? Number(text) : undefined;
+    case 'R':
+      return fromRoman(text);
+    case 'r':
+      return text === text.toLowerCase() ? fromRoman(text.toUpperCase()) : undefined;
+    case 'A':
+      return fromLetters(text);
+    case 'a':
+      return text === text.toLowerCase() ? fromLetters(text.toUpperCase()) : undefined;
+  }
+}
+
+/**
+ * Last page of each range (the page before the next range starts)
+ */
+function rangeEndPage(ranges: PageLabelRange[], index: number, pageCount: number): number {
+  return index + 1 < ranges.length ? ranges[index + 1].startPage - 1 : pageCount;
+}
+
+/**
+ * Label of every page, in page order. Pages before the first range (which a
+ * well-formed document does not have) are labelled with their page number.
+ */
+export function expandPageLabels(ranges: PageLabelRange[], pageCount: number): string[] {
+  const labels: string[] = [];
+  const firstLabelled = ranges.length > 0 ? ranges[0].startPage : pageCount + 1;
+  for (let page = 1; page < firstLabelled && page <= pageCount; page++) {
+    labels.push(String(page));
+  }
+  ranges.forEach((range, i) => {
+    const endPage = rangeEndPage(ranges, i, pageCount);
+    for (let page = range.startPage; page <= endPage; page++) {
+      const value = range.firstNumber + (page - range.startPage);
+      labels.push(range.style ? range.prefix + formatNumber(range.style, value) : range.prefix);
+    }
+  });
+  return labels;
+}
+
+/**
+ * Resolve a page label to its 1-based page number, directly from the ranges.
+ * The first page carrying the label wins. Without label ranges, labels are
+ * plain page numbers.
+ *
+ * @returns Page number, or undefined when no page carries the label
+ */
+export function resolvePageLabel(
+  ranges: PageLabelRange[] | null,
+  pageCount: number,
+  label: string
+): number | undefined {
+  const trimmed = label.trim();
+  const firstLabelled = ranges && ranges.length > 0 ? ranges[0].startPage : pageCount + 1;
+
+  if (ranges) {
+    for (let i = 0; i < ranges.length; i++) {
+      const range = ranges[i];
+      if (!trimmed.startsWith(range.prefix)) {
+        continue;
+      }
+      if (!range.style) {
+        if (trimmed === range.prefix) {
+          return range.startPage;
+        }
+        continue;
+      }
+
+      const value = parseNumber(range.style, trimmed.slice(range.prefix.length));
+      if (value === undefined) {
+        continue;
+      }
+      const page = range.startPage + (value - range.firstNumber);
+      if (page >= range.startPage && page <= rangeEndPage(ranges, i, pageCount)) {
+        return page;
+      }
+    }
+  }
+
+  // Unlabelled pages (all of them when the document has no labels)
+  if (/^[1-9][0-9]*$/.test(trimmed)) {
+    const page = Number(trimmed);
+    if (page < firstLabelled && page <= pageCount) {
+      return page;
+    }
+  }
+  return undefined;
+}
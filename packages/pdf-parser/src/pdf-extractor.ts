@@ -4,27 +4,181 @@ import {
   PdfExtractionOptions,
   PdfExtractionResult,
   PdfMetadata,
+  PdfPageFingerprints,
+  PdfPageRange,
+  PdfTextRequestOptions,
+  PdfOutline,
+  PdfOutlineEntry,
+  PdfSectionResult,
+  PdfArchiveEntryResult,
+  PdfArchiveResult,
+  PdfWarmupResult,
+  ReadCacheStats,
   PdfExtractionError,
   PdfErrorCode,
 } from './types';
 import { validateFile, createDefaultOptions, withTimeout } from './utils';
+import { RevisionCache, RevisionEntry, hashRevisions } from './revision-cache';
+import { PlacementCache } from './placement-cache';
+import { NativeOutlineEntry, withSectionSpans, findSection } from './outline';
+import { PageLabelRange, expandPageLabels, resolvePageLabel } from './page-labels';
+import { ConcurrencyLimiter, ConcurrencyStats } from './concurrency-limiter';
+import {
+  FileCacheEntry,
+  FileIdentity,
+  FileResultCache,
+  hashContent,
+  sameIdentity,
+  statIdentity,
+} from './file-cache';
+
+interface NativeTextExtractionOptions {
+  pageWorkers: number;
+  startPage?: number;
+  endPage?: number;
+  perPage?: boolean;
+  minhashPermutations?: number;
+  prefetchReads?: boolean;
+  keepPlacements?: boolean;
+  pageOffsets?: boolean;
+}
+
+interface NativeTextExtractionResult {
+  text: string;
+  pageCount: number;
+  bidiDirection: number;
+  pageTexts?: string[];
+  reusedPageCount?: number;
+  minhash?: number[];
+  placements?: Buffer;
+  pageOffsets?: number[];
+}
+
+interface NativeArchiveExtractionOptions extends NativeTextExtractionOptions {
+  entryWorkers: number;
+  maxEntrySize: number;
+}
+
+interface NativeMetadataOptions {
+  lazyXref: boolean;
+}
+
+/**
+ * One archive entry as reported by the native layer: the text fields are set on
+ * success, error on failure
+ */
+interface NativeArchiveEntry extends Partial<NativeTextExtractionResult> {
+  name: string;
+  index: number;
+  fileSize: number;
+  processingTime: number;
+  error?: string;
+}
+
+interface NativeArchiveSummary {
+  entryCount: number;
+  failedCount: number;
+}
+
+type NativeMetadata = Omit<PdfMetadata, 'pageLabels'> & {
+  pageLabelRanges: PageLabelRange[] | null;
+};
+
+/**
+ * Page range with labels resolved to 1-based page numbers
+ */
+interface ResolvedPageRange {
+  startPage: number;
+  endPage?: number;
+}
 
 interface NativeAddon {
   extractTextFromFile: (
     filePath: string,
-    bidiDirection: number
-  ) => Promise<{ text: string; pageCount: number; bidiDirection: number }>;
+    bidiDirection: number,
+    options: NativeTextExtractionOptions
+  ) => Promise<NativeTextExtractionResult>;
   extractTextFromBuffer: (
     buffer: Buffer,
-    bidiDirection: number
-  ) => Promise<{ text: string; pageCount: number; bidiDirection: number }>;
-  getMetadataFromFile: (filePath: string) => Promise<PdfMetadata>;
-  getMetadataFromBuffer: (buffer: Buffer) => Promise<PdfMetadata>;
+    bidiDirection: number,
+    options: NativeTextExtractionOptions
+  ) => Promise<NativeTextExtractionResult>;
+  composeTextFromPlacements: (
+    placements: Buffer,
+    bidiDirection: number,
+    options: NativeTextExtractionOptions
+  ) => Promise<NativeTextExtractionResult>;
+  extractTextFromArchiveFile: (
+    filePath: string,
+    bidiDirection: number,
+    options: NativeArchiveExtractionOptions,
+    onEntry: (entry: NativeArchiveEntry) => void
+  ) => Promise<NativeArchiveSummary>;
+  extractTextFromArchiveBuffer: (
+    buffer: Buffer,
+    bidiDirection: number,
+    options: NativeArchiveExtractionOptions,
+    onEntry: (entry: NativeArchiveEntry) => void
+  ) => Promise<NativeArchiveSummary>;
+  getMetadataFromFile: (filePath: string, options?: NativeMetadataOptions) => Promise<NativeMetadata>;
+  getMetadataFromBuffer: (buffer: Buffer, options?: NativeMetadataOptions) => Promise<NativeMetadata>;
+  getPageFingerprintsFromFile: (filePath: string) => Promise<PdfPageFingerprints>;
+  getPageFingerprintsFromBuffer: (buffer: Buffer) => Promise<PdfPageFingerprints>;
+  getOutlineFromFile: (filePath: string) => Promise<NativeOutline>;
+  getOutlineFromBuffer: (buffer: Buffer) => Promise<NativeOutline>;
+  computeMinHash: (text: string, permutations: number) => Promise<{ minhash: number[] }>;
+  getReadCacheStats: () => ReadCacheStats;
+  warmup: () => Promise<NativeWarmupResult>;
+  cancelOperation: (worker: unknown) => void;
+}
+
+interface NativeWarmupResult {
+  extractionTime: number;
+  bidiTime: number;
+}
+
+interface NativeOutline {
+  pageCount: number;
+  entries: NativeOutlineEntry[];
+}
+
+/**
+ * The native jobs started by one extraction, so a timeout can cancel all of them,
+ * including jobs awaited inside composed (async) operations. Jobs started after
+ * cancellation are cancelled as they start.
+ */
+class NativeJobs {
+  private readonly workers = new Set<unknown>();
+  private cancelled = false;
+
+  track<T>(promise: Promise<T>): Promise<T> {
+    const worker = (promise as Promise<T> & { _worker?: unknown })._worker;
+    if (worker === undefined) {
+      return promise;
+    }
+    if (this.cancelled) {
+      nativeAddon.cancelOperation(worker);
+      return promise;
+    }
+    this.workers.add(worker);
+    const forget = () => this.workers.delete(worker);
+    promise.then(forget, forget);
+    return promise;
+  }
+
+  cancel(): void {
+    this.cancelled = true;
+    for (const worker of this.workers) {
+      nativeAddon.cancelOperation(worker);
+    }
+    this.workers.clear();
+  }
 }
 
 // Load native addon
 // The native addon is built by cmake-js and placed in the build/Release directory
 let nativeAddon: NativeAddon;
+const addonLoadStart = performance.now();
 try {
   const addonPath = path.join(__dirname, '..', 'build', 'Release', 'pdf_parser_native.node');
   nativeAddon = require(addonPath);
@@ -38,60 +192,230 @@ try {
     );
   }
 }
+const addonLoadTime = performance.now() - addonLoadStart;
+
+/**
+ * Pay the one-time costs of the first extraction of a process before serving
+ * requests: libuv pool threads, the parser's static tables and ICU bidi data
+ * all start lazily. A tiny embedded PDF is extracted once per pool thread, at
+ * once, so every thread has run the whole pipeline. Process-wide; later calls
+ * only measure the warm path.
+ *
+ * @param threads Runs started at once (default: UV_THREADPOOL_SIZE, or libuv's 4)
+ * @returns Cold-start timings; extraction and bidi times are those of the slowest run
+ */
+export async function warmup(
+  threads: number = Number(process.env.UV_THREADPOOL_SIZE) || 4
+): Promise<PdfWarmupResult> {
+  const startTime = performance.now();
+  const runs = await Promise.all(
+    Array.from({ length: Math.max(1, threads) }, () => nativeAddon.warmup())
+  );
+  return {
+    addonLoadTime,
+    extractionTime: Math.max(...runs.map((run) => run.extractionTime)),
+    bidiTime: Math.max(...runs.map((run) => run.bidiTime)),
+    totalTime: performance.now() - startTime,
+    threads: runs.length,
+  };
+}
+
+/**
+ * Find contiguous runs of pages missing from the revision cache
+ * @returns Inclusive 0-based [startPage, endPage] pairs
+ */
+function findChangedRuns(pageTexts: (string | undefined)[]): [number, number][] {
+  const runs: [number, number][] = [];
+  let runStart = -1;
+
+  pageTexts.forEach((pageText, i) => {
+    if (pageText === undefined && runStart === -1) {
+      runStart = i;
+    } else if (pageText !== undefined && runStart !== -1) {
+      runs.push([runStart, i - 1]);
+      runStart = -1;
+    }
+  });
+  if (runStart !== -1) {
+    runs.push([runStart, pageTexts.length - 1]);
+  }
+
+  return runs;
+}
+
+/**
+ * Check a 1-based page range before handing it to the native layer
+ */
+function validatePageRange(pageRange: ResolvedPageRange): void {
+  const { startPage, endPage } = pageRange;
+  if (
+    !Number.isInteger(startPage) ||
+    startPage < 1 ||
+    (endPage !== undefined && (!Number.isInteger(endPage) || endPage < startPage))
+  ) {
+    throw new PdfExtractionError(
+      `Invalid page range: ${startPage}-${endPage ?? 'end'}`,
+      PdfErrorCode.INVALID_PAGE_RANGE
+    );
+  }
+}
+
+/**
+ * Error code of a failed text extraction: the native layer reports a page range
+ * reaching past the last page, which only the document could tell
+ */
+function textExtractionErrorCode(error: unknown): PdfErrorCode {
+  return error instanceof Error && error.message.includes('past the last page')
+    ? PdfErrorCode.INVALID_PAGE_RANGE
+    : PdfErrorCode.EXTRACTION_FAILED;
+}
+
+/**
+ * Replace the native label ranges with the label of every page
+ */
+function toMetadata(native: NativeMetadata): PdfMetadata {
+  const { pageLabelRanges, ...metadata } = native;
+  if (!pageLabelRanges) {
+    return metadata;
+  }
+  return { ...metadata, pageLabels: expandPageLabels(pageLabelRanges, metadata.pageCount) };
+}
+
+// Concurrency limit before the limiter has measured anything: libuv's default pool size
+const INITIAL_CONCURRENCY_LIMIT = 4;
 
 /**
  * Main PDF text extraction class
  */
 export class PdfExtractor {
   private readonly options: Required<PdfExtractionOptions>;
+  private readonly revisionCache?: RevisionCache;
+  private readonly placementCache?: PlacementCache;
+  private readonly fileCache?: FileResultCache;
+  private readonly limiter?: ConcurrencyLimiter;
 
   constructor(options: PdfExtractionOptions = {}) {
     this.options = createDefaultOptions(options);
+    if (this.options.revisionCacheSize > 0) {
+      this.revisionCache = new RevisionCache(this.options.revisionCacheSize);
+    }
+    if (this.options.placementCacheSize > 0) {
+      this.placementCache = new PlacementCache(
+        this.options.placementCacheSize,
+        this.options.placementCacheBytes
+      );
+    }
+    if (this.options.fileCacheSize > 0) {
+      this.fileCache = new FileResultCache(this.options.fileCacheSize);
+    }
+    if (this.options.maxConcurrency > 0) {
+      this.limiter = new ConcurrencyLimiter({
+        initialLimit: INITIAL_CONCURRENCY_LIMIT,
+        maxLimit: this.options.maxConcurrency,
+      });
+    }
   }
 
   /**
-   * Extract text from a PDF file
+   * Limit on concurrent text extractions and its use, when maxConcurrency is set
    */
-  async extractText(filePath: string): Promise<PdfExtractionResult> {
+  get concurrency(): ConcurrencyStats | undefined {
+    return this.limiter?.stats;
+  }
+
+  /**
+   * Block cache counters of prefetched file reads, when prefetchReads is set.
+   * Counted when each extraction's readers close, over all extractors of the process.
+   */
+  get readCache(): ReadCacheStats | undefined {
+    return this.options.prefetchReads ? nativeAddon.getReadCacheStats() : undefined;
+  }
+
+  /**
+   * Extract text from a PDF file, optionally from a page range only
+   */
+  async extractText(
+    filePath: string,
+    pageRange?: PdfPageRange,
+    request: PdfTextRequestOptions = {}
+  ): Promise<PdfExtractionResult> {
     const startTime = Date.now();
+    const pageOffsets = request.pageOffsets ?? this.options.pageOffsets;
 
     try {
+      if (this.fileCache && !pageRange) {
+        // Cached results carry page offsets, so calls with and without them share an entry
+        const { pageOffsets: offsets, ...result } = await this.withFileCache(
+          filePath,
+          this.fileCache,
+          'text',
+          (buffer, fileSize) => this.extractWholeFile(filePath, buffer, fileSize, startTime)
+        );
+        return {
+          ...result,
+          ...(pageOffsets && offsets !== undefined ? { pageOffsets: offsets } : {}),
+          processingTime: Date.now() - startTime,
+        };
+      }
+
       // Validate file
       await validateFile(filePath, this.options.maxFileSize);
 
+      const range =
+        pageRange &&
+        (await this.resolvePageRange(pageRange, () => this.getMetadataNative(filePath, true)));
+
       // Get file stats
       const stats = await fs.stat(filePath);
       const fileSize = stats.size;
 
       // Extract text using native binding with timeout
-      const result = await withTimeout(this.extractTextNative(filePath), this.options.timeout);
+      const result = await this.runExtraction(fileSize, async (jobs) => {
+        if (this.revisionCache && !range) {
+          return this.extractWithRevisionCache(
+            await fs.readFile(filePath),
+            this.revisionCache,
+            jobs,
+            pageOffsets
+          );
+        }
+        if (this.placementCache) {
+          return this.extractWithPlacementCache(
+            await fs.readFile(filePath),
+            this.placementCache,
+            jobs,
+            pageOffsets,
+            range
+          );
+        }
+        return jobs.track(this.extractTextNative(filePath, pageOffsets, range));
+      });
 
       const processingTime = Date.now() - startTime;
 
-      return {
-        text: result.text,
-        pageCount: result.pageCount,
-        processingTime,
-        fileSize,
-        textDirection: result.bidiDirection === 1 ? 'rtl' : 'ltr',
-      };
+      return this.toExtractionResult(result, processingTime, fileSize);
     } catch (error) {
       if (error instanceof PdfExtractionError) {
         throw error;
       }
       throw new PdfExtractionError(
         `Failed to extract text: ${error instanceof Error ? error.message : 'Unknown error'}`,
-        PdfErrorCode.EXTRACTION_FAILED,
+        textExtractionErrorCode(error),
         error
       );
     }
   }
 
   /**
-   * Extract text from a PDF buffer
+   * Extract text from a PDF buffer, optionally from a page range only
    */
-  async extractTextFromBuffer(buffer: Buffer): Promise<PdfExtractionResult> {
+  async extractTextFromBuffer(
+    buffer: Buffer,
+    pageRange?: PdfPageRange,
+    request: PdfTextRequestOptions = {}
+  ): Promise<PdfExtractionResult> {
     const startTime = Date.now();
+    const pageOffsets = request.pageOffsets ?? this.options.pageOffsets;
 
     try {
       // Validate buffer size
@@ -102,27 +426,89 @@ export class PdfExtractor {
         );
       }
 
+      const range =
+        pageRange &&
+        (await this.resolvePageRange(pageRange, () =>
+          this.getMetadataFromBufferNative(buffer, true)
+        ));
+
       // Extract text using native binding with timeout
-      const result = await withTimeout(
-        this.extractTextFromBufferNative(buffer),
-        this.options.timeout
-      );
+      const result = await this.runExtraction(buffer.length, (jobs) => {
+        if (this.revisionCache && !range) {
+          return this.extractWithRevisionCache(buffer, this.revisionCache, jobs, pageOffsets);
+        }
+        if (this.placementCache) {
+          return this.extractWithPlacementCache(
+            buffer,
+            this.placementCache,
+            jobs,
+            pageOffsets,
+            range
+          );
+        }
+        return jobs.track(this.extractTextFromBufferNative(buffer, pageOffsets, range));
+      });
 
       const processingTime = Date.now() - startTime;
 
-      return {
-        text: result.text,
-        pageCount: result.pageCount,
-        processingTime,
-        fileSize: buffer.length,
-        textDirection: result.bidiDirection === 1 ? 'rtl' : 'ltr',
-      };
+      return this.toExtractionResult(result, processingTime, buffer.length);
     } catch (error) {
       if (error instanceof PdfExtractionError) {
         throw error;
       }
       throw new PdfExtractionError(
         `Failed to extract text from buffer: ${error instanceof Error ? error.message : 'Unknown error'}`,
+        textExtractionErrorCode(error),
+        error
+      );
+    }
+  }
+
+  /**
+   * Extract the text of every PDF in a zip archive, given as a path or as its bytes.
+   *
+   * Entries are inflated straight into memory, never to disk, and extracted
+   * archiveWorkers at a time. onEntry receives each entry as soon as it is done, in
+   * completion order. Entries over maxFileSize uncompressed, corrupt entries and
+   * unreadable PDFs are reported with an error and do not stop the others. The
+   * timeout applies between entries: the call fails when no entry completes within it.
+   */
+  async extractTextFromArchive(
+    archive: string | Buffer,
+    onEntry: (entry: PdfArchiveEntryResult) => void
+  ): Promise<PdfArchiveResult> {
+    const startTime = Date.now();
+
+    try {
+      if (typeof archive === 'string') {
+        // Archives may well exceed maxFileSize, which applies to each entry
+        await validateFile(archive, Number.MAX_SAFE_INTEGER);
+      }
+
+      const summary = await this.extractArchiveNative(archive, (native) => {
+        const entry: PdfArchiveEntryResult = { name: native.name, index: native.index };
+        if (native.error !== undefined) {
+          const code = native.error.includes('File too large')
+            ? PdfErrorCode.FILE_TOO_LARGE
+            : PdfErrorCode.EXTRACTION_FAILED;
+          entry.error = new PdfExtractionError(native.error, code);
+        } else {
+          entry.result = this.toExtractionResult(
+            native as NativeArchiveEntry & NativeTextExtractionResult,
+            Math.round(native.processingTime),
+            native.fileSize
+          );
+        }
+        onEntry(entry);
+      });
+
+      return { ...summary, processingTime: Date.now() - startTime };
+    } catch (error) {
+      if (error instanceof PdfExtractionError) {
+        throw error;
+      }
+      throw new PdfExtractionError(
+        `Failed to extract text from archive: ${error instanceof Error ? error.message : 'Unknown error'}`,
         PdfErrorCode.EXTRACTION_FAILED,
         error
       );
@@ -134,8 +520,19 @@ export class PdfExtractor {
    */
   async getMetadata(filePath: string): Promise<PdfMetadata> {
     try {
+      if (this.fileCache) {
+        return await this.withFileCache(filePath, this.fileCache, 'metadata', async (buffer) =>
+          toMetadata(
+            await withTimeout(
+              buffer ? this.getMetadataFromBufferNative(buffer) : this.getMetadataNative(filePath),
+              this.options.timeout
+            )
+          )
+        );
+      }
+
       await validateFile(filePath, this.options.maxFileSize);
-      return await withTimeout(this.getMetadataNative(filePath), this.options.timeout);
+      return toMetadata(await withTimeout(this.getMetadataNative(filePath), this.options.timeout));
     } catch (error) {
       if (error instanceof PdfExtractionError) {
         throw error;
@@ -159,7 +556,9 @@ export class PdfExtractor {
           PdfErrorCode.FILE_TOO_LARGE
         );
       }
-      return await withTimeout(this.getMetadataFromBufferNative(buffer), this.options.timeout);
+      return toMetadata(
+        await withTimeout(this.getMetadataFromBufferNative(buffer), this.options.timeout)
+      );
     } catch (error) {
       if (error instanceof PdfExtractionError) {
         throw error;
@@ -172,37 +571,667 @@ export class PdfExtractor {
     }
   }
 
+  /**
+   * Get per-page fingerprints without extracting text
+   */
+  async getPageFingerprints(filePath: string): Promise<PdfPageFingerprints> {
+    try {
+      await validateFile(filePath, this.options.maxFileSize);
+      return await withTimeout(this.getPageFingerprintsNative(filePath), this.options.timeout);
+    } catch (error) {
+      if (error instanceof PdfExtractionError) {
+        throw error;
+      }
+      throw new PdfExtractionError(
+        `Failed to get page fingerprints: ${error instanceof Error ? error.message : 'Unknown error'}`,
+        PdfErrorCode.EXTRACTION_FAILED,
+        error
+      );
+    }
+  }
+
+  /**
+   * Get per-page fingerprints from buffer without extracting text
+   */
+  async getPageFingerprintsFromBuffer(buffer: Buffer): Promise<PdfPageFingerprints> {
+    try {
+      if (buffer.length > this.options.maxFileSize) {
+        throw new PdfExtractionError(
+          `File too large: ${buffer.length} bytes (max: ${this.options.maxFileSize})`,
+          PdfErrorCode.FILE_TOO_LARGE
+        );
+      }
+      return await withTimeout(
+        this.getPageFingerprintsFromBufferNative(buffer),
+        this.options.timeout
+      );
+    } catch (error) {
+      if (error instanceof PdfExtractionError) {
+        throw error;
+      }
+      throw new PdfExtractionError(
+        `Failed to get page fingerprints from buffer: ${error instanceof Error ? error.message : 'Unknown error'}`,
+        PdfErrorCode.EXTRACTION_FAILED,
+        error
+      );
+    }
+  }
+
+  /**
+   * Get the document outline (bookmarks) with each entry's page span
+   */
+  async getOutline(filePath: string): Promise<PdfOutline> {
+    try {
+      await validateFile(filePath, this.options.maxFileSize);
+      const outline = await withTimeout(this.getOutlineNative(filePath), this.options.timeout);
+      return {
+        pageCount: outline.pageCount,
+        entries: withSectionSpans(outline.entries, outline.pageCount),
+      };
+    } catch (error) {
+      if (error instanceof PdfExtractionError) {
+        throw error;
+      }
+      throw new PdfExtractionError(
+        `Failed to get outline: ${error instanceof Error ? error.message : 'Unknown error'}`,
+        PdfErrorCode.EXTRACTION_FAILED,
+        error
+      );
+    }
+  }
+
+  /**
+   * Get the document outline (bookmarks) from buffer
+   */
+  async getOutlineFromBuffer(buffer: Buffer): Promise<PdfOutline> {
+    try {
+      if (buffer.length > this.options.maxFileSize) {
+        throw new PdfExtractionError(
+          `File too large: ${buffer.length} bytes (max: ${this.options.maxFileSize})`,
+          PdfErrorCode.FILE_TOO_LARGE
+        );
+      }
+      const outline = await withTimeout(
+        this.getOutlineFromBufferNative(buffer),
+        this.options.timeout
+      );
+      return {
+        pageCount: outline.pageCount,
+        entries: withSectionSpans(outline.entries, outline.pageCount),
+      };
+    } catch (error) {
+      if (error instanceof PdfExtractionError) {
+        throw error;
+      }
+      throw new PdfExtractionError(
+        `Failed to get outline from buffer: ${error instanceof Error ? error.message : 'Unknown error'}`,
+        PdfErrorCode.EXTRACTION_FAILED,
+        error
+      );
+    }
+  }
+
+  /**
+   * Extract only the pages of the outline section matching a title
+   */
+  async extractSection(filePath: string, section: string): Promise<PdfSectionResult> {
+    const outline = await this.getOutline(filePath);
+    const entry = this.findSectionOrThrow(outline, section);
+    const result = await this.extractText(filePath, this.sectionPageRange(entry));
+    return { ...result, section: entry };
+  }
+
+  /**
+   * Extract only the pages of the outline section matching a title, from buffer
+   */
+  async extractSectionFromBuffer(buffer: Buffer, section: string): Promise<PdfSectionResult> {
+    const outline = await this.getOutlineFromBuffer(buffer);
+    const entry = this.findSectionOrThrow(outline, section);
+    const result = await this.extractTextFromBuffer(buffer, this.sectionPageRange(entry));
+    return { ...result, section: entry };
+  }
+
+  private findSectionOrThrow(outline: PdfOutline, section: string): PdfOutlineEntry {
+    const entry = findSection(outline.entries, section);
+    if (!entry) {
+      throw new PdfExtractionError(
+        outline.entries.length === 0
+          ? `Document has no outline to find section "${section}" in`
+          : `Section not found in outline: "${section}"`,
+        PdfErrorCode.SECTION_NOT_FOUND
+      );
+    }
+    return entry;
+  }
+
+  private sectionPageRange(entry: PdfOutlineEntry): ResolvedPageRange {
+    // findSection only returns entries with a resolved page
+    return { startPage: entry.pageNumber as number, endPage: entry.endPageNumber as number };
+  }
+
+  /**
+   * Resolve page labels in a range to page numbers. Label ranges are read from the
+   * document catalog only when the range contains a label; a numeric range past the
+   * last page is reported by the native extraction.
+   */
+  private async resolvePageRange(
+    pageRange: PdfPageRange,
+    loadMetadata: () => Promise<NativeMetadata>
+  ): Promise<ResolvedPageRange> {
+    const { startPage, endPage } = pageRange;
+    if (typeof startPage === 'number' && typeof endPage !== 'string') {
+      validatePageRange({ startPage, endPage });
+      return { startPage, endPage };
+    }
+
+    const metadata = await withTimeout(loadMetadata(), this.options.timeout);
+    const resolve = (page: number | string): number => {
+      if (typeof page === 'number') {
+        return page;
+      }
+      const pageNumber = resolvePageLabel(metadata.pageLabelRanges, metadata.pageCount, page);
+      if (pageNumber === undefined) {
+        throw new PdfExtractionError(
+          `Page label not found: "${page}"`,
+          PdfErrorCode.INVALID_PAGE_RANGE
+        );
+      }
+      return pageNumber;
+    };
+
+    const range: ResolvedPageRange = {
+      startPage: resolve(startPage),
+      endPage: endPage !== undefined ? resolve(endPage) : undefined,
+    };
+    validatePageRange(range);
+    return range;
+  }
+
+  /**
+   * Serve a whole-file result from the path-keyed cache, or compute and cache it.
+   * When the file's stat identity changed since it was cached, the content hash
+   * decides whether cached results still hold. Whenever the bytes are read for
+   * hashing, including to record the content hash of a new entry, they are handed to
+   * compute so the file is not read twice.
+   */
+  private async withFileCache<K extends 'text' | 'metadata'>(
+    filePath: string,
+    cache: FileResultCache,
+    kind: K,
+    compute: (
+      buffer: Buffer | undefined,
+      fileSize: number
+    ) => Promise<NonNullable<FileCacheEntry[K]>>
+  ): Promise<NonNullable<FileCacheEntry[K]>> {
+    let identity: FileIdentity;
+    try {
+      identity = await statIdentity(filePath);
+    } catch (error) {
+      cache.delete(filePath);
+      // Report missing or unreadable files the same way as uncached calls
+      await validateFile(filePath, this.options.maxFileSize);
+      throw error;
+    }
+
+    let entry = cache.get(filePath);
+    let contentHash = entry?.contentHash;
+    let buffer: Buffer | undefined;
+
+    if (entry && !sameIdentity(entry.identity, identity)) {
+      // Touched, copied over or replaced: keep results only if the bytes are unchanged
+      await validateFile(filePath, this.options.maxFileSize);
+      buffer = await fs.readFile(filePath);
+      contentHash = hashContent(buffer);
+      if (contentHash === entry.contentHash) {
+        entry.identity = identity;
+      } else {
+        cache.delete(filePath);
+        entry = undefined;
+      }
+    }
+
+    const cached = entry?.[kind];
+    if (cached !== undefined) {
+      return cached as NonNullable<FileCacheEntry[K]>;
+    }
+
+    if (!buffer) {
+      await validateFile(filePath, this.options.maxFileSize);
+    }
+    if (contentHash === undefined) {
+      // A new entry needs the content hash: read the file once, for both hash and compute
+      buffer = buffer ?? (await fs.readFile(filePath));
+      contentHash = hashContent(buffer);
+    }
+    const value = await compute(buffer, Number(identity.size));
+
+    // Only cache results of the file as it was stat'ed, not of a concurrent rewrite
+    const identityAfter = await statIdentity(filePath).catch(() => undefined);
+    if (identityAfter && sameIdentity(identityAfter, identity)) {
+      const updated: FileCacheEntry = entry ?? { identity, contentHash };
+      updated[kind] = value;
+      cache.set(filePath, updated);
+    }
+    return value;
+  }
+
+  /**
+   * Extract the whole document of a file, from its bytes when they were already read.
+   * Page offsets are always included, as the result is cached for any later call.
+   */
+  private async extractWholeFile(
+    filePath: string,
+    buffer: Buffer | undefined,
+    fileSize: number,
+    startTime: number
+  ): Promise<PdfExtractionResult> {
+    const result = await this.runExtraction(fileSize, async (jobs) => {
+      if (this.revisionCache) {
+        return this.extractWithRevisionCache(
+          buffer ?? (await fs.readFile(filePath)),
+          this.revisionCache,
+          jobs,
+          true
+        );
+      }
+      if (this.placementCache) {
+        return this.extractWithPlacementCache(
+          buffer ?? (await fs.readFile(filePath)),
+          this.placementCache,
+          jobs,
+          true
+        );
+      }
+      return jobs.track(
+        buffer
+          ? this.extractTextFromBufferNative(buffer, true)
+          : this.extractTextNative(filePath, true)
+      );
+    });
+    return this.toExtractionResult(result, Date.now() - startTime, fileSize);
+  }
+
+  /**
+   * Run a text extraction under the timeout, holding a concurrency slot while
+   * the limiter is enabled. Time spent waiting for the slot is bounded by the
+   * timeout separately. The extraction registers its native jobs with jobs, so
+   * a timeout cancels them and frees the slot promptly.
+   */
+  private async runExtraction<T>(
+    bytes: number,
+    extraction: (jobs: NativeJobs) => Promise<T>
+  ): Promise<T> {
+    const start = () => {
+      const jobs = new NativeJobs();
+      return Object.assign(extraction(jobs), { _cancel: () => jobs.cancel() });
+    };
+
+    if (!this.limiter) {
+      return withTimeout(start(), this.options.timeout);
+    }
+
+    const permit = await this.limiter.acquire(this.options.timeout);
+    const promise = start();
+    try {
+      const result = await withTimeout(promise, this.options.timeout);
+      permit.success(bytes);
+      return result;
+    } catch (error) {
+      const timedOut = error instanceof PdfExtractionError && error.code === PdfErrorCode.TIMEOUT;
+      // The slot stays taken until the native work has actually stopped
+      const release = () => (timedOut ? permit.dropped() : permit.ignore());
+      promise.then(release, release);
+      throw error;
+    }
+  }
+
+  private nativeTextOptions(
+    pageRange?: ResolvedPageRange,
+    pageOffsets: boolean = this.options.pageOffsets
+  ): NativeTextExtractionOptions {
+    const options: NativeTextExtractionOptions = {
+      pageWorkers: this.options.pageWorkers,
+      minhashPermutations: this.options.minhashPermutations,
+      prefetchReads: this.options.prefetchReads,
+      pageOffsets,
+    };
+    if (pageRange) {
+      // Native page indexes are 0-based, -1 meaning the last page
+      options.startPage = pageRange.startPage - 1;
+      options.endPage = pageRange.endPage !== undefined ? pageRange.endPage - 1 : -1;
+    }
+    return options;
+  }
+
+  private toExtractionResult(
+    result: NativeTextExtractionResult,
+    processingTime: number,
+    fileSize: number
+  ): PdfExtractionResult {
+    const extractionResult: PdfExtractionResult = {
+      text: result.text,
+      pageCount: result.pageCount,
+      processingTime,
+      fileSize,
+      textDirection: result.bidiDirection === 1 ? 'rtl' : 'ltr',
+    };
+    if (result.reusedPageCount !== undefined) {
+      extractionResult.reusedPageCount = result.reusedPageCount;
+    }
+    if (result.minhash !== undefined) {
+      extractionResult.minhash = result.minhash;
+    }
+    if (result.pageOffsets !== undefined) {
+      extractionResult.pageOffsets = result.pageOffsets;
+    }
+    return extractionResult;
+  }
+
+  /**
+   * Extract text, reusing cached pages of an earlier revision of the same document.
+   * Unchanged pages are found by fingerprint; only runs of changed pages are extracted,
+   * with the direction of the cached revision so the document composes consistently.
+   * Every native job is registered with jobs, so a timeout cancels whichever are running.
+   */
+  private async extractWithRevisionCache(
+    buffer: Buffer,
+    cache: RevisionCache,
+    jobs: NativeJobs,
+    pageOffsets: boolean
+  ): Promise<NativeTextExtractionResult> {
+    const revisionKeys = hashRevisions(buffer);
+    if (revisionKeys.length === 0) {
+      // No %%EOF marker to key revisions on
+      return {
+        ...(await jobs.track(this.extractTextFromBufferNative(buffer, pageOffsets))),
+        reusedPageCount: 0,
+      };
+    }
+
+    const revisionKey = revisionKeys[revisionKeys.length - 1];
+    const cached = cache.get(revisionKey);
+    if (cached) {
+      return this.revisionResult(cached, cached.pageTexts.length, jobs, pageOffsets);
+    }
+
+    const prior = cache.findPriorRevision(revisionKeys);
+    const { fingerprints } = await jobs.track(
+      nativeAddon.getPageFingerprintsFromBuffer(buffer)
+    );
+
+    if (!prior) {
+      const full = await jobs.track(
+        nativeAddon.extractTextFromBuffer(buffer, -1 /* auto-detect */, {
+          ...this.nativeTextOptions(undefined, pageOffsets),
+          perPage: true,
+        })
+      );
+      const pageTexts = full.pageTexts ?? [];
+      if (pageTexts.length === fingerprints.length) {
+        cache.set(revisionKey, {
+          fingerprints,
+          pageTexts,
+          bidiDirection: full.bidiDirection,
+          minhash: full.minhash,
+        });
+      }
+      return { ...full, reusedPageCount: 0 };
+    }
+
+    const knownPages = new Map<string, string>();
+    prior.fingerprints.forEach((fingerprint, i) => knownPages.set(fingerprint, prior.pageTexts[i]));
+
+    const pageTexts = fingerprints.map((fingerprint) => knownPages.get(fingerprint));
+    const reusedPageCount = pageTexts.filter((pageText) => pageText !== undefined).length;
+
+    await Promise.all(
+      findChangedRuns(pageTexts).map(async ([startPage, endPage]) => {
+        const run = await jobs.track(
+          nativeAddon.extractTextFromBuffer(buffer, prior.bidiDirection, {
+            ...this.nativeTextOptions(undefined, false),
+            startPage,
+            endPage,
+            perPage: true,
+            minhashPermutations: 0,
+          })
+        );
+        if (!run.pageTexts || run.pageTexts.length !== endPage - startPage + 1) {
+          throw new Error(`Unexpected page count extracting pages ${startPage + 1}-${endPage + 1}`);
+        }
+        run.pageTexts.forEach((pageText, i) => {
+          pageTexts[startPage + i] = pageText;
+        });
+      })
+    );
+
+    const entry: RevisionEntry = {
+      fingerprints,
+      pageTexts: pageTexts as string[],
+      bidiDirection: prior.bidiDirection,
+    };
+    cache.set(revisionKey, entry);
+    return this.revisionResult(entry, reusedPageCount, jobs, pageOffsets);
+  }
+
+  /**
+   * Extract text, composing it from the cached placements of the same bytes when
+   * available. A whole-document miss keeps the placements, so any later page range
+   * of it is composed without parsing. A page-range miss extracts only that range
+   * and keeps nothing, so its cost stays proportional to the range.
+   */
+  private async extractWithPlacementCache(
+    buffer: Buffer,
+    cache: PlacementCache,
+    jobs: NativeJobs,
+    pageOffsets: boolean,
+    pageRange?: ResolvedPageRange
+  ): Promise<NativeTextExtractionResult> {
+    const key = hashContent(buffer);
+    const placements = cache.get(key);
+    if (placements) {
+      return jobs.track(
+        nativeAddon.composeTextFromPlacements(
+          placements,
+          -1 /* auto-detect */,
+          this.nativeTextOptions(pageRange, pageOffsets)
+        )
+      );
+    }
+
+    if (pageRange) {
+      return jobs.track(this.extractTextFromBufferNative(buffer, pageOffsets, pageRange));
+    }
+
+    const result = await jobs.track(
+      nativeAddon.extractTextFromBuffer(buffer, -1 /* auto-detect */, {
+        ...this.nativeTextOptions(undefined, pageOffsets),
+        keepPlacements: true,
+      })
+    );
+    if (result.placements) {
+      cache.set(key, result.placements);
+      delete result.placements;
+    }
+    return result;
+  }
+
+  /**
+   * Assemble a result from a revision's page texts. Text assembled from cached pages
+   * is signed on a native worker once, and the signature is kept with the revision.
+   */
+  private async revisionResult(
+    entry: RevisionEntry,
+    reusedPageCount: number,
+    jobs: NativeJobs,
+    pageOffsets: boolean
+  ): Promise<NativeTextExtractionResult> {
+    const text = entry.pageTexts.join('');
+    const result: NativeTextExtractionResult = {
+      text,
+      pageCount: entry.pageTexts.length,
+      bidiDirection: entry.bidiDirection,
+      reusedPageCount,
+    };
+    if (this.options.minhashPermutations > 0) {
+      if (!entry.minhash) {
+        const { minhash } = await jobs.track(
+          nativeAddon.computeMinHash(text, this.options.minhashPermutations)
+        );
+        entry.minhash = minhash;
+      }
+      result.minhash = entry.minhash;
+    }
+    if (pageOffsets) {
+      let offset = 0;
+      result.pageOffsets = entry.pageTexts.map((pageText) => {
+        const pageOffset = offset;
+        offset += Buffer.byteLength(pageText, 'utf8');
+        return pageOffset;
+      });
+    }
+    return result;
+  }
+
   // Native binding methods
   // Note: Bidi algorithm is ALWAYS applied by the native library when ICU is available.
   // Direction is auto-detected (-1) to determine whether text is RTL or LTR.
   //
   // These methods now use N-API async workers with true cancellation support.
   // The promise contains a _worker reference that can be used for cancellation.
-  private async extractTextNative(filePath: string): Promise<{
-    text: string;
-    pageCount: number;
-    bidiDirection: number;
-  }> {
-    const promise = nativeAddon.extractTextFromFile(filePath, -1 /* auto-detect */);
+  private extractTextNative(
+    filePath: string,
+    pageOffsets: boolean,
+    pageRange?: ResolvedPageRange
+  ): Promise<NativeTextExtractionResult> {
+    const promise = nativeAddon.extractTextFromFile(
+      filePath,
+      -1 /* auto-detect */,
+      this.nativeTextOptions(pageRange, pageOffsets)
+    );
+    return promise;
+  }
+
+  private extractTextFromBufferNative(
+    buffer: Buffer,
+    pageOffsets: boolean,
+    pageRange?: ResolvedPageRange
+  ): Promise<NativeTextExtractionResult> {
+    const promise = nativeAddon.extractTextFromBuffer(
+      buffer,
+      -1 /* auto-detect */,
+      this.nativeTextOptions(pageRange, pageOffsets)
+    );
+    return promise;
+  }
+
+  /**
+   * Run a native archive extraction, cancelling it when no entry completes within
+   * the timeout or when onEntry throws
+   */
+  private extractArchiveNative(
+    archive: string | Buffer,
+    onEntry: (entry: NativeArchiveEntry) => void
+  ): Promise<NativeArchiveSummary> {
+    return new Promise((resolve, reject) => {
+      let failure: unknown;
+      let timer: NodeJS.Timeout | undefined;
+
+      const options: NativeArchiveExtractionOptions = {
+        ...this.nativeTextOptions(),
+        entryWorkers: this.options.archiveWorkers,
+        maxEntrySize: this.options.maxFileSize,
+      };
+      // Entries are delivered on the JS thread; exceptions must not reach the native layer
+      const deliver = (entry: NativeArchiveEntry) => {
+        if (failure !== undefined) {
+          return;
+        }
+        try {
+          onEntry(entry);
+          armTimer();
+        } catch (error) {
+          fail(error);
+        }
+      };
+      const promise =
+        typeof archive === 'string'
+          ? nativeAddon.extractTextFromArchiveFile(archive, -1 /* auto-detect */, options, deliver)
+          : nativeAddon.extractTextFromArchiveBuffer(archive, -1 /* auto-detect */, options, deliver);
+
+      const fail = (error: unknown) => {
+        failure = error;
+        clearTimeout(timer);
+        const worker = (promise as Promise<NativeArchiveSummary> & { _worker?: unknown })._worker;
+        if (worker) {
+          nativeAddon.cancelOperation(worker);
+        }
+        reject(error);
+      };
+      const armTimer = () => {
+        clearTimeout(timer);
+        timer = setTimeout(
+          () =>
+            fail(
+              new PdfExtractionError(
+                `No archive entry completed within ${this.options.timeout}ms`,
+                PdfErrorCode.TIMEOUT
+              )
+            ),
+          this.options.timeout
+        );
+      };
+      armTimer();
+
+      promise.then(
+        (summary) => {
+          clearTimeout(timer);
+          if (failure === undefined) {
+            resolve(summary);
+          }
+        },
+        (error) => {
+          clearTimeout(timer);
+          if (failure === undefined) {
+            reject(error);
+          }
+        }
+      );
+    });
+  }
+
+  private async getMetadataNative(
+    filePath: string,
+    lazyXref = this.options.lazyMetadata
+  ): Promise<NativeMetadata> {
+    const promise = nativeAddon.getMetadataFromFile(filePath, { lazyXref });
+    return promise;
+  }
+
+  private async getMetadataFromBufferNative(
+    buffer: Buffer,
+    lazyXref = this.options.lazyMetadata
+  ): Promise<NativeMetadata> {
+    const promise = nativeAddon.getMetadataFromBuffer(buffer, { lazyXref });
+    return promise;
+  }
+
+  private async getPageFingerprintsNative(filePath: string): Promise<PdfPageFingerprints> {
+    const promise = nativeAddon.getPageFingerprintsFromFile(filePath);
     return promise;
   }
 
-  private async extractTextFromBufferNative(buffer: Buffer): Promise<{
-    text: string;
-    pageCount: number;
-    bidiDirection: number;
-  }> {
-    const promise = nativeAddon.extractTextFromBuffer(buffer, -1 /* auto-detect */);
+  private async getPageFingerprintsFromBufferNative(buffer: Buffer): Promise<PdfPageFingerprints> {
+    const promise = nativeAddon.getPageFingerprintsFromBuffer(buffer);
     return promise;
   }
 
-  private async getMetadataNative(filePath: string): Promise<PdfMetadata> {
-    const promise = nativeAddon.getMetadataFromFile(filePath);
+  private async getOutlineNative(filePath: string): Promise<NativeOutline> {
+    const promise = nativeAddon.getOutlineFromFile(filePath);
     return promise;
   }
 
-  private async getMetadataFromBufferNative(buffer: Buffer): Promise<PdfMetadata> {
-    const promise = nativeAddon.getMetadataFromBuffer(buffer);
+  private async getOutlineFromBufferNative(buffer: Buffer): Promise<NativeOutline> {
+    const promise = nativeAddon.getOutlineFromBuffer(buffer);
     return promise;
   }
 }
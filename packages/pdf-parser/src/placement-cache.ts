@@ -0,0 +1,65 @@
+/**
+ * Placement cache
+ *
+ * Keeps the text placements extracted from a document in the native layer's
+ * binary form (placement IR), keyed by a hash of the document bytes. Composing
+ * text from placements skips parsing and interpreting the PDF, which is most of
+ * the cost of an extraction, so further page ranges of a cached document are
+ * served from the IR alone.
+ */
+
+/**
+ * Least-recently-used cache of placement IR blobs, bounded both by entry count
+ * and by total bytes. A blob larger than the byte bound is not kept.
+ */
+export class PlacementCache {
+  private readonly entries = new Map<string, Buffer>();
+  private totalBytes = 0;
+
+  constructor(
+    private readonly maxEntries: number,
+    private readonly maxBytes: number = Infinity
+  ) {}
+
+  get(key: string): Buffer | undefined {
+    const placements = this.entries.get(key);
+    if (placements) {
+      // Refresh recency
+      this.entries.delete(key);
+      this.entries.set(key, placements);
+    }
+    return placements;
+  }
+
+  set(key: string, placements: Buffer): void {
+    this.delete(key);
+    if (placements.length > this.maxBytes) {
+      return;
+    }
+    this.entries.set(key, placements);
+    this.totalBytes += placements.length;
+
+    while (this.entries.size > this.maxEntries || this.totalBytes > this.maxBytes) {
+      this.delete(this.entries.keys().next().value as string);
+    }
+  }
+
+  get size(): number {
+    return this.entries.size;
+  }
+
+  /**
+   * Bytes held by the cached blobs
+   */
+  get bytes(): number {
+    return this.totalBytes;
+  }
+
+  private delete(key: string): void {
+    const placements = this.entries.get(key);
+    if (placements) {
+      this.totalBytes -= placements.length;
+      this.entries.delete(key);
+    }
+  }
+}
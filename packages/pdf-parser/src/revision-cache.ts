@@ -0,0 +1,97 @@
+import { createHash } from 'crypto';
+
+/**
+ * Revision cache for incrementally updated PDFs
+ *
+ * An incremental update appends new objects, an xref section and a trailer
+ * ending in %%EOF to the unchanged bytes of the previous revision. Every
+ * %%EOF marker therefore closes a complete earlier revision, and hashing
+ * the bytes up to each marker yields the keys of all revisions contained
+ * in the file. Cached page texts are indexed by page fingerprint, so pages
+ * whose content, resources and boxes are unchanged can be reused as-is.
+ */
+
+const EOF_MARKER = Buffer.from('%%EOF', 'latin1');
+
+/**
+ * Cached extraction of one revision
+ */
+export interface RevisionEntry {
+  /** Page fingerprints in page order */
+  fingerprints: string[];
+  /** Composed text of each page, in page order */
+  pageTexts: string[];
+  /** Direction applied when the revision was extracted (0=LTR, 1=RTL) */
+  bidiDirection: number;
+  /** MinHash signature of the revision's text, once computed */
+  minhash?: number[];
+}
+
+/**
+ * Compute the revision key of every revision contained in a PDF buffer,
+ * oldest first. The last key identifies the buffer itself. Hashing is done
+ * in one pass, snapshotting the running digest at each %%EOF marker.
+ */
+export function hashRevisions(buffer: Buffer): string[] {
+  const keys: string[] = [];
+  const hash = createHash('sha256');
+  let hashedUpTo = 0;
+
+  let markerIndex = buffer.indexOf(EOF_MARKER);
+  while (markerIndex !== -1) {
+    const revisionEnd = markerIndex + EOF_MARKER.length;
+    hash.update(buffer.subarray(hashedUpTo, revisionEnd));
+    hashedUpTo = revisionEnd;
+    keys.push(hash.copy().digest('hex'));
+    markerIndex = buffer.indexOf(EOF_MARKER, revisionEnd);
+  }
+
+  return keys;
+}
+
+/**
+ * Least-recently-used cache of extracted revisions
+ */
+export class RevisionCache {
+  private readonly entries = new Map<string, RevisionEntry>();
+
+  constructor(private readonly maxEntries: number) {}
+
+  get(key: string): RevisionEntry | undefined {
+    const entry = this.entries.get(key);
+    if (entry) {
+      // Refresh recency
+      this.entries.delete(key);
+      this.entries.set(key, entry);
+    }
+    return entry;
+  }
+
+  set(key: string, entry: RevisionEntry): void {
+    this.entries.delete(key);
+    this.entries.set(key, entry);
+
+    while (this.entries.size > this.maxEntries) {
+      const oldestKey = this.entries.keys().next().value as string;
+      this.entries.delete(oldestKey);
+    }
+  }
+
+  /**
+   * Find the newest cached revision among the earlier revisions of a buffer
+   * @param revisionKeys Keys from hashRevisions(), oldest first
+   */
+  findPriorRevision(revisionKeys: string[]): RevisionEntry | undefined {
+    for (let i = revisionKeys.length - 2; i >= 0; i--) {
+      const entry = this.get(revisionKeys[i]);
+      if (entry) {
+        return entry;
+      }
+    }
+    return undefined;
+  }
+
+  get size(): number {
+    return this.entries.size;
+  }
+}
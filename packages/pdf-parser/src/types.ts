@@ -7,6 +7,101 @@ export interface PdfExtractionOptions {
   maxFileSize?: number;
   /** Timeout for extraction in milliseconds (default: 30000) */
   timeout?: number;
+  /**
+   * Threads extracting page spans of a single document concurrently (default: 1).
+   * Values above 1 only kick in for documents with enough pages to split.
+   */
+  pageWorkers?: number;
+  /**
+   * Number of document revisions whose per-page text is kept for reuse (default: 0,
+   * disabled). When a PDF is an incremental update of a cached revision, only pages
+   * whose fingerprint changed are re-extracted.
+   */
+  revisionCacheSize?: number;
+  /**
+   * Length of the MinHash signature computed over the extracted text (default: 0, off).
+   * Signatures feed near-duplicate detection, see LshIndex.
+   */
+  minhashPermutations?: number;
+  /**
+   * Number of local files whose whole-document text and metadata are cached by path
+   * (default: 0, disabled). Entries are validated with a single stat() of the file's
+   * device, inode, size and mtime; the content is hashed only when those change.
+   */
+  fileCacheSize?: number;
+  /**
+   * Upper bound of an adaptive limit on concurrent text extractions (default: 0, no
+   * limit). The limit moves between 1 and this bound with the measured extraction
+   * cost; extractions over it wait, at most for the timeout.
+   */
+  maxConcurrency?: number;
+  /**
+   * Read files for text extraction through a block cache filled ahead of the parser
+   * (default: false). The file's head and tail are read on open and the blocks after
+   * each one accessed in the background, via io_uring when built with USE_IO_URING
+   * or pread() on a helper thread. Helps on network-backed volumes. POSIX only.
+   */
+  prefetchReads?: boolean;
+  /**
+   * Entries of a zip archive extracted concurrently by extractTextFromArchive (default: 4).
+   * Each entry is held in memory uncompressed while it is extracted.
+   */
+  archiveWorkers?: number;
+  /**
+   * Number of documents whose extracted text placements are kept in a compact binary
+   * form (default: 0, disabled). Other page ranges of the same bytes are then composed
+   * from the placements, without parsing the PDF again.
+   */
+  placementCacheSize?: number;
+  /**
+   * Upper bound on the bytes of placements kept by the placement cache (default: 256MB).
+   * Documents whose placements alone exceed the bound are not kept.
+   */
+  placementCacheBytes?: number;
+  /**
+   * Also return where each page starts in the extracted text, as UTF-8 byte offsets
+   * (default: false). Pages are then composed one by one, which gives the same text.
+   */
+  pageOffsets?: boolean;
+  /**
+   * Read metadata without loading the cross-reference table (default: false): only
+   * the trailer, Info, the page tree root and the page labels tree are read, each
+   * object located from its xref entry. Page count is the page tree's /Count.
+   * Documents with xref streams or encryption are parsed as usual.
+   */
+  lazyMetadata?: boolean;
+}
+
+/**
+ * Cold-start timings of warmup(), in milliseconds
+ */
+export interface PdfWarmupResult {
+  /** Loading the native addon (dlopen and module init), when this module was first imported */
+  addonLoadTime: number;
+  /** First extraction of the embedded document: thread start, parser and font tables, composer */
+  extractionTime: number;
+  /** First right-to-left extraction: ICU bidi data */
+  bidiTime: number;
+  /** Whole warm-up, from the call to the last run finishing */
+  totalTime: number;
+  /** Warm-up runs started at once, one per worker-pool thread */
+  threads: number;
+}
+
+/**
+ * Block cache counters of prefetched file reads, process-wide
+ */
+export interface ReadCacheStats {
+  /** Blocks already in memory when the parser needed them */
+  hits: number;
+  /** Blocks still being read ahead when the parser needed them */
+  waits: number;
+  /** Blocks read on demand */
+  misses: number;
+  /** Blocks read ahead */
+  prefetches: number;
+  /** How blocks are read ahead */
+  backend: 'io_uring' | 'pread';
 }
 
 export interface PdfExtractionResult {
@@ -20,6 +115,18 @@ export interface PdfExtractionResult {
   fileSize: number;
   /** Detected text direction: 'ltr' (left-to-right) or 'rtl' (right-to-left) */
   textDirection: 'ltr' | 'rtl';
+  /** Pages served from the revision cache instead of being re-extracted */
+  reusedPageCount?: number;
+  /**
+   * MinHash signature of the text over 5-word shingles (when minhashPermutations > 0).
+   * Empty when the text has no words, e.g. scanned or image-only documents.
+   */
+  minhash?: number[];
+  /**
+   * Byte offset of each page's text in the UTF-8 encoding of text, in page order
+   * (when pageOffsets is set)
+   */
+  pageOffsets?: number[];
 }
 
 export interface PdfMetadata {
@@ -41,6 +148,83 @@ export interface PdfMetadata {
   pageCount: number;
   /** PDF version (e.g., "1.7") */
   version?: string;
+  /**
+   * Printed label of each page in page order (e.g. "iii", "12", "A-1"), present
+   * only when the document defines page labels
+   */
+  pageLabels?: string[];
+}
+
+export interface PdfPageFingerprints {
+  /** Number of pages fingerprinted */
+  pageCount: number;
+  /**
+   * One 16-character hex digest per page, in page order. Equal digests mean the
+   * page's content streams, resources and page boxes are identical.
+   */
+  fingerprints: string[];
+}
+
+/**
+ * Page range to extract, inclusive. Numbers are 1-based physical pages; strings
+ * are page labels as printed on the page (e.g. "iv", "12", "A-1").
+ */
+export interface PdfPageRange {
+  /** First page to extract */
+  startPage: number | string;
+  /** Last page to extract (default: last page of the document) */
+  endPage?: number | string;
+}
+
+/**
+ * Options of a single text extraction call
+ */
+export interface PdfTextRequestOptions {
+  /** Also return where each page starts in the text (default: the pageOffsets option) */
+  pageOffsets?: boolean;
+}
+
+export interface PdfOutlineEntry {
+  /** Bookmark title */
+  title: string;
+  /** Nesting depth (0 = top level) */
+  level: number;
+  /** 1-based page the entry points to, or null when its destination cannot be resolved */
+  pageNumber: number | null;
+  /** Last page of the section (before the next entry at the same or a shallower level) */
+  endPageNumber: number | null;
+}
+
+export interface PdfOutline {
+  /** Number of pages in the document */
+  pageCount: number;
+  /** Outline entries flattened in document order */
+  entries: PdfOutlineEntry[];
+}
+
+export interface PdfSectionResult extends PdfExtractionResult {
+  /** Outline entry the extracted pages belong to */
+  section: PdfOutlineEntry;
+}
+
+export interface PdfArchiveEntryResult {
+  /** Path of the PDF inside the archive */
+  name: string;
+  /** Position of the entry among the archive's PDF entries, in central directory order */
+  index: number;
+  /** Extraction result of the entry (absent when it failed) */
+  result?: PdfExtractionResult;
+  /** Why the entry could not be extracted (absent when it succeeded) */
+  error?: PdfExtractionError;
+}
+
+export interface PdfArchiveResult {
+  /** Number of PDF entries in the archive */
+  entryCount: number;
+  /** Number of entries reported with an error */
+  failedCount: number;
+  /** Processing time of the whole archive in milliseconds */
+  processingTime: number;
 }
 
 export class PdfExtractionError extends Error {
@@ -60,4 +244,6 @@ export enum PdfErrorCode {
   EXTRACTION_FAILED = 'EXTRACTION_FAILED',
   TIMEOUT = 'TIMEOUT',
   NATIVE_ERROR = 'NATIVE_ERROR',
+  INVALID_PAGE_RANGE = 'INVALID_PAGE_RANGE',
+  SECTION_NOT_FOUND = 'SECTION_NOT_FOUND',
 }
@@ -7,6 +7,17 @@ import { PdfExtractionOptions, PdfExtractionError, PdfErrorCode } from './types'
  */
 export const DEFAULT_MAX_FILE_SIZE = 100 * 1024 * 1024; // 100MB
 export const DEFAULT_TIMEOUT = 30000; // 30 seconds
+export const DEFAULT_PAGE_WORKERS = 1; // sequential page extraction
+export const DEFAULT_REVISION_CACHE_SIZE = 0; // revision cache disabled
+export const DEFAULT_MINHASH_PERMUTATIONS = 0; // no MinHash signature
+export const DEFAULT_FILE_CACHE_SIZE = 0; // path-keyed result cache disabled
+export const DEFAULT_MAX_CONCURRENCY = 0; // no concurrency limiter
+export const DEFAULT_PREFETCH_READS = false; // files read on demand
+export const DEFAULT_ARCHIVE_WORKERS = 4; // zip archive entries extracted concurrently
+export const DEFAULT_PLACEMENT_CACHE_SIZE = 0; // placement cache disabled
+export const DEFAULT_PLACEMENT_CACHE_BYTES = 256 * 1024 * 1024; // 256MB of placements
+export const DEFAULT_PAGE_OFFSETS = false; // no per-page offsets
+export const DEFAULT_LAZY_METADATA = false; // metadata through the full xref
 
 /**
  * Create default options with user overrides
@@ -17,6 +28,17 @@ export function createDefaultOptions(
   return {
     maxFileSize: options.maxFileSize ?? DEFAULT_MAX_FILE_SIZE,
     timeout: options.timeout ?? DEFAULT_TIMEOUT,
+    pageWorkers: options.pageWorkers ?? DEFAULT_PAGE_WORKERS,
+    revisionCacheSize: options.revisionCacheSize ?? DEFAULT_REVISION_CACHE_SIZE,
+    minhashPermutations: options.minhashPermutations ?? DEFAULT_MINHASH_PERMUTATIONS,
+    fileCacheSize: options.fileCacheSize ?? DEFAULT_FILE_CACHE_SIZE,
+    maxConcurrency: options.maxConcurrency ?? DEFAULT_MAX_CONCURRENCY,
+    prefetchReads: options.prefetchReads ?? DEFAULT_PREFETCH_READS,
+    archiveWorkers: options.archiveWorkers ?? DEFAULT_ARCHIVE_WORKERS,
+    placementCacheSize: options.placementCacheSize ?? DEFAULT_PLACEMENT_CACHE_SIZE,
+    placementCacheBytes: options.placementCacheBytes ?? DEFAULT_PLACEMENT_CACHE_BYTES,
+    pageOffsets: options.pageOffsets ?? DEFAULT_PAGE_OFFSETS,
+    lazyMetadata: options.lazyMetadata ?? DEFAULT_LAZY_METADATA,
   };
 }
 
@@ -110,6 +132,8 @@ export function formatProcessingTime(milliseconds: number): string {
 
 interface PromiseWithWorker<T> extends Promise<T> {
   _worker?: unknown;
+  // Set on promises composed of several native jobs; cancels all of them
+  _cancel?: () => void;
 }
 
 interface NativeAddon {
@@ -127,7 +151,13 @@ export function withTimeout<T>(promise: Promise<T>, timeoutMs: number): Promise<
     timeoutId = setTimeout(() => {
       // Try to cancel the native worker if it exists
       const promiseWithWorker = promise as PromiseWithWorker<T>;
-      if (promiseWithWorker._worker) {
+      if (promiseWithWorker._cancel) {
+        try {
+          promiseWithWorker._cancel();
+        } catch (error) {
+          // Cancellation failed, but we'll still reject with timeout
+        }
+      } else if (promiseWithWorker._worker) {
         try {
           // Load the native addon to access cancelOperation
           const addonPath = path.join(